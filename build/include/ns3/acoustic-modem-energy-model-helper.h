@@ -0,0 +1 @@
+#include "/root/repo/src/uan/helper/acoustic-modem-energy-model-helper.h"
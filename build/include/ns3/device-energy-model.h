@@ -0,0 +1 @@
+#include "/root/repo/src/energy/model/device-energy-model.h"
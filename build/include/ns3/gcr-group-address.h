@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/gcr-group-address.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/mesh/model/dot11s/hwmp-protocol.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/internet/model/ipv4-packet-probe.h"
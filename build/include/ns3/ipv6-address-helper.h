@@ -0,0 +1 @@
+#include "/root/repo/src/internet/helper/ipv6-address-helper.h"
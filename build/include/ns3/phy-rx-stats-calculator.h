@@ -0,0 +1 @@
+#include "/root/repo/src/lte/helper/phy-rx-stats-calculator.h"
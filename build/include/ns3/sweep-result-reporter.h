@@ -0,0 +1 @@
+#include "/root/repo/src/flow-monitor/helper/sweep-result-reporter.h"
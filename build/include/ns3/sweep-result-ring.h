@@ -0,0 +1 @@
+#include "/root/repo/src/flow-monitor/model/sweep-result-ring.h"
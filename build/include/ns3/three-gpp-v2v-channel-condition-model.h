@@ -0,0 +1 @@
+#include "/root/repo/src/buildings/model/three-gpp-v2v-channel-condition-model.h"
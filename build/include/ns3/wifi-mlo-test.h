@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/test/wifi-mlo-test.h"
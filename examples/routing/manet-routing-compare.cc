@@ -45,12 +45,24 @@
  * to the end of the simulation.
  *
  * The program outputs a few items:
- * - packet receptions are notified to stdout such as:
+ * - each second, the data reception statistics are tabulated in memory and,
+ *   at the end of the simulation, output to a comma-separated value (csv) file,
+ *   one line per second with the totals followed by the packets received by
+ *   each sink
+ * - the cost of the simulation is reported to stdout: the run time, the number
+ *   of events executed per second of run time and the peak resident set size
+ *   of the process, so that the comparisons of the protocols include it
+ * - if enabled with --printPackets, packet receptions are notified to stdout
+ *   such as:
  *   <timestamp> <node-id> received one packet from <src-address>
- * - each second, the data reception statistics are tabulated and output
- *   to a comma-separated value (csv) file
  * - some tracing and flow monitor configuration that used to work is
  *   left commented inline in the program
+ *
+ * With --branches=N, the simulation runs once up to the start of the traffic,
+ * then branches into N variants of the traffic, which continue from the state
+ * reached by the routing protocols and differ by the run number of the random
+ * numbers they draw.  Each variant writes its own CSV file, with the number of
+ * the variant appended to its name.
  */
 
 #include "ns3/aodv-module.h"
@@ -67,6 +79,11 @@
 
 #include <fstream>
 #include <iostream>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
 
 using namespace ns3;
 using namespace dsr;
@@ -99,29 +116,49 @@ class RoutingExperiment
      * Setup the receiving socket in a Sink Node.
      * @param addr The address of the node.
      * @param node The node pointer.
+     * @param sink The index of the sink.
      * @return the socket.
      */
-    Ptr<Socket> SetupPacketReceive(Ipv4Address addr, Ptr<Node> node);
+    Ptr<Socket> SetupPacketReceive(Ipv4Address addr, Ptr<Node> node, uint32_t sink);
     /**
      * Receive a packet.
+     * @param sink The index of the sink.
      * @param socket The receiving socket.
      */
-    void ReceivePacket(Ptr<Socket> socket);
+    void ReceivePacket(uint32_t sink, Ptr<Socket> socket);
     /**
-     * Compute the throughput.
+     * Compute the throughput and store the statistics of the last second.
      */
     void CheckThroughput();
+    /**
+     * Write the statistics of all the seconds to the CSV file.
+     */
+    void WriteStatistics() const;
+
+    /// Reception statistics of a second of the experiment.
+    struct Sample
+    {
+        double second;    //!< Simulation second at which the sample is taken.
+        double kbs;       //!< Receive rate during the last second, in kbps.
+        uint32_t packets; //!< Packets received by all the sinks during the last second.
+    };
 
     uint32_t port{9};            //!< Receiving port number.
     uint32_t bytesTotal{0};      //!< Total received bytes.
     uint32_t packetsReceived{0}; //!< Total received packets.
 
+    std::vector<uint32_t> m_sinkPackets; //!< Packets received by each sink in the current second.
+    std::vector<Sample> m_samples;       //!< Statistics of each second.
+    std::vector<uint32_t> m_sinkSamples; //!< Packets received by each sink, m_nSinks per second.
+
     std::string m_CSVfileName{"manet-routing.output.csv"}; //!< CSV filename.
     int m_nSinks{10};                                      //!< Number of sink nodes.
     std::string m_protocolName{"AODV"};                    //!< Protocol name.
     double m_txp{7.5};                                     //!< Tx power.
     bool m_traceMobility{false};                           //!< Enable mobility tracing.
     bool m_flowMonitor{false};                             //!< Enable FlowMonitor.
+    bool m_printPackets{false};                            //!< Print the received packets.
+    uint32_t m_branches{0};                                //!< Number of traffic variants.
 };
 
 RoutingExperiment::RoutingExperiment()
@@ -147,8 +184,29 @@ PrintReceivedPacket(Ptr<Socket> socket, Ptr<Packet> packet, Address senderAddres
     return oss.str();
 }
 
+/**
+ * Get the peak resident set size of the process.
+ * @return the peak resident set size, in kilobytes, or 0 if it is not available.
+ */
+static uint64_t
+GetPeakRss()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // in bytes on macOS
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
 void
-RoutingExperiment::ReceivePacket(Ptr<Socket> socket)
+RoutingExperiment::ReceivePacket(uint32_t sink, Ptr<Socket> socket)
 {
     Ptr<Packet> packet;
     Address senderAddress;
@@ -156,7 +214,11 @@ RoutingExperiment::ReceivePacket(Ptr<Socket> socket)
     {
         bytesTotal += packet->GetSize();
         packetsReceived += 1;
-        NS_LOG_UNCOND(PrintReceivedPacket(socket, packet, senderAddress));
+        m_sinkPackets[sink] += 1;
+        if (m_printPackets)
+        {
+            NS_LOG_UNCOND(PrintReceivedPacket(socket, packet, senderAddress));
+        }
     }
 }
 
@@ -166,26 +228,53 @@ RoutingExperiment::CheckThroughput()
     double kbs = (bytesTotal * 8.0) / 1000;
     bytesTotal = 0;
 
-    std::ofstream out(m_CSVfileName, std::ios::app);
+    m_samples.push_back({Simulator::Now().GetSeconds(), kbs, packetsReceived});
+    m_sinkSamples.insert(m_sinkSamples.end(), m_sinkPackets.begin(), m_sinkPackets.end());
 
-    out << (Simulator::Now()).GetSeconds() << "," << kbs << "," << packetsReceived << ","
-        << m_nSinks << "," << m_protocolName << "," << m_txp << "" << std::endl;
-
-    out.close();
+    std::fill(m_sinkPackets.begin(), m_sinkPackets.end(), 0);
     packetsReceived = 0;
     Simulator::Schedule(Seconds(1), &RoutingExperiment::CheckThroughput, this);
 }
 
+void
+RoutingExperiment::WriteStatistics() const
+{
+    std::ofstream out(m_CSVfileName);
+    out << "SimulationSecond,"
+        << "ReceiveRate,"
+        << "PacketsReceived,"
+        << "NumberOfSinks,"
+        << "RoutingProtocol,"
+        << "TransmissionPower";
+    for (int i = 0; i < m_nSinks; i++)
+    {
+        out << ",Sink" << i;
+    }
+    out << "\n";
+
+    auto sinkPackets = m_sinkSamples.cbegin();
+    for (const auto& sample : m_samples)
+    {
+        out << sample.second << "," << sample.kbs << "," << sample.packets << "," << m_nSinks
+            << "," << m_protocolName << "," << m_txp;
+        for (int i = 0; i < m_nSinks; i++)
+        {
+            out << "," << *sinkPackets++;
+        }
+        out << "\n";
+    }
+}
+
 Ptr<Socket>
-RoutingExperiment::SetupPacketReceive(Ipv4Address addr, Ptr<Node> node)
+RoutingExperiment::SetupPacketReceive(Ipv4Address addr, Ptr<Node> node, uint32_t sink)
 {
     TypeId tid = TypeId::LookupByName("ns3::UdpSocketFactory");
-    Ptr<Socket> sink = Socket::CreateSocket(node, tid);
+    Ptr<Socket> socket = Socket::CreateSocket(node, tid);
     InetSocketAddress local = InetSocketAddress(addr, port);
-    sink->Bind(local);
-    sink->SetRecvCallback(MakeCallback(&RoutingExperiment::ReceivePacket, this));
+    socket->Bind(local);
+    socket->SetRecvCallback(MakeCallback(&RoutingExperiment::ReceivePacket, this, sink));
 
-    return sink;
+    return socket;
 }
 
 void
@@ -196,8 +285,18 @@ RoutingExperiment::CommandSetup(int argc, char** argv)
     cmd.AddValue("traceMobility", "Enable mobility tracing", m_traceMobility);
     cmd.AddValue("protocol", "Routing protocol (OLSR, AODV, DSDV, DSR)", m_protocolName);
     cmd.AddValue("flowMonitor", "enable FlowMonitor", m_flowMonitor);
+    cmd.AddValue("printPackets", "Print a line for each received packet", m_printPackets);
+    cmd.AddValue("branches",
+                 "Number of variants of the traffic run from the state reached at its start, "
+                 "0 to run a single simulation",
+                 m_branches);
     cmd.Parse(argc, argv);
 
+    if (m_branches > 0 && m_traceMobility)
+    {
+        NS_FATAL_ERROR("Error: the variants of the traffic would share the mobility trace file.");
+    }
+
     std::vector<std::string> allowedProtocols{"OLSR", "AODV", "DSDV", "DSR"};
 
     if (std::find(std::begin(allowedProtocols), std::end(allowedProtocols), m_protocolName) ==
@@ -222,16 +321,6 @@ RoutingExperiment::Run()
 {
     Packet::EnablePrinting();
 
-    // blank out the last output file and write the column headers
-    std::ofstream out(m_CSVfileName);
-    out << "SimulationSecond,"
-        << "ReceiveRate,"
-        << "PacketsReceived,"
-        << "NumberOfSinks,"
-        << "RoutingProtocol,"
-        << "TransmissionPower" << std::endl;
-    out.close();
-
     int nWifis = 50;
 
     double TotalTime = 200.0;
@@ -351,17 +440,29 @@ RoutingExperiment::Run()
     onoff1.SetAttribute("OnTime", StringValue("ns3::ConstantRandomVariable[Constant=1.0]"));
     onoff1.SetAttribute("OffTime", StringValue("ns3::ConstantRandomVariable[Constant=0.0]"));
 
-    for (int i = 0; i < m_nSinks; i++)
-    {
-        Ptr<Socket> sink = SetupPacketReceive(adhocInterfaces.GetAddress(i), adhocNodes.Get(i));
+    // the traffic starts after the convergence of the routing protocols
+    double trafficStart = 100.0;
+    auto installTraffic = [&]() {
+        for (int i = 0; i < m_nSinks; i++)
+        {
+            AddressValue remoteAddress(InetSocketAddress(adhocInterfaces.GetAddress(i), port));
+            onoff1.SetAttribute("Remote", remoteAddress);
 
-        AddressValue remoteAddress(InetSocketAddress(adhocInterfaces.GetAddress(i), port));
-        onoff1.SetAttribute("Remote", remoteAddress);
+            Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable>();
+            ApplicationContainer temp = onoff1.Install(adhocNodes.Get(i + m_nSinks));
+            temp.Start(Seconds(var->GetValue(trafficStart, trafficStart + 1)) - Simulator::Now());
+            temp.Stop(Seconds(TotalTime) - Simulator::Now());
+        }
+    };
 
-        Ptr<UniformRandomVariable> var = CreateObject<UniformRandomVariable>();
-        ApplicationContainer temp = onoff1.Install(adhocNodes.Get(i + m_nSinks));
-        temp.Start(Seconds(var->GetValue(100.0, 101.0)));
-        temp.Stop(Seconds(TotalTime));
+    m_sinkPackets.assign(m_nSinks, 0);
+    for (int i = 0; i < m_nSinks; i++)
+    {
+        SetupPacketReceive(adhocInterfaces.GetAddress(i), adhocNodes.Get(i), i);
+    }
+    if (m_branches == 0)
+    {
+        installTraffic();
     }
 
     std::stringstream ss;
@@ -387,8 +488,11 @@ RoutingExperiment::Run()
     // AsciiTraceHelper ascii;
     // Ptr<OutputStreamWrapper> osw = ascii.CreateFileStream(tr_name + ".tr");
     // wifiPhy.EnableAsciiAll(osw);
-    AsciiTraceHelper ascii;
-    MobilityHelper::EnableAsciiAll(ascii.CreateFileStream(tr_name + ".mob"));
+    if (m_traceMobility)
+    {
+        AsciiTraceHelper ascii;
+        MobilityHelper::EnableAsciiAll(ascii.CreateFileStream(tr_name + ".mob"));
+    }
 
     FlowMonitorHelper flowmonHelper;
     Ptr<FlowMonitor> flowmon;
@@ -401,8 +505,47 @@ RoutingExperiment::Run()
 
     CheckThroughput();
 
-    Simulator::Stop(Seconds(TotalTime));
+    if (m_branches > 0)
+    {
+        // run the warm-up once, then branch into variants of the traffic, which
+        // differ by the run number of the random number streams they create
+        Simulator::Stop(Seconds(trafficStart));
+        Simulator::Run();
+
+        SimulationCheckpoint checkpoint;
+        auto branch = checkpoint.Branch(m_branches);
+        if (!branch)
+        {
+            Simulator::Destroy();
+            NS_ABORT_MSG_IF(checkpoint.GetNFailed() > 0,
+                            checkpoint.GetNFailed() << " branches failed");
+            return;
+        }
+        RngSeedManager::SetRun(RngSeedManager::GetRun() + *branch);
+        auto suffix = "-" + std::to_string(*branch);
+        m_CSVfileName.insert(std::min(m_CSVfileName.rfind('.'), m_CSVfileName.size()), suffix);
+        tr_name += suffix;
+        installTraffic();
+    }
+
+    const double simulatedTime = TotalTime - Simulator::Now().GetSeconds();
+    Simulator::Stop(Seconds(TotalTime) - Simulator::Now());
+    uint64_t events = Simulator::GetEventCount();
+    SystemWallClockMs clock;
+    clock.Start();
     Simulator::Run();
+    int64_t runTime = clock.End();
+    events = Simulator::GetEventCount() - events;
+
+    WriteStatistics();
+
+    std::cout << m_protocolName << ": " << simulatedTime << " s simulated in " << runTime / 1000.0
+              << " s, " << events << " events";
+    if (runTime > 0)
+    {
+        std::cout << " (" << events * 1000.0 / runTime << " events/s)";
+    }
+    std::cout << ", peak RSS " << GetPeakRss() << " KiB" << std::endl;
 
     if (m_flowMonitor)
     {
@@ -6,6 +6,7 @@
 #include "ns3/applications-module.h"
 #include "ns3/wifi-module.h"
 #include "ns3/netanim-module.h"
+#include "ns3/flow-monitor-module.h"
 
 using namespace ns3;
 
@@ -15,10 +16,12 @@ int main (int argc, char *argv[])
 {
     uint32_t nNodes = 10;
     double simTime = 30.0; // seconds
+    bool enableAnim = true;
 
     CommandLine cmd;
     cmd.AddValue ("nNodes", "Number of nodes", nNodes);
     cmd.AddValue ("simTime", "Simulation time in seconds", simTime);
+    cmd.AddValue ("anim", "Write the NetAnim trace (disable when running sweeps)", enableAnim);
     cmd.Parse (argc, argv);
 
     // Create nodes
@@ -91,31 +94,45 @@ int main (int argc, char *argv[])
     apps.Stop (Seconds (simTime));
 
     // NetAnim animation
-    AnimationInterface anim("my_olsr.xml"); // generate XML file
-    anim.SetMaxPktsPerTraceFile (50000);
-
-    for (uint32_t i = 0; i < nodes.GetN (); ++i)
+    std::unique_ptr<AnimationInterface> anim;
+    if (enableAnim)
     {
-        std::string desc = std::to_string(i); // node number displayed as label
-
-        if (i == 0) { // Sender
-            anim.UpdateNodeColor(nodes.Get(i), 255, 0, 0);  // Red
-        }
-        else if (i == 1) { // Receiver
-            anim.UpdateNodeColor(nodes.Get(i), 255, 255, 0); // Yellow
-        }
-        else if (i % 5 == 0) { // MPR node
-            anim.UpdateNodeColor(nodes.Get(i), 0, 255, 0);  // Green
-        }
-        else { // Regular node
-            anim.UpdateNodeColor(nodes.Get(i), 0, 0, 255);  // Blue
+        anim = std::make_unique<AnimationInterface> ("my_olsr.xml"); // generate XML file
+        anim->SetMaxPktsPerTraceFile (50000);
+
+        for (uint32_t i = 0; i < nodes.GetN (); ++i)
+        {
+            std::string desc = std::to_string(i); // node number displayed as label
+
+            if (i == 0) { // Sender
+                anim->UpdateNodeColor(nodes.Get(i), 255, 0, 0);  // Red
+            }
+            else if (i == 1) { // Receiver
+                anim->UpdateNodeColor(nodes.Get(i), 255, 255, 0); // Yellow
+            }
+            else if (i % 5 == 0) { // MPR node
+                anim->UpdateNodeColor(nodes.Get(i), 0, 255, 0);  // Green
+            }
+            else { // Regular node
+                anim->UpdateNodeColor(nodes.Get(i), 0, 0, 255);  // Blue
+            }
+
+            anim->UpdateNodeDescription(nodes.Get(i), desc);     // Display node number
         }
-
-        anim.UpdateNodeDescription(nodes.Get(i), desc);     // Display node number
     }
 
+    // Flow statistics, reported to sweep-runner when launched by it
+    FlowMonitorHelper flowmon;
+    Ptr<FlowMonitor> monitor = flowmon.InstallAll ();
+    SweepResultReporter reporter;
+
     Simulator::Stop (Seconds (simTime));
     Simulator::Run ();
+
+    reporter.ReportFlowMonitor (monitor, flowmon.GetClassifier ());
+    reporter.ReportCounter ("rxBytes", DynamicCast<PacketSink> (apps.Get (0))->GetTotalRx ());
+    reporter.Finish ();
+
     Simulator::Destroy ();
     return 0;
 }
@@ -363,6 +363,8 @@ RoutingProtocol::DoDispose()
         iter->first->Close();
     }
     m_socketSubnetBroadcastAddresses.clear();
+    m_timerWheel.CancelAll();
+    m_addressReqTimer.clear();
     Ipv4RoutingProtocol::DoDispose();
 }
 
@@ -1165,14 +1167,8 @@ void
 RoutingProtocol::ScheduleRreqRetry(Ipv4Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
-    if (m_addressReqTimer.find(dst) == m_addressReqTimer.end())
-    {
-        Timer timer(Timer::CANCEL_ON_DESTROY);
-        m_addressReqTimer[dst] = timer;
-    }
-    m_addressReqTimer[dst].SetFunction(&RoutingProtocol::RouteRequestTimerExpire, this);
-    m_addressReqTimer[dst].Cancel();
-    m_addressReqTimer[dst].SetArguments(dst);
+    auto& timer = m_addressReqTimer[dst];
+    m_timerWheel.Cancel(timer);
     RoutingTableEntry rt;
     m_routingTable.LookupRoute(dst, rt);
     Time retry;
@@ -1187,7 +1183,7 @@ RoutingProtocol::ScheduleRreqRetry(Ipv4Address dst)
         NS_LOG_LOGIC("Applying binary exponential backoff factor " << backoffFactor);
         retry = m_netTraversalTime * (1 << backoffFactor);
     }
-    m_addressReqTimer[dst].Schedule(retry);
+    timer = m_timerWheel.Schedule(retry, &RoutingProtocol::RouteRequestTimerExpire, this, dst);
     NS_LOG_LOGIC("Scheduled RREQ retry in " << retry.As(Time::S));
 }
 
@@ -1712,8 +1708,12 @@ RoutingProtocol::RecvReply(Ptr<Packet> p, Ipv4Address receiver, Ipv4Address send
         if (toDst.GetFlag() == IN_SEARCH)
         {
             m_routingTable.Update(newEntry);
-            m_addressReqTimer[dst].Cancel();
-            m_addressReqTimer.erase(dst);
+            auto timer = m_addressReqTimer.find(dst);
+            if (timer != m_addressReqTimer.end())
+            {
+                m_timerWheel.Cancel(timer->second);
+                m_addressReqTimer.erase(timer);
+            }
         }
         m_routingTable.LookupRoute(dst, toDst);
         SendPacketFromQueue(dst, toDst.GetRoute());
@@ -28,6 +28,7 @@
 #include "ns3/node.h"
 #include "ns3/output-stream-wrapper.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/timer-wheel.h"
 
 #include <map>
 
@@ -473,8 +474,10 @@ class RoutingProtocol : public Ipv4RoutingProtocol
     Timer m_rerrRateLimitTimer;
     /// Reset RERR count and schedule RERR rate limit timer with delay 1 sec.
     void RerrRateLimitTimerExpire();
-    /// Map IP address + RREQ timer.
-    std::map<Ipv4Address, Timer> m_addressReqTimer;
+    /// Per-destination timers, multiplexed onto a single simulator event
+    TimerWheel m_timerWheel;
+    /// Map IP address + RREQ timer, armed on m_timerWheel.
+    std::map<Ipv4Address, TimerWheel::Id> m_addressReqTimer;
     /**
      * Handle route discovery process
      * @param dst the destination IP address
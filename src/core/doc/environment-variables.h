@@ -147,6 +147,30 @@ const char* NS_GLOBAL_VALUE = "name=value[;...]";
  */
 const char* NS_LOG = "component=option[|option...][:...]";
 
+/**
+ * @ingroup core-environ
+ * @brief Record the logging messages with the binary backend.
+ *
+ * Record the messages of the enabled logging components in a binary
+ * log file, decoded offline by the \c binary-log-decode utility.
+ * See ns3::BinaryLog for details.
+ *
+ * <dl class="params">
+ *   <dt>%Parameters</dt>
+ *   <dd>
+ *     <table class="params">
+ *       <tr>
+ *         <td class="paramname">filename</td>
+ *         <td>The name of the binary log file to create.</td>
+ *       </tr>
+ *     </table>
+ *   </dd>
+ * </dl>
+ *
+ * Referenced by ns3::BinaryLog, in \ref binary-log.cc.
+ */
+const char* NS_LOG_BINARY = "filename";
+
 /**
  * @ingroup core-environ
  * @brief Where to make temporary directories.
@@ -0,0 +1,692 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "binary-log.h"
+
+#include "environment-variable.h"
+#include "log.h"
+#include "nstime.h"
+#include "simulator.h"
+
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <set>
+
+/**
+ * @file
+ * @ingroup logging
+ * ns3::BinaryLog and ns3::BinaryLogRecord implementations.
+ */
+
+namespace ns3
+{
+
+namespace
+{
+
+/// Magic number at the start of a log file
+const char BINARY_LOG_MAGIC[8] = {'n', 's', '3', 'b', 'l', 'o', 'g', '\0'};
+/// Version of the layout of the log files
+const uint32_t BINARY_LOG_VERSION = 1;
+/// Type of the entries describing a call site
+const uint8_t SITE_ENTRY = 'S';
+/// Type of the entries holding a record
+const uint8_t RECORD_ENTRY = 'R';
+/// Size of the type and size fields of a record entry
+const std::size_t RECORD_ENTRY_HEADER = 1 + sizeof(uint32_t);
+
+/// Flags of a record
+enum RecordFlags : uint8_t
+{
+    PREFIX_TIME = 0x01,  //!< The time prefix is enabled
+    PREFIX_NODE = 0x02,  //!< The node prefix is enabled
+    PREFIX_FUNC = 0x04,  //!< The function prefix is enabled
+    PREFIX_LEVEL = 0x08, //!< The level prefix is enabled
+    HAS_CLOCK = 0x10,    //!< The record holds the simulation time and context
+};
+
+/// The formatting flags of the logging macros
+const std::ios_base::fmtflags DEFAULT_FLAGS =
+    std::ios_base::skipws | std::ios_base::dec | std::ios_base::boolalpha;
+
+/// Description of a call site
+struct Site
+{
+    std::string component; //!< Name of the LogComponent
+    std::string function;  //!< Name of the function
+    std::string file;      //!< Name of the file
+    int32_t line;          //!< Line in the file
+    int32_t level;         //!< LogLevel
+    BinaryLog::Kind kind;  //!< Kind of the logging macro
+};
+
+/// State of the binary backend, shared by the logging threads
+struct BinaryLogState
+{
+    std::mutex mutex;                                    //!< Protects the state
+    std::mutex buffersMutex;                             //!< Protects the list of the buffers
+    std::ofstream file;                                  //!< Log file
+    uint32_t bufferSize{BinaryLog::DEFAULT_BUFFER_SIZE}; //!< Size of the thread buffers
+    std::vector<Site> sites;                             //!< Registered call sites
+    std::set<BinaryLogBuffer*> buffers;                  //!< Buffers of the logging threads
+};
+
+/**
+ * Get the state of the binary backend.
+ *
+ * The state is never destroyed, so that the threads can flush their buffers
+ * when they exit, even after the static objects are destroyed.
+ *
+ * @return The state.
+ */
+BinaryLogState&
+GetState()
+{
+    static auto state = new BinaryLogState;
+    return *state;
+}
+
+/**
+ * Write a string to a log file.
+ * @param [in] file The log file.
+ * @param [in] string The string.
+ */
+void
+WriteString(std::ostream& file, const std::string& string)
+{
+    uint32_t size = string.size();
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    file.write(string.data(), size);
+}
+
+/**
+ * Write the description of a call site to the log file.
+ * @param [in] state The state of the binary backend, locked.
+ * @param [in] id The identifier of the call site.
+ */
+void
+WriteSite(BinaryLogState& state, uint32_t id)
+{
+    const Site& site = state.sites[id];
+    state.file.write(reinterpret_cast<const char*>(&SITE_ENTRY), 1);
+    state.file.write(reinterpret_cast<const char*>(&id), sizeof(id));
+    state.file.write(reinterpret_cast<const char*>(&site.kind), sizeof(site.kind));
+    state.file.write(reinterpret_cast<const char*>(&site.level), sizeof(site.level));
+    state.file.write(reinterpret_cast<const char*>(&site.line), sizeof(site.line));
+    WriteString(state.file, site.component);
+    WriteString(state.file, site.function);
+    WriteString(state.file, site.file);
+}
+
+/**
+ * Write the complete records of a buffer to the log file, if it is open, and
+ * move the current record, if any, to the start of the buffer.
+ * @param [in] state The state of the binary backend, locked.
+ * @param [in] buffer The buffer.
+ */
+void
+WriteRecords(BinaryLogState& state, BinaryLogBuffer& buffer)
+{
+    if (buffer.m_record == 0)
+    {
+        return;
+    }
+    if (state.file.is_open())
+    {
+        state.file.write(buffer.m_data.data(), buffer.m_record);
+    }
+    std::memmove(buffer.m_data.data(),
+                 buffer.m_data.data() + buffer.m_record,
+                 buffer.m_used - buffer.m_record);
+    buffer.m_used -= buffer.m_record;
+    buffer.m_record = 0;
+}
+
+/**
+ * Locks giving access to the log file and to the buffers of all the logging
+ * threads while no thread appends a record to them.
+ *
+ * A logging thread locks its buffer while appending a record, and then the
+ * state to write the buffer to the log file when it is full, so the buffers
+ * are locked before the state.  The list of the buffers is protected by
+ * another mutex, so that a logging thread can lock the state while the
+ * buffers are being locked.
+ */
+struct BinaryLogBuffersLock
+{
+    /**
+     * Lock the list of the buffers, the buffers, and then the state.
+     * @param [in] state The state of the binary backend.
+     */
+    BinaryLogBuffersLock(BinaryLogState& state)
+        : listLock(state.buffersMutex)
+    {
+        for (auto buffer : state.buffers)
+        {
+            bufferLocks.emplace_back(buffer->m_mutex);
+        }
+        stateLock = std::unique_lock(state.mutex);
+    }
+
+    std::unique_lock<std::mutex> listLock;                 //!< Lock of the list of the buffers
+    std::vector<std::unique_lock<std::mutex>> bufferLocks; //!< Locks of the buffers
+    std::unique_lock<std::mutex> stateLock;                //!< Lock of the state
+};
+
+/**
+ * Enable the binary backend if the \c NS_LOG_BINARY environment variable is set.
+ * @return \c true if the binary backend was enabled.
+ */
+bool
+CheckBinaryLogEnvironmentVariable()
+{
+    auto [found, filename] = EnvironmentVariable::Get("NS_LOG_BINARY");
+    return found && !filename.empty() && BinaryLog::Enable(filename);
+}
+
+} // unnamed namespace
+
+std::atomic<bool> BinaryLog::m_enabled{false};
+
+/// Whether the binary backend was enabled by the environment
+static bool g_binaryLogFromEnvironment [[maybe_unused]] = CheckBinaryLogEnvironmentVariable();
+
+bool
+BinaryLog::Enable(const std::string& filename, uint32_t bufferSize)
+{
+    Disable();
+    BinaryLogState& state = GetState();
+    BinaryLogBuffersLock lock(state);
+    state.file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!state.file.is_open())
+    {
+        return false;
+    }
+    state.file.write(BINARY_LOG_MAGIC, sizeof(BINARY_LOG_MAGIC));
+    state.file.write(reinterpret_cast<const char*>(&BINARY_LOG_VERSION),
+                     sizeof(BINARY_LOG_VERSION));
+    // the call sites registered by a previous log file
+    for (uint32_t id = 0; id < state.sites.size(); id++)
+    {
+        WriteSite(state, id);
+    }
+    state.bufferSize = bufferSize;
+    for (auto buffer : state.buffers)
+    {
+        buffer->m_data.resize(bufferSize);
+    }
+    m_enabled = true;
+    return true;
+}
+
+void
+BinaryLog::Disable()
+{
+    BinaryLogState& state = GetState();
+    BinaryLogBuffersLock lock(state);
+    if (!m_enabled)
+    {
+        return;
+    }
+    m_enabled = false;
+    for (auto buffer : state.buffers)
+    {
+        WriteRecords(state, *buffer);
+    }
+    state.file.close();
+}
+
+uint32_t
+BinaryLog::RegisterSite(const LogComponent& log,
+                        int32_t level,
+                        Kind kind,
+                        const char* function,
+                        const char* file,
+                        int line)
+{
+    BinaryLogState& state = GetState();
+    std::lock_guard lock(state.mutex);
+    uint32_t id = state.sites.size();
+    state.sites.push_back({log.Name(), function, file, line, level, kind});
+    if (state.file.is_open())
+    {
+        WriteSite(state, id);
+    }
+    return id;
+}
+
+BinaryLogBuffer::BinaryLogBuffer(uint32_t size, bool root)
+    : m_data(size),
+      m_root(root)
+{
+    if (m_root)
+    {
+        BinaryLogState& state = GetState();
+        std::lock_guard lock(state.buffersMutex);
+        state.buffers.insert(this);
+    }
+}
+
+BinaryLogBuffer::~BinaryLogBuffer()
+{
+    if (m_root)
+    {
+        BinaryLogState& state = GetState();
+        std::lock_guard listLock(state.buffersMutex);
+        std::lock_guard bufferLock(m_mutex);
+        std::lock_guard lock(state.mutex);
+        WriteRecords(state, *this);
+        state.buffers.erase(this);
+        if (state.file.is_open())
+        {
+            state.file.flush();
+        }
+    }
+}
+
+BinaryLogBuffer&
+BinaryLogBuffer::Get()
+{
+    static thread_local BinaryLogBuffer t_buffer(GetState().bufferSize, true);
+    BinaryLogBuffer* buffer = &t_buffer;
+    while (buffer->m_active)
+    {
+        if (!buffer->m_nested)
+        {
+            buffer->m_nested = std::make_unique<BinaryLogBuffer>(1024, false);
+        }
+        buffer = buffer->m_nested.get();
+    }
+    return *buffer;
+}
+
+void
+BinaryLogBuffer::Flush()
+{
+    if (m_record == 0)
+    {
+        return;
+    }
+    BinaryLogState& state = GetState();
+    std::lock_guard lock(state.mutex);
+    WriteRecords(state, *this);
+}
+
+void
+BinaryLogBuffer::MakeRoom(std::size_t size)
+{
+    if (m_root)
+    {
+        Flush();
+    }
+    if (m_used + size > m_data.size())
+    {
+        // a record larger than the buffer
+        m_data.resize(std::max(2 * m_data.size(), m_used + size));
+    }
+}
+
+BinaryLogRecord::BinaryLogRecord(const LogComponent& log, uint32_t site, BinaryLog::Kind kind)
+    : m_buffer(BinaryLogBuffer::Get()),
+      m_kind(kind)
+{
+    if (m_buffer.m_root)
+    {
+        m_buffer.m_mutex.lock();
+    }
+    m_buffer.m_active = true;
+    m_buffer.m_record = m_buffer.m_used;
+    m_buffer.Put(&RECORD_ENTRY, 1);
+    // the size of the record is stored when it is complete
+    uint32_t size = 0;
+    m_buffer.Put(&size, sizeof(size));
+    m_buffer.Put(&site, sizeof(site));
+
+    uint8_t flags = 0;
+    flags |= log.IsEnabled(LOG_PREFIX_TIME) ? PREFIX_TIME : 0;
+    flags |= log.IsEnabled(LOG_PREFIX_NODE) ? PREFIX_NODE : 0;
+    flags |= log.IsEnabled(LOG_PREFIX_FUNC) ? PREFIX_FUNC : 0;
+    flags |= log.IsEnabled(LOG_PREFIX_LEVEL) ? PREFIX_LEVEL : 0;
+    // as the time and node printers, which are set when the simulator is created
+    if (LogGetTimePrinter() != nullptr)
+    {
+        flags |= HAS_CLOCK;
+        m_buffer.Put(&flags, sizeof(flags));
+        uint8_t resolution = Time::GetResolution();
+        m_buffer.Put(&resolution, sizeof(resolution));
+        int64_t now = Simulator::Now().GetTimeStep();
+        m_buffer.Put(&now, sizeof(now));
+        uint32_t context = Simulator::GetContext();
+        m_buffer.Put(&context, sizeof(context));
+    }
+    else
+    {
+        m_buffer.Put(&flags, sizeof(flags));
+    }
+
+    std::ostringstream& text = m_buffer.m_text;
+    text.flags(DEFAULT_FLAGS);
+    text.precision(6);
+    text.width(0);
+    text.fill(' ');
+    m_buffer.m_formatted = false;
+}
+
+BinaryLogRecord::~BinaryLogRecord()
+{
+    uint32_t size = m_buffer.m_used - m_buffer.m_record - RECORD_ENTRY_HEADER;
+    std::memcpy(m_buffer.m_data.data() + m_buffer.m_record + 1, &size, sizeof(size));
+    m_buffer.m_record = m_buffer.m_used;
+    m_buffer.m_active = false;
+
+    // the records logged while formatting the arguments of this one
+    BinaryLogBuffer* nested = m_buffer.m_nested.get();
+    if (nested != nullptr && nested->m_used > 0)
+    {
+        m_buffer.Put(nested->m_data.data(), nested->m_used);
+        m_buffer.m_record = m_buffer.m_used;
+        nested->m_used = 0;
+        nested->m_record = 0;
+    }
+    if (m_buffer.m_root)
+    {
+        m_buffer.m_mutex.unlock();
+    }
+}
+
+void
+BinaryLogRecord::PutString(Tag tag, const char* data, std::size_t size)
+{
+    uint32_t size32 = size;
+    m_buffer.Put(&tag, 1);
+    m_buffer.Put(&size32, sizeof(size32));
+    m_buffer.Put(data, size);
+}
+
+void
+BinaryLogRecord::EndText()
+{
+    std::ostringstream& text = m_buffer.m_text;
+    const std::string string = text.str();
+    PutString(STRING, string.data(), string.size());
+    text.str("");
+    m_buffer.m_formatted = text.flags() != DEFAULT_FLAGS || text.precision() != 6 ||
+                           text.width() != 0 || text.fill() != ' ';
+}
+
+BinaryLogRecord&
+BinaryLogRecord::operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+{
+    manipulator(m_buffer.m_text);
+    EndText();
+    return *this;
+}
+
+BinaryLogRecord&
+BinaryLogRecord::operator<<(std::ostream& (*manipulator)(std::ostream&))
+{
+    manipulator(m_buffer.m_text);
+    EndText();
+    return *this;
+}
+
+/**
+ * Read a value from a log file.
+ * @tparam T \deduced The type of the value.
+ * @param [in] is The log file.
+ * @param [out] value The value.
+ * @return \c false if the end of the log file is reached.
+ */
+template <typename T>
+static bool
+ReadValue(std::istream& is, T& value)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+/**
+ * Read a string from a log file.
+ * @param [in] is The log file.
+ * @param [out] string The string.
+ * @return \c false if the end of the log file is reached.
+ */
+static bool
+ReadString(std::istream& is, std::string& string)
+{
+    uint32_t size;
+    if (!ReadValue(is, size))
+    {
+        return false;
+    }
+    string.resize(size);
+    return static_cast<bool>(is.read(string.data(), size));
+}
+
+/**
+ * Print a record of a log file.
+ * @param [in] site The call site of the record.
+ * @param [in] record The record, without its type and size.
+ * @param [in] os The output stream.
+ * @return \c false if the record is corrupted.
+ */
+static bool
+PrintRecord(const Site& site, const std::string& record, std::ostream& os)
+{
+    std::istringstream is(record);
+    uint32_t id;
+    uint8_t flags;
+    if (!ReadValue(is, id) || !ReadValue(is, flags))
+    {
+        return false;
+    }
+    std::ostringstream line;
+    if (flags & HAS_CLOCK)
+    {
+        uint8_t resolution;
+        int64_t now;
+        uint32_t context;
+        if (!ReadValue(is, resolution) || !ReadValue(is, now) || !ReadValue(is, context))
+        {
+            return false;
+        }
+        if (flags & PREFIX_TIME)
+        {
+            if (resolution != Time::GetResolution())
+            {
+                Time::SetResolution(static_cast<Time::Unit>(resolution));
+            }
+            // as DefaultTimePrinter
+            line << std::fixed;
+            switch (Time::GetResolution())
+            {
+            case Time::US:
+                line << std::setprecision(6);
+                break;
+            case Time::NS:
+                line << std::setprecision(9);
+                break;
+            case Time::PS:
+                line << std::setprecision(12);
+                break;
+            case Time::FS:
+                line << std::setprecision(15);
+                break;
+            default:
+                line << std::setprecision(5);
+            }
+            line << TimeStep(now).As(Time::S) << " ";
+            line.flags(std::ios_base::skipws | std::ios_base::dec);
+            line.precision(6);
+        }
+        if (flags & PREFIX_NODE)
+        {
+            // as DefaultNodePrinter
+            if (context == Simulator::NO_CONTEXT)
+            {
+                line << "-1 ";
+            }
+            else
+            {
+                line << context << " ";
+            }
+        }
+    }
+
+    if (site.kind == BinaryLog::FUNCTION)
+    {
+        line << site.component << ":" << site.function << "(";
+    }
+    else
+    {
+        if (flags & PREFIX_FUNC)
+        {
+            line << site.component << ":" << site.function << "(): ";
+        }
+        if (flags & PREFIX_LEVEL)
+        {
+            line << "[" << LogComponent::GetLevelLabel(static_cast<LogLevel>(site.level)) << "] ";
+        }
+    }
+
+    bool first = true;
+    uint8_t tag;
+    while (ReadValue(is, tag))
+    {
+        if (site.kind == BinaryLog::FUNCTION && !first)
+        {
+            line << ", ";
+        }
+        first = false;
+        bool ok = true;
+        switch (tag)
+        {
+        case BinaryLogRecord::SIGNED: {
+            int64_t value;
+            ok = ReadValue(is, value);
+            line << value;
+            break;
+        }
+        case BinaryLogRecord::UNSIGNED: {
+            uint64_t value;
+            ok = ReadValue(is, value);
+            line << value;
+            break;
+        }
+        case BinaryLogRecord::REAL: {
+            double value;
+            ok = ReadValue(is, value);
+            line << value;
+            break;
+        }
+        case BinaryLogRecord::CHAR: {
+            char value;
+            ok = ReadValue(is, value);
+            line << value;
+            break;
+        }
+        case BinaryLogRecord::BOOL: {
+            uint8_t value;
+            ok = ReadValue(is, value);
+            line << (value ? "true" : "false");
+            break;
+        }
+        case BinaryLogRecord::POINTER: {
+            uint64_t value;
+            ok = ReadValue(is, value);
+            line << reinterpret_cast<const void*>(static_cast<uintptr_t>(value));
+            break;
+        }
+        case BinaryLogRecord::STRING:
+        case BinaryLogRecord::QUOTED: {
+            std::string value;
+            ok = ReadString(is, value);
+            if (tag == BinaryLogRecord::QUOTED)
+            {
+                line << "\"" << value << "\"";
+            }
+            else
+            {
+                line << value;
+            }
+            break;
+        }
+        default:
+            ok = false;
+        }
+        if (!ok)
+        {
+            return false;
+        }
+    }
+
+    if (site.kind == BinaryLog::FUNCTION)
+    {
+        line << ")";
+    }
+    os << line.str() << std::endl;
+    return true;
+}
+
+bool
+BinaryLog::Decode(std::istream& is, std::ostream& os)
+{
+    char magic[sizeof(BINARY_LOG_MAGIC)];
+    uint32_t version;
+    if (!is.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, BINARY_LOG_MAGIC, sizeof(magic)) != 0 || !ReadValue(is, version) ||
+        version != BINARY_LOG_VERSION)
+    {
+        return false;
+    }
+
+    std::vector<Site> sites;
+    uint8_t type;
+    while (ReadValue(is, type))
+    {
+        if (type == SITE_ENTRY)
+        {
+            uint32_t id;
+            Site site;
+            if (!ReadValue(is, id) || !ReadValue(is, site.kind) || !ReadValue(is, site.level) ||
+                !ReadValue(is, site.line) || !ReadString(is, site.component) ||
+                !ReadString(is, site.function) || !ReadString(is, site.file))
+            {
+                return false;
+            }
+            if (id >= sites.size())
+            {
+                sites.resize(id + 1);
+            }
+            sites[id] = site;
+        }
+        else if (type == RECORD_ENTRY)
+        {
+            uint32_t size;
+            std::string record;
+            if (!ReadValue(is, size))
+            {
+                return false;
+            }
+            record.resize(size);
+            if (!is.read(record.data(), size) || size < sizeof(uint32_t))
+            {
+                return false;
+            }
+            uint32_t id;
+            std::memcpy(&id, record.data(), sizeof(id));
+            if (id >= sites.size() || !PrintRecord(sites[id], record, os))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,494 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef NS3_BINARY_LOG_H
+#define NS3_BINARY_LOG_H
+
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup logging
+ * ns3::BinaryLog and ns3::BinaryLogRecord declarations.
+ */
+
+namespace ns3
+{
+
+class LogComponent;
+
+template <typename T>
+class Ptr;
+
+/**
+ * @ingroup logging
+ * @brief Binary backend of the logging macros.
+ *
+ * When the binary backend is enabled, the NS_LOG macros of the enabled
+ * components no longer format their messages: each message is recorded
+ * as the identifier of the macro invocation (its call site), the current
+ * simulation time and context, and the raw values of the arguments which
+ * are strings, characters, numbers, booleans or pointers.  The other
+ * arguments, and the arguments following a stream manipulator which
+ * changes the formatting, are formatted to a string.  The records are
+ * appended to a buffer of the logging thread, written to the log file
+ * when the buffer is full.
+ *
+ * The log file is decoded offline, with BinaryLog::Decode or the
+ * \c binary-log-decode utility, to the text which the macros would have
+ * printed, with the default time and node prefixes.  The contexts added
+ * by NS_LOG_APPEND_CONTEXT are not recorded.  NS_LOG_UNCOND always prints
+ * its message.
+ *
+ * The binary backend is enabled by BinaryLog::Enable or by setting the
+ * \c NS_LOG_BINARY environment variable to the name of the log file:
+ * @code
+ *   $ NS_LOG='AodvRoutingProtocol=level_all|prefix_all' NS_LOG_BINARY=aodv.log ./ns3 run ...
+ *   $ ./ns3 run 'binary-log-decode aodv.log' > aodv.txt
+ * @endcode
+ */
+class BinaryLog
+{
+  public:
+    /// Kinds of call sites
+    enum Kind : uint8_t
+    {
+        MESSAGE = 0,  //!< NS_LOG and the NS_LOG_ERROR, ... NS_LOG_LOGIC macros
+        FUNCTION = 1, //!< NS_LOG_FUNCTION and NS_LOG_FUNCTION_NOARGS
+    };
+
+    /// Default size of the buffer of each logging thread, in bytes
+    static const uint32_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+    /**
+     * Create a log file and record the messages of the logging macros in it.
+     *
+     * If the binary backend is already enabled, its log file is closed first.
+     *
+     * @param [in] filename The name of the log file.
+     * @param [in] bufferSize The size of the buffer of each logging thread, in bytes.
+     * @return \c false if the log file cannot be created.
+     */
+    static bool Enable(const std::string& filename, uint32_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    /**
+     * Write the buffered records to the log file, close it, and go back to
+     * printing the messages of the logging macros.
+     *
+     * The buffers of the other logging threads are written when they are
+     * not appending a record.  The records they complete afterwards are
+     * dropped.
+     */
+    static void Disable();
+
+    /**
+     * Check if the binary backend is enabled.
+     * @return \c true if the binary backend is enabled.
+     */
+    static bool IsEnabled()
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Register a call site of a logging macro.
+     *
+     * @param [in] log The LogComponent of the call site.
+     * @param [in] level The LogLevel of the call site.
+     * @param [in] kind The kind of the macro.
+     * @param [in] function The name of the function of the call site.
+     * @param [in] file The name of the file of the call site.
+     * @param [in] line The line of the call site.
+     * @return The identifier of the call site.
+     */
+    static uint32_t RegisterSite(const LogComponent& log,
+                                 int32_t level,
+                                 Kind kind,
+                                 const char* function,
+                                 const char* file,
+                                 int line);
+
+    /**
+     * Decode a log file to the text the logging macros would have printed.
+     *
+     * This sets the Time resolution to the one of the simulation which wrote
+     * the log file.
+     *
+     * @param [in] is The log file.
+     * @param [in] os The output stream.
+     * @return \c false if \p is is not a complete log file.
+     */
+    static bool Decode(std::istream& is, std::ostream& os);
+
+  private:
+    static std::atomic<bool> m_enabled; //!< Whether the binary backend is enabled
+};
+
+/**
+ * @ingroup logging
+ * @brief Buffer of the records of a logging thread.
+ *
+ * @internal
+ * This is exposed here so that the arguments of the logging macros are
+ * recorded by inline code.
+ */
+class BinaryLogBuffer
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] size The size of the buffer, in bytes.
+     * @param [in] root Whether this buffer writes its records to the log file,
+     *             rather than to the buffer of the record being formatted.
+     */
+    BinaryLogBuffer(uint32_t size, bool root);
+    /** Destructor: write the buffered records to the log file. */
+    ~BinaryLogBuffer();
+
+    /**
+     * Append bytes to the current record.
+     * @param [in] data The bytes.
+     * @param [in] size The number of bytes.
+     */
+    void Put(const void* data, std::size_t size)
+    {
+        if (m_used + size > m_data.size())
+        {
+            MakeRoom(size);
+        }
+        std::memcpy(m_data.data() + m_used, data, size);
+        m_used += size;
+    }
+
+    /**
+     * Write the complete records to the log file, or drop them if the binary
+     * backend is disabled.
+     */
+    void Flush();
+
+    /**
+     * Get the buffer of the calling thread for a new record.
+     *
+     * The records logged while an argument of a record is formatted are
+     * appended to a nested buffer, and moved after that record when it is
+     * complete.
+     *
+     * @return The buffer.
+     */
+    static BinaryLogBuffer& Get();
+
+    std::vector<char> m_data;                  //!< Records
+    std::size_t m_used{0};                     //!< Number of bytes of m_data in use
+    std::size_t m_record{0};                   //!< Start of the current record in m_data
+    std::ostringstream m_text;                 //!< Formats the arguments recorded as text
+    bool m_formatted{false};                   //!< Whether m_text has a non-default format
+    bool m_active{false};                      //!< Whether a record is in progress
+    bool m_root;                               //!< Whether this buffer writes to the log file
+    std::unique_ptr<BinaryLogBuffer> m_nested; //!< Records logged while formatting an argument
+    /// Locked by the owning thread while it appends a record to a root buffer,
+    /// and by BinaryLog::Enable and BinaryLog::Disable to access the buffer
+    std::mutex m_mutex;
+
+  private:
+    /**
+     * Make room in the buffer for the current record.
+     * @param [in] size The number of bytes to append to the current record.
+     */
+    void MakeRoom(std::size_t size);
+};
+
+/**
+ * @ingroup logging
+ * Check whether a type is recorded by a dedicated operator of BinaryLogRecord.
+ * @tparam T \explicit The type.
+ */
+template <typename T>
+struct IsBinaryLogContainer : std::false_type
+{
+};
+
+/**
+ * @ingroup logging
+ * A Ptr is recorded as the pointer it holds.
+ * @tparam T \explicit The type of the object pointed to.
+ */
+template <typename T>
+struct IsBinaryLogContainer<Ptr<T>> : std::true_type
+{
+};
+
+/**
+ * @ingroup logging
+ * A vector is recorded as a list of parameters.
+ * @tparam T \explicit The type of the elements.
+ */
+template <typename T>
+struct IsBinaryLogContainer<std::vector<T>> : std::true_type
+{
+};
+
+/**
+ * @ingroup logging
+ * @brief Records the message of a logging macro with the binary backend.
+ *
+ * The arguments of the message are inserted with \c operator<< as in an
+ * output stream, and the record is complete when this object is destroyed.
+ * The arguments of a BinaryLog::FUNCTION call site are recorded as
+ * ParameterLogger formats them.
+ */
+class BinaryLogRecord
+{
+  public:
+    /// Tags of the recorded arguments
+    enum Tag : uint8_t
+    {
+        SIGNED = 'i',   //!< int64_t
+        UNSIGNED = 'u', //!< uint64_t
+        REAL = 'd',     //!< double
+        CHAR = 'c',     //!< char
+        BOOL = 'b',     //!< bool, as uint8_t
+        POINTER = 'p',  //!< pointer, as uint64_t
+        STRING = 's',   //!< uint32_t size followed by the characters
+        QUOTED = 'q',   //!< same as STRING, printed between quotes
+    };
+
+    /**
+     * Start a record.
+     * @param [in] log The LogComponent of the call site.
+     * @param [in] site The identifier of the call site.
+     * @param [in] kind The kind of the call site.
+     */
+    BinaryLogRecord(const LogComponent& log, uint32_t site, BinaryLog::Kind kind);
+    /** Destructor: complete the record. */
+    ~BinaryLogRecord();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    BinaryLogRecord(const BinaryLogRecord&) = delete;
+    BinaryLogRecord& operator=(const BinaryLogRecord&) = delete;
+
+    /**
+     * Record an argument of the message, as received: an argument formatted
+     * to a string is inserted in an output stream as a const or non-const,
+     * lvalue or rvalue reference, as it would be by the logging macros.
+     * @tparam T \deduced The type of the argument.
+     * @param [in] value The argument.
+     * @return This BinaryLogRecord, so it's chainable.
+     */
+    template <typename T>
+        requires(!IsBinaryLogContainer<std::remove_cvref_t<T>>::value)
+    BinaryLogRecord& operator<<(T&& value);
+
+    /**
+     * Record a vector of parameters, for BinaryLog::FUNCTION call sites.
+     * @tparam T \deduced The type of the elements.
+     * @param [in] vector The parameters.
+     * @return This BinaryLogRecord, so it's chainable.
+     */
+    template <typename T>
+    BinaryLogRecord& operator<<(const std::vector<T>& vector);
+
+    /**
+     * Record a Ptr as the pointer it holds, as its output operator prints it.
+     * @tparam T \deduced The type of the object pointed to.
+     * @param [in] p The Ptr.
+     * @return This BinaryLogRecord, so it's chainable.
+     */
+    template <typename T>
+    BinaryLogRecord& operator<<(const Ptr<T>& p)
+    {
+        return *this << PeekPointer(p);
+    }
+
+    /**
+     * Apply a manipulator, such as std::hex, to the following arguments.
+     * @param [in] manipulator The manipulator.
+     * @return This BinaryLogRecord, so it's chainable.
+     */
+    BinaryLogRecord& operator<<(std::ios_base& (*manipulator)(std::ios_base&));
+
+    /**
+     * Record the output of a manipulator, such as std::endl.
+     * @param [in] manipulator The manipulator.
+     * @return This BinaryLogRecord, so it's chainable.
+     */
+    BinaryLogRecord& operator<<(std::ostream& (*manipulator)(std::ostream&));
+
+  private:
+    /**
+     * Record a value.
+     * @tparam T \explicit The type of the value.
+     * @param [in] tag The tag of the value.
+     * @param [in] value The value.
+     */
+    template <typename T>
+    void PutValue(Tag tag, T value)
+    {
+        m_buffer.Put(&tag, 1);
+        m_buffer.Put(&value, sizeof(value));
+    }
+
+    /**
+     * Record a string.
+     * @param [in] tag The tag of the string.
+     * @param [in] data The characters.
+     * @param [in] size The number of characters.
+     */
+    void PutString(Tag tag, const char* data, std::size_t size);
+
+    /**
+     * Record an argument with its raw value, if possible.
+     * @tparam T \deduced The type of the argument.
+     * @param [in] value The argument.
+     * @return \c true if the argument was recorded.
+     */
+    template <typename T>
+    bool PutRaw(const T& value);
+
+    /**
+     * Record an argument formatted to a string.
+     * @tparam T \deduced The type of the argument.
+     * @param [in] value The argument.
+     */
+    template <typename T>
+    void PutText(T&& value);
+
+    /** Record the text formatted in BinaryLogBuffer::m_text */
+    void EndText();
+
+    BinaryLogBuffer& m_buffer; //!< Buffer of the logging thread
+    BinaryLog::Kind m_kind;    //!< Kind of the call site
+};
+
+template <typename T>
+bool
+BinaryLogRecord::PutRaw(const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        PutValue<uint8_t>(BOOL, value);
+    }
+    else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                       std::is_same_v<T, unsigned char>)
+    {
+        PutValue<char>(CHAR, value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> &&
+                       sizeof(T) <= sizeof(int64_t) && !std::is_same_v<T, wchar_t>)
+    {
+        PutValue<int64_t>(SIGNED, value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T> &&
+                       sizeof(T) <= sizeof(uint64_t) && !std::is_same_v<T, wchar_t> &&
+                       !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>)
+    {
+        PutValue<uint64_t>(UNSIGNED, value);
+    }
+    else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+    {
+        PutValue<double>(REAL, value);
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        PutString(STRING, value.data(), value.size());
+    }
+    else if constexpr (std::is_convertible_v<const T&, const char*> &&
+                       !std::is_same_v<T, std::nullptr_t>)
+    {
+        const char* string = value;
+        PutString(STRING, string, string == nullptr ? 0 : std::strlen(string));
+    }
+    else if constexpr (std::is_pointer_v<T> && std::is_object_v<std::remove_pointer_t<T>>)
+    {
+        PutValue<uint64_t>(POINTER, reinterpret_cast<uintptr_t>(value));
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+template <typename T>
+void
+BinaryLogRecord::PutText(T&& value)
+{
+    m_buffer.m_text << std::forward<T>(value);
+    EndText();
+}
+
+template <typename T>
+    requires(!IsBinaryLogContainer<std::remove_cvref_t<T>>::value)
+BinaryLogRecord&
+BinaryLogRecord::operator<<(T&& value)
+{
+    using U = std::remove_cvref_t<T>;
+
+    if (m_kind == BinaryLog::FUNCTION)
+    {
+        // as ParameterLogger
+        if constexpr (std::is_convertible_v<U, std::string>)
+        {
+            if constexpr (std::is_same_v<U, std::string>)
+            {
+                PutString(QUOTED, value.data(), value.size());
+            }
+            else
+            {
+                const std::string string = value;
+                PutString(QUOTED, string.data(), string.size());
+            }
+        }
+        else if constexpr (std::is_arithmetic_v<U>)
+        {
+            if (!PutRaw(+value))
+            {
+                PutText(+value);
+            }
+        }
+        else if constexpr (std::is_pointer_v<U> && std::is_object_v<std::remove_pointer_t<U>>)
+        {
+            PutRaw(value);
+        }
+        else
+        {
+            PutText(std::forward<T>(value));
+        }
+    }
+    else if (m_buffer.m_formatted || !PutRaw(value))
+    {
+        PutText(std::forward<T>(value));
+    }
+    return *this;
+}
+
+template <typename T>
+BinaryLogRecord&
+BinaryLogRecord::operator<<(const std::vector<T>& vector)
+{
+    if (m_kind == BinaryLog::FUNCTION)
+    {
+        for (const auto& i : vector)
+        {
+            *this << i;
+        }
+    }
+    else if constexpr (requires(std::ostream& os) { os << vector; })
+    {
+        PutText(vector);
+    }
+    return *this;
+}
+
+} // namespace ns3
+
+#endif /* NS3_BINARY_LOG_H */
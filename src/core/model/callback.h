@@ -19,6 +19,8 @@
 
 #include <functional>
 #include <memory>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -214,6 +216,119 @@ class CallbackComponent<T, false> : public CallbackComponentBase
 /// Vector of callback components
 typedef std::vector<std::shared_ptr<CallbackComponentBase>> CallbackComponentVector;
 
+/**
+ * @ingroup callbackimpl
+ * Callable object which invokes a function pointer or a pointer to member
+ * directly, with its bound arguments passed by const reference, so that
+ * invoking it neither goes through a second std::function nor copies the
+ * bound arguments.
+ *
+ * @tparam R The return type of the function.
+ * @tparam T The type of the function.
+ * @tparam BArgs The types of the bound arguments.
+ */
+template <typename R, typename T, typename... BArgs>
+class CallbackInvoker
+{
+  public:
+    /**
+     * Whether the function can be invoked with the bound arguments followed
+     * by arguments of the given types.
+     *
+     * @tparam UArgs The types of the arguments following the bound ones.
+     */
+    template <typename... UArgs>
+    static constexpr bool IsInvocable = std::is_invocable_r_v<R, T, const BArgs&..., UArgs...>;
+
+    /**
+     * @return \c true if some bound argument is passed by reference (see Pass())
+     */
+    static constexpr bool PassesReferences()
+    {
+        return (!std::is_same_v<decltype(Pass(std::declval<const BArgs&>())), BArgs> || ...);
+    }
+
+    /**
+     * Constructor
+     *
+     * @param [in] func The function
+     * @param [in] bargs The values of the bound arguments
+     */
+    CallbackInvoker(T func, const BArgs&... bargs)
+        : m_func(func),
+          m_bargs(bargs...)
+    {
+    }
+
+    /**
+     * Invoke the function.
+     *
+     * @tparam UArgs \deduced The types of the arguments following the bound ones.
+     * @param [in] uargs The arguments following the bound ones.
+     * @return The value returned by the function.
+     */
+    template <typename... UArgs>
+    R operator()(UArgs&&... uargs) const
+    {
+        return std::apply(
+            [this, &uargs...](const BArgs&... bargs) -> R {
+                if constexpr (std::is_void_v<R>)
+                {
+                    std::invoke(m_func, Pass(bargs)..., std::forward<UArgs>(uargs)...);
+                }
+                else
+                {
+                    return std::invoke(m_func, Pass(bargs)..., std::forward<UArgs>(uargs)...);
+                }
+            },
+            m_bargs);
+    }
+
+    /**
+     * Bind one more argument.
+     *
+     * @tparam A \deduced The type of the argument to bind.
+     * @param [in] value The value of the argument to bind.
+     * @return The invoker of the function with the additional bound argument.
+     */
+    template <typename A>
+    CallbackInvoker<R, T, BArgs..., A> Bind(const A& value) const
+    {
+        return std::apply(
+            [this, &value](const BArgs&... bargs) {
+                return CallbackInvoker<R, T, BArgs..., A>(m_func, bargs..., value);
+            },
+            m_bargs);
+    }
+
+  private:
+    /**
+     * Pass a bound argument to the function: a trivially copyable argument
+     * no larger than two pointers (e.g., the object pointer of a member
+     * function) is passed as a copy, which costs no more than a reference,
+     * any other argument is passed by const reference.
+     *
+     * @tparam A \deduced The type of the bound argument.
+     * @param [in] arg The bound argument.
+     * @return The copy of or the reference to the bound argument.
+     */
+    template <typename A>
+    static decltype(auto) Pass(const A& arg)
+    {
+        if constexpr (std::is_trivially_copyable_v<A> && sizeof(A) <= 2 * sizeof(void*))
+        {
+            return A(arg);
+        }
+        else
+        {
+            return (arg);
+        }
+    }
+
+    T m_func;                     //!< the function
+    std::tuple<BArgs...> m_bargs; //!< the bound arguments
+};
+
 /**
  * @ingroup callbackimpl
  * CallbackImpl class with varying numbers of argument types
@@ -233,8 +348,59 @@ class CallbackImpl : public CallbackImplBase
      */
     CallbackImpl(std::function<R(UArgs...)> func, const CallbackComponentVector& components)
         : m_func(func),
-          m_components(components)
+          m_components(components),
+          m_bindFirst(nullptr),
+          m_keepAlive(false)
+    {
+    }
+
+    /**
+     * Create the implementation of a callback whose callable object is a
+     * CallbackInvoker. Binding the first argument of such a callback yields
+     * another CallbackInvoker, rather than a function nested in another one.
+     *
+     * @tparam Invoker \deduced The type of the CallbackInvoker.
+     * @param invoker the CallbackInvoker
+     * @param components the callback components (callable object and bound arguments)
+     * @return The callback implementation.
+     */
+    template <typename Invoker>
+    static Ptr<CallbackImpl> CreateDirect(const Invoker& invoker,
+                                          const CallbackComponentVector& components)
+    {
+        auto impl = Create<CallbackImpl>(invoker, components);
+        impl->m_keepAlive = Invoker::PassesReferences();
+        if constexpr (sizeof...(UArgs) > 0)
+        {
+            if constexpr (IsFirstBindable<Invoker, UArgs...>())
+            {
+                impl->m_bindFirst = &BindFirst<Invoker, UArgs...>;
+            }
+        }
+        return impl;
+    }
+
+    /**
+     * Bind the first argument of this callback without nesting its function,
+     * if it was created by CreateDirect().
+     *
+     * @param value the value of the first argument, whose type is the decayed
+     *        type of the first argument
+     * @return The implementation of the bound callback, or null if the first
+     *         argument cannot be bound directly.
+     */
+    Ptr<CallbackImplBase> DoBindFirst(const void* value) const
     {
+        return m_bindFirst ? m_bindFirst(*this, value) : nullptr;
+    }
+
+    /**
+     * @return \c true if the first argument of this callback can be bound
+     *         directly by DoBindFirst()
+     */
+    bool CanBindFirst() const
+    {
+        return m_bindFirst != nullptr;
     }
 
     /**
@@ -263,6 +429,13 @@ class CallbackImpl : public CallbackImplBase
      */
     R operator()(UArgs... uargs) const
     {
+        if (m_keepAlive)
+        {
+            // the bound arguments are passed by reference: keep them alive even
+            // if the last reference to this callback is released by the call
+            Ptr<const CallbackImpl> self(this);
+            return m_func(uargs...);
+        }
         return m_func(uargs...);
     }
 
@@ -328,11 +501,98 @@ class CallbackImpl : public CallbackImplBase
     }
 
   private:
+    /**
+     * Check whether the values of a type can be compared, as required to store
+     * them in a comparable CallbackComponent. The elements of pairs and
+     * containers are checked too, since the equality operators of the standard
+     * containers are declared even if their elements cannot be compared.
+     *
+     * @tparam A The type.
+     * @return \c true if the values of the type can be compared.
+     */
+    template <typename A>
+    static constexpr bool IsComparable()
+    {
+        if constexpr (!requires(const A& a) { a != a; })
+        {
+            return false;
+        }
+        else if constexpr (requires {
+                               typename A::first_type;
+                               typename A::second_type;
+                           })
+        {
+            return IsComparable<std::remove_cv_t<typename A::first_type>>() &&
+                   IsComparable<std::remove_cv_t<typename A::second_type>>();
+        }
+        else if constexpr (requires {
+                               typename A::value_type;
+                               typename A::const_iterator;
+                           })
+        {
+            return IsComparable<std::remove_cv_t<typename A::value_type>>();
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    /**
+     * Check whether the first argument of a callback whose callable object
+     * is a CallbackInvoker can be bound directly.
+     *
+     * @tparam Invoker The type of the CallbackInvoker.
+     * @tparam First The type of the first argument.
+     * @tparam Rest The types of the other arguments.
+     * @return \c true if the first argument can be bound directly.
+     */
+    template <typename Invoker, typename First, typename... Rest>
+    static constexpr bool IsFirstBindable()
+    {
+        // the bound value is stored in a (comparable) CallbackComponent, too
+        using A = std::decay_t<First>;
+        if constexpr (std::is_copy_constructible_v<A> && IsComparable<A>())
+        {
+            return Invoker::template IsInvocable<const A&, Rest...>;
+        }
+        return false;
+    }
+
+    /**
+     * Bind the first argument of a callback whose callable object is a
+     * CallbackInvoker.
+     *
+     * @tparam Invoker The type of the CallbackInvoker.
+     * @tparam First The type of the first argument.
+     * @tparam Rest The types of the other arguments.
+     * @param impl the implementation of the callback
+     * @param value the value of the first argument
+     * @return The implementation of the bound callback.
+     */
+    template <typename Invoker, typename First, typename... Rest>
+    static Ptr<CallbackImplBase> BindFirst(const CallbackImpl& impl, const void* value)
+    {
+        const auto& arg = *static_cast<const std::decay_t<First>*>(value);
+        CallbackComponentVector components(impl.m_components);
+        components.push_back(std::make_shared<CallbackComponent<std::decay_t<First>>>(arg));
+        return CallbackImpl<R, Rest...>::CreateDirect(
+            impl.m_func.template target<Invoker>()->Bind(arg),
+            components);
+    }
+
     /// Stores the callable object associated with this callback (as a lambda)
     std::function<R(UArgs...)> m_func;
 
     /// Stores the original callable object and the bound arguments, if any
     std::vector<std::shared_ptr<CallbackComponentBase>> m_components;
+
+    /// Binds the first argument if the callable object is a CallbackInvoker, or null
+    Ptr<CallbackImplBase> (*m_bindFirst)(const CallbackImpl& impl, const void* value);
+
+    /// Whether this callback is kept alive while invoked, because it passes
+    /// references to its bound arguments
+    bool m_keepAlive;
 };
 
 /**
@@ -448,6 +708,17 @@ class Callback : public CallbackBase
     template <typename... BArgs>
     Callback(const Callback<R, BArgs..., UArgs...>& cb, BArgs... bargs)
     {
+        if constexpr (sizeof...(BArgs) == 1)
+        {
+            // bind the first argument of a directly invoked function, if possible
+            if (cb.DoPeekImpl()->CanBindFirst())
+            {
+                const std::tuple_element_t<0, std::tuple<std::decay_t<BArgs>...>> value(bargs...);
+                m_impl = cb.DoPeekImpl()->DoBindFirst(&value);
+                return;
+            }
+        }
+
         auto f = cb.DoPeekImpl()->GetFunction();
 
         CallbackComponentVector components(cb.DoPeekImpl()->GetComponents());
@@ -480,9 +751,6 @@ class Callback : public CallbackBase
                                int> = 0>
     Callback(T func, BArgs... bargs)
     {
-        // store the function in a std::function object
-        std::function<R(BArgs..., UArgs...)> f(func);
-
         // The original function is comparable if it is a function pointer or
         // a pointer to a member function or a pointer to a member data.
         constexpr bool isComp =
@@ -492,11 +760,28 @@ class Callback : public CallbackBase
             {std::make_shared<CallbackComponent<T, isComp>>(func),
              std::make_shared<CallbackComponent<std::decay_t<BArgs>>>(bargs)...});
 
-        m_impl = Create<CallbackImpl<R, UArgs...>>(
-            [f, bargs...](auto&&... uargs) -> R {
-                return f(bargs..., std::forward<decltype(uargs)>(uargs)...);
-            },
-            components);
+        // Function pointers and pointers to members that can be called with the
+        // stored bound arguments (e.g., the object pointer of a member function)
+        // are invoked directly, rather than through a second std::function, and
+        // the bound arguments are passed by const reference, so that invoking the
+        // callback only costs a single indirect call and copies no argument.
+        using Invoker = CallbackInvoker<R, T, std::decay_t<BArgs>...>;
+
+        if constexpr (isComp && Invoker::template IsInvocable<UArgs...>)
+        {
+            m_impl = CallbackImpl<R, UArgs...>::CreateDirect(Invoker(func, bargs...), components);
+        }
+        else
+        {
+            // store the function in a std::function object
+            std::function<R(BArgs..., UArgs...)> f(func);
+
+            m_impl = Create<CallbackImpl<R, UArgs...>>(
+                [f, bargs...](auto&&... uargs) -> R {
+                    return f(bargs..., std::forward<decltype(uargs)>(uargs)...);
+                },
+                components);
+        }
     }
 
   private:
@@ -516,6 +801,22 @@ class Callback : public CallbackBase
     {
         Callback<R, std::tuple_element_t<sizeof...(bargs) + INDEX, std::tuple<UArgs...>>...> cb;
 
+        if constexpr (sizeof...(BoundArgs) == 1)
+        {
+            // bind the first argument of a directly invoked function, if possible
+            using First = std::decay_t<std::tuple_element_t<0, std::tuple<UArgs...>>>;
+
+            if constexpr (std::is_constructible_v<First, BoundArgs&&...>)
+            {
+                if (DoPeekImpl()->CanBindFirst())
+                {
+                    const First value(std::forward<BoundArgs>(bargs)...);
+                    cb.m_impl = DoPeekImpl()->DoBindFirst(&value);
+                    return cb;
+                }
+            }
+        }
+
         const auto f = DoPeekImpl()->GetFunction();
 
         CallbackComponentVector components(DoPeekImpl()->GetComponents());
@@ -543,8 +844,16 @@ class Callback : public CallbackBase
     auto Bind(BoundArgs&&... bargs)
     {
         static_assert(sizeof...(UArgs) > 0);
-        return BindImpl(std::make_index_sequence<sizeof...(UArgs) - sizeof...(BoundArgs)>{},
-                        std::forward<BoundArgs>(bargs)...);
+        if constexpr (sizeof...(BoundArgs) == 0)
+        {
+            // nothing to bind: share the implementation instead of wrapping it
+            return *this;
+        }
+        else
+        {
+            return BindImpl(std::make_index_sequence<sizeof...(UArgs) - sizeof...(BoundArgs)>{},
+                            std::forward<BoundArgs>(bargs)...);
+        }
     }
 
     /**
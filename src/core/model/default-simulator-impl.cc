@@ -9,9 +9,11 @@
 #include "default-simulator-impl.h"
 
 #include "assert.h"
+#include "event-profiler.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
 
 #include <cmath>
 
@@ -37,7 +39,15 @@ DefaultSimulatorImpl::GetTypeId()
     static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
                             .SetParent<SimulatorImpl>()
                             .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+                            .AddConstructor<DefaultSimulatorImpl>()
+                            .AddAttribute("ProfileFile",
+                                          "The name of the file to which a profile of the wall "
+                                          "clock time spent in the events, per callable, module "
+                                          "and context, is written at Simulator::Destroy(). "
+                                          "Empty to disable the profiling.",
+                                          StringValue(""),
+                                          MakeStringAccessor(&DefaultSimulatorImpl::SetProfileFile),
+                                          MakeStringChecker());
     return tid;
 }
 
@@ -79,6 +89,10 @@ void
 DefaultSimulatorImpl::Destroy()
 {
     NS_LOG_FUNCTION(this);
+    if (m_profiler)
+    {
+        m_profiler->Write();
+    }
     while (!m_destroyEvents.empty())
     {
         Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
@@ -108,6 +122,13 @@ DefaultSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
     m_events = scheduler;
 }
 
+void
+DefaultSimulatorImpl::SetProfileFile(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    m_profiler = filename.empty() ? nullptr : std::make_unique<EventProfiler>(filename);
+}
+
 // System ID for non-distributed simulation is always zero
 uint32_t
 DefaultSimulatorImpl::GetSystemId() const
@@ -130,7 +151,14 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profiler)
+    {
+        m_profiler->Invoke(next.impl, m_currentContext);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -12,6 +12,7 @@
 #include "simulator-impl.h"
 
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -26,6 +27,7 @@ namespace ns3
 
 // Forward
 class Scheduler;
+class EventProfiler;
 
 /**
  * @ingroup simulator
@@ -74,6 +76,11 @@ class DefaultSimulatorImpl : public SimulatorImpl
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
+    /**
+     * Enable or disable the profiling of the events.
+     * @param filename The name of the profile file, empty to disable profiling.
+     */
+    void SetProfileFile(const std::string& filename);
 
     /** Wrap an event with its execution context. */
     struct EventWithContext
@@ -125,6 +132,9 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
+
+    /** The event profiler, if profiling is enabled. */
+    std::unique_ptr<EventProfiler> m_profiler;
 };
 
 } // namespace ns3
@@ -56,4 +56,10 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+const void*
+EventImpl::GetCallable() const
+{
+    return nullptr;
+}
+
 } // namespace ns3
@@ -55,6 +55,13 @@ class EventImpl : public SimpleRefCount<EventImpl>
      * Checked by the simulation engine before calling Invoke().
      */
     bool IsCancelled();
+    /**
+     * Get the address of the function or member function invoked by the event,
+     * which names the event in the reports of the EventProfiler.
+     *
+     * @returns The address of the function invoked, or null if it is not known.
+     */
+    virtual const void* GetCallable() const;
 
   protected:
     /**
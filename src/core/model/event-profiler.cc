@@ -0,0 +1,222 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "event-profiler.h"
+
+#include "abort.h"
+#include "demangle.h"
+#include "event-impl.h"
+#include "log.h"
+#include "simulator.h"
+#include "type-id.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#endif
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("EventProfiler");
+
+EventProfiler* EventProfiler::g_current = nullptr;
+
+std::size_t
+EventProfiler::KeyHash::operator()(const Key& key) const
+{
+    const auto& [type, callable, context] = key;
+    return std::hash<const std::type_info*>()(type) ^ (std::hash<const void*>()(callable) << 1) ^
+           (std::hash<uint32_t>()(context) << 2);
+}
+
+EventProfiler::EventProfiler(const std::string& filename)
+    : m_filename(filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+}
+
+template <typename F>
+void
+EventProfiler::Account(const Key& key, F function)
+{
+    auto& counters = m_counters[key];
+    const auto enclosing = m_nested;
+    m_nested = 0;
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const uint64_t elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    counters.events++;
+    counters.nanoseconds += elapsed - std::min(m_nested, elapsed);
+    m_nested = enclosing + elapsed;
+}
+
+void
+EventProfiler::Invoke(EventImpl* event, uint32_t context)
+{
+    const auto previous = g_current;
+    g_current = this;
+    m_context = context;
+    Account({&typeid(*event), event->GetCallable(), context}, [event]() { event->Invoke(); });
+    g_current = previous;
+}
+
+void
+EventProfiler::InvokeNested(const std::type_info& type,
+                            const void* callable,
+                            const std::function<void()>& function)
+{
+    Account({&type, callable, m_context}, function);
+}
+
+EventProfiler*
+EventProfiler::GetCurrent()
+{
+    return g_current;
+}
+
+void
+EventProfiler::Write()
+{
+    NS_LOG_FUNCTION(this);
+    // the lines of the reports, sorted and merged by module, callable and context,
+    // since a type may have several type_info objects, one per shared library
+    std::map<std::string, Counters> lines;
+    std::map<std::pair<const std::type_info*, const void*>, std::string> stacks;
+    for (const auto& [key, counters] : m_counters)
+    {
+        const auto& [type, address, contextId] = key;
+        auto it = stacks.find({type, address});
+        if (it == stacks.end())
+        {
+            auto callable = address ? GetSymbolName(address) : std::string();
+            if (callable.empty())
+            {
+                callable = GetCallableName(Demangle(type->name()));
+            }
+            it = stacks.emplace(std::make_pair(type, address),
+                                GetModuleName(callable) + ";" + callable)
+                     .first;
+        }
+        const auto context = (contextId == Simulator::NO_CONTEXT)
+                                 ? std::string("no context")
+                                 : "node " + std::to_string(contextId);
+        auto& line = lines[it->second + ";" + context];
+        line.events += counters.events;
+        line.nanoseconds += counters.nanoseconds;
+    }
+    m_counters.clear();
+
+    std::ofstream times(m_filename);
+    std::ofstream events(m_filename + ".events");
+    NS_ABORT_MSG_UNLESS(times.is_open() && events.is_open(),
+                        "Cannot open the event profile file " << m_filename);
+    for (const auto& [stack, counters] : lines)
+    {
+        times << stack << " " << counters.nanoseconds << "\n";
+        events << stack << " " << counters.events << "\n";
+    }
+}
+
+std::string
+EventProfiler::GetCallableName(const std::string& type)
+{
+    // the implementations created by MakeEvent() are local classes of MakeEvent(),
+    // whose first parameter is the member function, function or lambda invoked
+    const std::string makeEvent = "MakeEvent<";
+    auto pos = type.find(makeEvent);
+    if (pos == std::string::npos)
+    {
+        return type;
+    }
+    // skip the template arguments
+    pos += makeEvent.size();
+    for (int depth = 1; pos < type.size() && depth > 0; pos++)
+    {
+        depth += (type[pos] == '<') - (type[pos] == '>');
+    }
+    if (pos >= type.size() || type[pos] != '(')
+    {
+        return type;
+    }
+    // the first function parameter, up to a comma or parenthesis closing the list
+    const auto begin = ++pos;
+    for (int depth = 0; pos < type.size(); pos++)
+    {
+        const char c = type[pos];
+        if (depth == 0 && (c == ',' || c == ')'))
+        {
+            return type.substr(begin, pos - begin);
+        }
+        depth += (c == '(' || c == '<' || c == '{') - (c == ')' || c == '>' || c == '}');
+    }
+    return type;
+}
+
+std::string
+EventProfiler::GetSymbolName(const void* address)
+{
+#if defined(__linux__) || defined(__APPLE__)
+    Dl_info info;
+    // only the symbol starting at the address names the function, the nearest
+    // symbol below it may be unrelated
+    if (dladdr(address, &info) != 0 && info.dli_sname != nullptr && info.dli_saddr == address)
+    {
+        // a virtual function invoked through a base class may resolve to a thunk
+        // adjusting the object pointer before calling the function
+        auto name = Demangle(info.dli_sname);
+        for (const std::string thunk : {"non-virtual thunk to ", "virtual thunk to "})
+        {
+            if (name.starts_with(thunk))
+            {
+                return name.substr(thunk.size());
+            }
+        }
+        return name;
+    }
+#endif
+    return "";
+}
+
+std::string
+EventProfiler::GetModuleName(const std::string& callable)
+{
+    std::string className;
+    if (auto end = callable.find("::*)"); end != std::string::npos)
+    {
+        // a member function, such as void (ns3::Txop::*)(unsigned char)
+        auto begin = callable.rfind('(', end);
+        className = callable.substr(begin + 1, end - begin - 1);
+    }
+    else
+    {
+        // a lambda defined in a member function, such as ns3::Txop::Foo()::{lambda()#1}
+        auto name = callable.substr(0, callable.find('('));
+        if (auto end = name.rfind("::"); end != std::string::npos)
+        {
+            className = name.substr(0, end);
+        }
+    }
+    TypeId tid;
+    if (!className.empty() && TypeId::LookupByNameFailSafe(className, &tid) &&
+        !tid.GetGroupName().empty())
+    {
+        return tid.GetGroupName();
+    }
+    return "unknown";
+}
+
+} // namespace ns3
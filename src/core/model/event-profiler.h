@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <unordered_map>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+class EventImpl;
+
+/**
+ * @ingroup simulator
+ *
+ * @brief Wall clock time and event count accounting of the events executed
+ * by a simulator.
+ *
+ * Each event is attributed to the callable it invokes, to the context in
+ * which it executes (by convention, the id of the node) and to the module
+ * of the callable.  The callable is named after the symbol of the function
+ * or member function invoked, such as
+ * <tt>ns3::PhyEntity::EndPreambleDetectionPeriod(ns3::Ptr<ns3::Event>)</tt>,
+ * which is looked up with \c dladdr() from the address returned by
+ * EventImpl::GetCallable().  When it has no symbol, for instance for a
+ * lambda or a function local to a translation unit, the callable is
+ * identified by the type of the event implementation created by
+ * MakeEvent(): the member function type, such as
+ * <tt>void (ns3::Txop::*)(unsigned char)</tt>, the function type or the
+ * lambda.  The module is the group name of the TypeId of the class of the
+ * callable, when it has one.
+ *
+ * The callables invoked within an event, such as the timers expired by a
+ * TimerWheel, can be attributed to themselves with InvokeNested(), in which
+ * case their wall clock time is not accounted to the enclosing event.
+ *
+ * The profiler is enabled by setting the attribute
+ * ns3::DefaultSimulatorImpl::ProfileFile, for instance from the command line:
+ * @verbatim
+   $ ./ns3 run "my-program --ns3::DefaultSimulatorImpl::ProfileFile=profile.folded" \endverbatim
+ *
+ * At Simulator::Destroy(), two reports are written in the "folded stacks"
+ * format read by flame graph tools, with one line per module, callable and
+ * context, such as:
+ * @verbatim
+   Wifi;ns3::ChannelAccessManager::AccessTimeout();node 12 1534200 \endverbatim
+ * The weight of the lines of the file named after the attribute is the wall
+ * clock time spent in the events, in nanoseconds, and the weight of the lines
+ * of the file with the additional \c .events extension is the number of events.
+ * A flame graph is then drawn with, for instance:
+ * @verbatim
+   $ flamegraph.pl profile.folded > profile.svg \endverbatim
+ */
+class EventProfiler
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] filename The name of the file to which the report is written.
+     */
+    EventProfiler(const std::string& filename);
+
+    /**
+     * Invoke an event and account for the wall clock time it takes.
+     * @param [in] event The event.
+     * @param [in] context The context of the event.
+     */
+    void Invoke(EventImpl* event, uint32_t context);
+
+    /**
+     * Invoke a callable within the event being invoked and account for the
+     * wall clock time it takes, which is not accounted to the event.
+     * @param [in] type The type of the callable.
+     * @param [in] callable The address of the function invoked, or null if unknown.
+     * @param [in] function The function invoking the callable.
+     */
+    void InvokeNested(const std::type_info& type,
+                      const void* callable,
+                      const std::function<void()>& function);
+
+    /**
+     * @return The profiler invoking the current event, or null if the current
+     *         event is not profiled.
+     */
+    static EventProfiler* GetCurrent();
+
+    /** Write the reports and reset the accounting. */
+    void Write();
+
+    /**
+     * Get the name of the callable invoked by an event.
+     * @param [in] type The demangled name of the type of the event implementation.
+     * @return The name of the callable, or the type if it was not created by MakeEvent().
+     */
+    static std::string GetCallableName(const std::string& type);
+
+    /**
+     * Get the module of a callable.
+     * @param [in] callable The name of the callable.
+     * @return The group name of the TypeId of the class of the callable, or
+     *         "unknown" if it has none.
+     */
+    static std::string GetModuleName(const std::string& callable);
+
+    /**
+     * Get the name of the function at an address.
+     * @param [in] address The address of the function.
+     * @return The demangled name of the symbol of the function, or an empty
+     *         string if the address is not the one of an exported symbol.
+     */
+    static std::string GetSymbolName(const void* address);
+
+  private:
+    /**
+     * The event accounting key: the type of the event implementation, the address
+     * of the function it invokes and the context.
+     */
+    using Key = std::tuple<const std::type_info*, const void*, uint32_t>;
+
+    /** Hash function for the accounting keys. */
+    struct KeyHash
+    {
+        /**
+         * @param [in] key The key.
+         * @return The hash of the key.
+         */
+        std::size_t operator()(const Key& key) const;
+    };
+
+    /** The accounting of a key. */
+    struct Counters
+    {
+        uint64_t events{0};      //!< Number of events
+        uint64_t nanoseconds{0}; //!< Wall clock time spent in the events
+    };
+
+    /**
+     * Invoke a function and account for the wall clock time it takes, minus the
+     * time of the callables invoked within it with InvokeNested().
+     * @param [in] key The accounting key.
+     * @param [in] function The function.
+     */
+    template <typename F>
+    void Account(const Key& key, F function);
+
+    std::string m_filename;                                //!< The name of the report file
+    std::unordered_map<Key, Counters, KeyHash> m_counters; //!< The accounting
+    uint32_t m_context{0};                                 //!< Context of the current event
+    uint64_t m_nested{0}; //!< Wall clock time of the callables nested in the current one
+
+    static EventProfiler* g_current; //!< The profiler invoking the current event
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
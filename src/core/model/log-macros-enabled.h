@@ -148,6 +148,23 @@
 #define NS_LOG_CONDITION
 #endif
 
+/**
+ * @ingroup logging
+ * Record a message with the binary backend.
+ *
+ * The call site is registered the first time it records a message.
+ *
+ * @param [in] kind The BinaryLog::Kind of the logging macro.
+ * @param [in] level The log level of the message.
+ * @param [in] msg The message, inserted in a BinaryLogRecord.
+ */
+#define NS_LOG_BINARY(kind, level, msg)                                                            \
+    {                                                                                              \
+        static const uint32_t binaryLogSite =                                                      \
+            ns3::BinaryLog::RegisterSite(g_log, level, kind, __FUNCTION__, __FILE__, __LINE__);    \
+        ns3::BinaryLogRecord(g_log, binaryLogSite, kind) msg;                                      \
+    }
+
 /**
  * @ingroup logging
  *
@@ -173,6 +190,11 @@
     {                                                                                              \
         if (g_log.IsEnabled(level))                                                                \
         {                                                                                          \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY(ns3::BinaryLog::MESSAGE, level, << msg);                             \
+                break;                                                                             \
+            }                                                                                      \
             NS_LOG_APPEND_TIME_PREFIX;                                                             \
             NS_LOG_APPEND_NODE_PREFIX;                                                             \
             NS_LOG_APPEND_CONTEXT;                                                                 \
@@ -198,6 +220,11 @@
     {                                                                                              \
         if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
         {                                                                                          \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY(ns3::BinaryLog::FUNCTION, ns3::LOG_FUNCTION, );                      \
+                break;                                                                             \
+            }                                                                                      \
             NS_LOG_APPEND_TIME_PREFIX;                                                             \
             NS_LOG_APPEND_NODE_PREFIX;                                                             \
             NS_LOG_APPEND_CONTEXT;                                                                 \
@@ -232,6 +259,11 @@
     {                                                                                              \
         if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
         {                                                                                          \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY(ns3::BinaryLog::FUNCTION, ns3::LOG_FUNCTION, << parameters);         \
+                break;                                                                             \
+            }                                                                                      \
             NS_LOG_APPEND_TIME_PREFIX;                                                             \
             NS_LOG_APPEND_NODE_PREFIX;                                                             \
             NS_LOG_APPEND_CONTEXT;                                                                 \
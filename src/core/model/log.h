@@ -9,6 +9,7 @@
 #ifndef NS3_LOG_H
 #define NS3_LOG_H
 
+#include "binary-log.h"
 #include "log-macros-disabled.h"
 #include "log-macros-enabled.h"
 #include "node-printer.h"
@@ -412,6 +413,18 @@ class LogComponent
 
 }; // class LogComponent
 
+inline bool
+LogComponent::IsEnabled(const LogLevel level) const
+{
+    return level & m_levels;
+}
+
+inline bool
+LogComponent::IsNoneEnabled() const
+{
+    return m_levels == 0;
+}
+
 /**
  * Get the LogComponent registered with the given name.
  *
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "make-event.h"
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @file
+ * @ingroup events
+ * ns3::internal::GetMemberFunctionAddress implementation.
+ */
+
+namespace ns3
+{
+
+namespace internal
+{
+
+const void*
+GetMemberFunctionAddress(const void* object, const void* function, std::size_t size)
+{
+#if defined(__GNUC__)
+    // GCC and clang follow the Itanium C++ ABI, in which a member function pointer is
+    // the address of the function, or the offset of the function in the virtual table
+    // for a virtual function, and the adjustment of the object pointer.
+    struct MemberFunctionPointer
+    {
+        uintptr_t ptr; //!< Address, or offset in the virtual table
+        ptrdiff_t adj; //!< Adjustment of the object pointer
+    } pmf;
+
+    if (size != sizeof(pmf))
+    {
+        return nullptr;
+    }
+    std::memcpy(&pmf, function, sizeof(pmf));
+#if defined(__arm__) || defined(__aarch64__)
+    // the ARM C++ ABI flags the virtual functions in the adjustment, as the
+    // addresses of the functions may be odd
+    const bool isVirtual = (pmf.adj & 1) != 0;
+    const ptrdiff_t adj = pmf.adj >> 1;
+    const uintptr_t offset = pmf.ptr;
+#else
+    const bool isVirtual = (pmf.ptr & 1) != 0;
+    const ptrdiff_t adj = pmf.adj;
+    const uintptr_t offset = pmf.ptr - 1;
+#endif
+    if (!isVirtual)
+    {
+        return reinterpret_cast<const void*>(pmf.ptr);
+    }
+    if (object == nullptr)
+    {
+        return nullptr;
+    }
+    const char* vtable;
+    std::memcpy(&vtable, static_cast<const char*>(object) + adj, sizeof(vtable));
+    const void* address;
+    std::memcpy(&address, vtable + offset, sizeof(address));
+    return address;
+#else
+    return nullptr;
+#endif
+}
+
+} // namespace internal
+
+} // namespace ns3
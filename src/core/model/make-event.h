@@ -10,7 +10,9 @@
 
 #include "warnings.h"
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <tuple>
 #include <type_traits>
 
@@ -126,6 +128,99 @@ struct EventMemberImplObjTraits<T*>
     }
 };
 
+/**
+ * @ingroup events
+ * Helper to get the class of a member pointer.
+ *
+ * This is the generic template declaration (with empty body).
+ *
+ * @tparam T \explicit The member pointer type.
+ */
+template <typename T>
+struct MemberPointerClass;
+
+/**
+ * @ingroup events
+ * Helper to get the class of a member pointer.
+ *
+ * @tparam T \explicit The type of the member.
+ * @tparam C \explicit The class.
+ */
+template <typename T, typename C>
+struct MemberPointerClass<T C::*>
+{
+    using Type = C; //!< The class of the member
+};
+
+/**
+ * @ingroup events
+ * Get the address of the function designated by a member function pointer
+ * when it is invoked on an object.  The function of a virtual member function
+ * is looked up in the virtual table of the object.
+ *
+ * @param [in] object The address of the object, converted to the class of the
+ *             member function, or null if unknown.
+ * @param [in] function The address of the member function pointer.
+ * @param [in] size The size of the member function pointer.
+ * @return The address of the function, or null if it cannot be found, as with
+ *         compilers which do not follow the Itanium C++ ABI.
+ */
+const void* GetMemberFunctionAddress(const void* object, const void* function, std::size_t size);
+
+/**
+ * @ingroup events
+ * Get the address of the function invoked by a callable, used to name the
+ * callable in the event profiles.
+ *
+ * @tparam FUNC \deduced The type of the callable.
+ * @tparam Ts \deduced The types of the arguments.
+ * @param [in] f The member function, function or function object.
+ * @param [in] args The object on which the member function is invoked, if any,
+ *             and the arguments.
+ * @return The address of the member function or function invoked, or null for
+ *         function objects and when it cannot be found.
+ */
+template <typename FUNC, typename... Ts>
+const void*
+GetCallableAddress(const FUNC& f, const Ts&... args)
+{
+    if constexpr (std::is_member_function_pointer_v<FUNC> && sizeof...(Ts) > 0)
+    {
+        using Class = typename MemberPointerClass<FUNC>::Type;
+        const auto& obj = std::get<0>(std::forward_as_tuple(args...));
+        using OBJ = std::remove_cvref_t<decltype(obj)>;
+        const Class* object = nullptr;
+        if constexpr (std::is_convertible_v<const OBJ&, const Class*>)
+        {
+            object = obj;
+        }
+        else if constexpr (requires {
+                               static_cast<bool>(obj);
+                               { std::addressof(*obj) } -> std::convertible_to<const Class*>;
+                           })
+        {
+            // a smart pointer
+            if (obj)
+            {
+                object = std::addressof(*obj);
+            }
+        }
+        else if constexpr (std::is_convertible_v<const OBJ*, const Class*>)
+        {
+            object = std::addressof(obj);
+        }
+        return GetMemberFunctionAddress(object, &f, sizeof(f));
+    }
+    else if constexpr (std::is_pointer_v<FUNC> && std::is_function_v<std::remove_pointer_t<FUNC>>)
+    {
+        return reinterpret_cast<const void*>(f);
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
 } // namespace internal
 
 template <typename MEM, typename OBJ, typename... Ts>
@@ -138,8 +233,15 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
         EventMemberImpl() = delete;
 
         EventMemberImpl(OBJ obj, MEM function, Ts... args)
-            : m_function(std::bind(function, obj, args...))
+            : m_obj(obj),
+              m_function(function),
+              m_arguments(args...)
+        {
+        }
+
+        const void* GetCallable() const override
         {
+            return internal::GetCallableAddress(m_function, m_obj);
         }
 
       protected:
@@ -150,10 +252,13 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
       private:
         void Notify() override
         {
-            m_function();
+            std::apply([this](auto&... args) { std::invoke(m_function, m_obj, args...); },
+                       m_arguments);
         }
 
-        std::function<void()> m_function;
+        OBJ m_obj;
+        MEM m_function;
+        std::tuple<Ts...> m_arguments;
     }* ev = new EventMemberImpl(obj, mem_ptr, args...);
 
     return ev;
@@ -172,6 +277,11 @@ MakeEvent(void (*f)(Us...), Ts... args)
         {
         }
 
+        const void* GetCallable() const override
+        {
+            return internal::GetCallableAddress(m_function);
+        }
+
       protected:
         ~EventFunctionImpl() override
         {
@@ -202,6 +312,11 @@ MakeEvent(T function)
         {
         }
 
+        const void* GetCallable() const override
+        {
+            return internal::GetCallableAddress(m_function);
+        }
+
         ~EventImplFunctional() override
         {
         }
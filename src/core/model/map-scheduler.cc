@@ -52,9 +52,19 @@ void
 MapScheduler::Insert(const Event& ev)
 {
     NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
-    std::pair<EventMapI, bool> result;
-    result = m_list.insert(std::make_pair(ev.key, ev.impl));
-    NS_ASSERT(result.second);
+    if (m_unused.empty())
+    {
+        std::pair<EventMapI, bool> result;
+        result = m_list.insert(std::make_pair(ev.key, ev.impl));
+        NS_ASSERT(result.second);
+        return;
+    }
+    auto node = std::move(m_unused.back());
+    m_unused.pop_back();
+    node.key() = ev.key;
+    node.mapped() = ev.impl;
+    auto result = m_list.insert(std::move(node));
+    NS_ASSERT(result.inserted);
 }
 
 bool
@@ -87,7 +97,7 @@ MapScheduler::RemoveNext()
     Event ev;
     ev.impl = i->second;
     ev.key = i->first;
-    m_list.erase(i);
+    m_unused.push_back(m_list.extract(i));
     NS_LOG_DEBUG("@" << this << ": " << ev.impl << ", " << ev.key.m_ts << ", " << ev.key.m_uid);
     return ev;
 }
@@ -98,7 +108,7 @@ MapScheduler::Remove(const Event& ev)
     NS_LOG_FUNCTION(this << ev.impl << ev.key.m_ts << ev.key.m_uid);
     auto i = m_list.find(ev.key);
     NS_ASSERT(i->second == ev.impl);
-    m_list.erase(i);
+    m_unused.push_back(m_list.extract(i));
 }
 
 } // namespace ns3
@@ -14,6 +14,7 @@
 #include <map>
 #include <stdint.h>
 #include <utility>
+#include <vector>
 
 /**
  * @file
@@ -29,7 +30,9 @@ namespace ns3
  * @brief a std::map event scheduler
  *
  * This class implements the an event scheduler using an std::map
- * data structure.
+ * data structure. The nodes of the removed events are kept to hold the
+ * next inserted events, hence the scheduler only allocates memory when
+ * more events are pending than ever before.
  *
  * @par Time Complexity
  *
@@ -80,6 +83,8 @@ class MapScheduler : public Scheduler
 
     /** The event list. */
     EventMap m_list;
+    /** Nodes of the removed events, reused by the next inserted events. */
+    std::vector<EventMap::node_type> m_unused;
 };
 
 } // namespace ns3
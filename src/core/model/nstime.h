@@ -516,6 +516,18 @@ class Time
             return Time();
         }
 
+        // Optimization: if value is a whole number of the current unit, don't cast to
+        // int64x64_t.  See EXACT_LIMIT for why the result is the same.
+        const Information* info = PeekInformation(unit);
+        if (info->fromMul && info->isValid)
+        {
+            const double v = value * static_cast<double>(info->factor);
+            if (std::fabs(v) < EXACT_LIMIT && v == static_cast<double>(static_cast<int64_t>(v)))
+            {
+                return Time(static_cast<int64_t>(v));
+            }
+        }
+
         return From(int64x64_t(value), unit);
     }
 
@@ -591,6 +603,26 @@ class Time
             return 0;
         }
 
+        // Optimization: if the result is a whole number, don't cast from int64x64_t.
+        // See EXACT_LIMIT for why the result is the same.
+        const Information* info = PeekInformation(unit);
+        if (info->toMul && info->isValid)
+        {
+            if (std::fabs(static_cast<double>(m_data)) * static_cast<double>(info->factor) <
+                EXACT_LIMIT)
+            {
+                return static_cast<double>(m_data * info->factor);
+            }
+        }
+        else if (info->isValid && m_data % info->factor == 0)
+        {
+            const int64_t v = m_data / info->factor;
+            if (std::fabs(static_cast<double>(v)) < EXACT_LIMIT)
+            {
+                return static_cast<double>(v);
+            }
+        }
+
         return To(unit).GetDouble();
     }
 
@@ -654,6 +686,21 @@ class Time
     typedef void (*TracedCallback)(Time value);
 
   private:
+    /**
+     * Bound of the whole numbers converted by FromDouble and ToDouble
+     * without int64x64_t.
+     *
+     * Below this bound, a double holds whole numbers exactly and the error
+     * of the product of a double by a factor is at most 1/8.  When this
+     * product is a whole number, the int64x64_t implementations, whose
+     * error is below 1/4, round to it.  Likewise, the int64x64_t
+     * implementations convert exactly a Time multiplied by a factor, and
+     * a Time divided by a factor to a whole number below this bound.  The
+     * results of the integer conversions are therefore identical to those
+     * of the int64x64_t conversions.
+     */
+    static constexpr double EXACT_LIMIT = 2251799813685248.0; // 2^51
+
     /** How to convert between other units and the current unit. */
     struct Information
     {
@@ -97,10 +97,10 @@ Object::Object()
     : m_tid(Object::GetTypeId()),
       m_disposed(false),
       m_initialized(false),
-      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates))),
-      m_getObjectCount(0)
+      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates)))
 {
     NS_LOG_FUNCTION(this);
+    m_aggregates->lookup = nullptr;
     m_aggregates->n = 1;
     m_aggregates->buffer[0] = this;
 }
@@ -121,6 +121,9 @@ Object::~Object()
             m_aggregates->n--;
         }
     }
+    // the lookup table may refer to this object, so it must be rebuilt
+    std::free(m_aggregates->lookup);
+    m_aggregates->lookup = nullptr;
     // finally, if all objects have been removed from the list,
     // delete the aggregate list
     if (m_aggregates->n == 0)
@@ -135,9 +138,9 @@ Object::Object(const Object& o)
     : m_tid(o.m_tid),
       m_disposed(false),
       m_initialized(false),
-      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates))),
-      m_getObjectCount(0)
+      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates)))
 {
+    m_aggregates->lookup = nullptr;
     m_aggregates->n = 1;
     m_aggregates->buffer[0] = this;
 }
@@ -149,6 +152,63 @@ Object::Construct(const AttributeConstructionList& attributes)
     ConstructSelf(attributes);
 }
 
+Object::AggregateLookup*
+Object::BuildLookup(const Aggregates* aggregates)
+{
+    NS_LOG_FUNCTION(aggregates);
+    // size the table for a load factor of at most one half
+    const TypeId objectTid = Object::GetTypeId();
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < aggregates->n; i++)
+    {
+        for (TypeId cur = aggregates->buffer[i]->GetInstanceTypeId(); cur != objectTid;
+             cur = cur.GetParent())
+        {
+            n++;
+        }
+    }
+    uint32_t size = 8;
+    while (size < 2 * (n + 1))
+    {
+        size *= 2;
+    }
+    auto lookup = (AggregateLookup*)std::malloc(sizeof(AggregateLookup) +
+                                                (size - 1) * sizeof(AggregateLookup::Entry));
+    lookup->mask = size - 1;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        lookup->entries[i].object = nullptr;
+    }
+
+    // insert the parent chain of each aggregate, Object included; when several
+    // aggregates derive from the same TypeId, the first one is kept.
+    for (uint32_t i = 0; i < aggregates->n; i++)
+    {
+        Object* current = aggregates->buffer[i];
+        TypeId cur = current->GetInstanceTypeId();
+        while (true)
+        {
+            const uint16_t uid = cur.GetUid();
+            uint32_t j = uid & lookup->mask;
+            while (lookup->entries[j].object != nullptr && lookup->entries[j].uid != uid)
+            {
+                j = (j + 1) & lookup->mask;
+            }
+            if (lookup->entries[j].object == nullptr)
+            {
+                lookup->entries[j].uid = uid;
+                lookup->entries[j].object = current;
+            }
+            if (cur == objectTid)
+            {
+                break;
+            }
+            cur = cur.GetParent();
+        }
+    }
+    return lookup;
+}
+
 Ptr<Object>
 Object::DoGetObject(TypeId tid) const
 {
@@ -156,34 +216,23 @@ Object::DoGetObject(TypeId tid) const
     NS_ASSERT(CheckLoose());
 
     // First check if the object is in the normal aggregates.
-    uint32_t n = m_aggregates->n;
-    TypeId objectTid = Object::GetTypeId();
-    for (uint32_t i = 0; i < n; i++)
+    if (m_aggregates->lookup == nullptr)
     {
-        Object* current = m_aggregates->buffer[i];
-        TypeId cur = current->GetInstanceTypeId();
-        while (cur != tid && cur != objectTid)
-        {
-            cur = cur.GetParent();
-        }
-        if (cur == tid)
+        m_aggregates->lookup = BuildLookup(m_aggregates);
+    }
+    const AggregateLookup* lookup = m_aggregates->lookup;
+    const uint16_t uid = tid.GetUid();
+    for (uint32_t i = uid & lookup->mask; lookup->entries[i].object != nullptr;
+         i = (i + 1) & lookup->mask)
+    {
+        if (lookup->entries[i].uid == uid)
         {
-            // This is an attempt to 'cache' the result of this lookup.
-            // the idea is that if we perform a lookup for a TypeId on this object,
-            // we are likely to perform the same lookup later so, we make sure
-            // that the aggregate array is sorted by the number of accesses
-            // to each object.
-
-            // first, increment the access count
-            current->m_getObjectCount++;
-            // then, update the sort
-            UpdateSortedArray(m_aggregates, i);
-            // finally, return the match
-            return const_cast<Object*>(current);
+            return lookup->entries[i].object;
         }
     }
 
     // Next check if it's a unidirectional aggregate
+    const TypeId objectTid = Object::GetTypeId();
     for (auto& uniItem : m_unidirectionalAggregates)
     {
         TypeId cur = uniItem->GetInstanceTypeId();
@@ -280,20 +329,6 @@ restart:
     }
 }
 
-void
-Object::UpdateSortedArray(Aggregates* aggregates, uint32_t j) const
-{
-    NS_LOG_FUNCTION(this << aggregates << j);
-    while (j > 0 &&
-           aggregates->buffer[j]->m_getObjectCount > aggregates->buffer[j - 1]->m_getObjectCount)
-    {
-        Object* tmp = aggregates->buffer[j - 1];
-        aggregates->buffer[j - 1] = aggregates->buffer[j];
-        aggregates->buffer[j] = tmp;
-        j--;
-    }
-}
-
 void
 Object::AggregateObject(Ptr<Object> o)
 {
@@ -307,6 +342,7 @@ Object::AggregateObject(Ptr<Object> o)
     // first create the new aggregate buffer.
     uint32_t total = m_aggregates->n + other->m_aggregates->n;
     auto aggregates = (Aggregates*)std::malloc(sizeof(Aggregates) + (total - 1) * sizeof(Object*));
+    aggregates->lookup = nullptr;
     aggregates->n = total;
 
     // copy our buffer to the new buffer
@@ -327,7 +363,6 @@ Object::AggregateObject(Ptr<Object> o)
                            << other->GetInstanceTypeId() << " on objects of type "
                            << GetInstanceTypeId());
         }
-        UpdateSortedArray(aggregates, m_aggregates->n + i);
     }
 
     // keep track of the old aggregate buffers for the iteration
@@ -360,7 +395,9 @@ Object::AggregateObject(Ptr<Object> o)
     }
 
     // Now that we are done with them, we can free our old aggregate buffers
+    std::free(a->lookup);
     std::free(a);
+    std::free(b->lookup);
     std::free(b);
 }
 
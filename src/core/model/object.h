@@ -360,6 +360,30 @@ class Object : public SimpleRefCount<Object, ObjectBase, ObjectDeleter>
 
     /**@}*/
 
+    /**
+     * Lookup table mapping a TypeId to the first Object of a list of
+     * aggregates whose TypeId is, or derives from, that TypeId.
+     *
+     * The table is an open-addressing hash table indexed by TypeId uid,
+     * which holds an entry for every TypeId in the parent chain of every
+     * aggregated Object. Like Aggregates, it is allocated as a single chunk
+     * of memory holding \c mask + 1 entries.
+     */
+    struct AggregateLookup
+    {
+        /** An entry of the table. */
+        struct Entry
+        {
+            uint16_t uid;   //!< The uid of the TypeId
+            Object* object; //!< The matching Object, or \c nullptr if the entry is empty
+        };
+
+        /** The number of entries minus one, the number of entries being a power of two. */
+        uint32_t mask;
+        /** The array of entries. */
+        Entry entries[1];
+    };
+
     /**
      * The list of Objects aggregated to this one.
      *
@@ -374,12 +398,24 @@ class Object : public SimpleRefCount<Object, ObjectBase, ObjectDeleter>
      */
     struct Aggregates
     {
+        /**
+         * The lookup table of the aggregates, built on the first lookup
+         * and discarded when the aggregates change.
+         */
+        AggregateLookup* lookup;
         /** The number of entries in \c buffer. */
         uint32_t n;
         /** The array of Objects. */
         Object* buffer[1];
     };
 
+    /**
+     * Build the lookup table of a list of aggregates.
+     *
+     * @param [in] aggregates The list of aggregated Objects.
+     * @return The lookup table, to be released with std::free.
+     */
+    static AggregateLookup* BuildLookup(const Aggregates* aggregates);
     /**
      * Find an Object of TypeId tid in the aggregates of this Object.
      *
@@ -427,13 +463,6 @@ class Object : public SimpleRefCount<Object, ObjectBase, ObjectDeleter>
      */
     void Construct(const AttributeConstructionList& attributes);
 
-    /**
-     * Keep the list of aggregates in most-recently-used order
-     *
-     * @param [in,out] aggregates The list of aggregated Objects.
-     * @param [in] i The most recently used entry in the list.
-     */
-    void UpdateSortedArray(Aggregates* aggregates, uint32_t i) const;
     /**
      * Attempt to delete this Object.
      *
@@ -475,15 +504,6 @@ class Object : public SimpleRefCount<Object, ObjectBase, ObjectDeleter>
      * Aggregation would create an issue.
      */
     std::vector<Ptr<Object>> m_unidirectionalAggregates;
-
-    /**
-     * The number of times the Object was accessed with a
-     * call to GetObject().
-     *
-     * This integer is used to implement a heuristic to sort
-     * the array of aggregates in most-frequently accessed order.
-     */
-    uint32_t m_getObjectCount;
 };
 
 template <typename T>
@@ -510,19 +530,35 @@ template <typename T>
 Ptr<T>
 Object::GetObject() const
 {
-    // This is an optimization: if the cast works (which is likely),
-    // things will be pretty fast.
+    // The lookup by TypeId takes constant time.  If T does not register its
+    // own TypeId, T::GetTypeId () is the TypeId of a base class of T and the
+    // aggregate found may not be a T, hence the cast is checked.
+    Ptr<Object> found = DoGetObject(T::GetTypeId());
+    if (found)
+    {
+        T* result = dynamic_cast<T*>(PeekPointer(found));
+        if (result != nullptr)
+        {
+            return Ptr<T>(result);
+        }
+        // another aggregate with the same TypeId may be a T
+        for (uint32_t i = 0; i < m_aggregates->n; i++)
+        {
+            result = dynamic_cast<T*>(m_aggregates->buffer[i]);
+            if (result != nullptr)
+            {
+                return Ptr<T>(result);
+            }
+        }
+        return nullptr;
+    }
+    // If the lookup does not work, the object may not have been created
+    // with its own TypeId, hence we try a cast of the first aggregate.
     T* result = dynamic_cast<T*>(m_aggregates->buffer[0]);
     if (result != nullptr)
     {
         return Ptr<T>(result);
     }
-    // if the cast does not work, we try to do a full type check.
-    Ptr<Object> found = DoGetObject(T::GetTypeId());
-    if (found)
-    {
-        return Ptr<T>(static_cast<T*>(PeekPointer(found)));
-    }
     return nullptr;
 }
 
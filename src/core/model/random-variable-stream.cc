@@ -100,6 +100,15 @@ RandomVariableStream::GetInteger()
     return value;
 }
 
+void
+RandomVariableStream::GetValues(double* values, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        values[i] = GetValue();
+    }
+}
+
 void
 RandomVariableStream::SetStream(int64_t stream)
 {
@@ -218,6 +227,23 @@ UniformRandomVariable::GetInteger()
     return v;
 }
 
+void
+UniformRandomVariable::GetValues(double* values, std::size_t n)
+{
+    Peek()->RandU01(values, n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double v = m_min + values[i] * (m_max - m_min);
+        if (IsAntithetic())
+        {
+            v = m_min + (m_max - v);
+        }
+        values[i] = v;
+    }
+    NS_LOG_DEBUG(n << " values, stream: " << GetStream() << " min: " << m_min
+                   << " max: " << m_max);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(ConstantRandomVariable);
 
 TypeId
@@ -19,6 +19,7 @@
 #include "object.h"
 #include "type-id.h"
 
+#include <cstddef>
 #include <map>
 #include <stdint.h>
 
@@ -143,6 +144,17 @@ class RandomVariableStream : public Object
     // The base implementation returns `(uint32_t)GetValue()`
     virtual uint32_t GetInteger();
 
+    /**
+     * @brief Get the next random values drawn from the distribution,
+     * the same as \pname{n} calls of GetValue().
+     *
+     * The base implementation calls GetValue().
+     *
+     * @param [out] values The array of \pname{n} values to fill.
+     * @param [in] n The number of values.
+     */
+    virtual void GetValues(double* values, std::size_t n);
+
   protected:
     /**
      * @brief Get the pointer to the underlying RngStream.
@@ -273,6 +285,12 @@ class UniformRandomVariable : public RandomVariableStream
      */
     uint32_t GetInteger() override;
 
+    /**
+     * @copydoc RandomVariableStream::GetValues()
+     * The randoms of the underlying RngStream are generated at once.
+     */
+    void GetValues(double* values, std::size_t n) override;
+
   private:
     /** The lower bound on values that can be returned by this RNG stream. */
     double m_min;
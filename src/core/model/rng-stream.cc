@@ -13,6 +13,7 @@
 #include "fatal-error.h"
 #include "log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 
@@ -326,42 +327,67 @@ namespace ns3
 
 using namespace MRG32k3a;
 
-double
-RngStream::RandU01()
+void
+RngStream::Generate(double* values, std::size_t n)
 {
-    int32_t k;
-    double p1;
-    double p2;
-    double u;
-
-    /* Component 1 */
-    p1 = a12 * m_currentState[1] - a13n * m_currentState[0];
-    k = static_cast<int32_t>(p1 / m1);
-    p1 -= k * m1;
-    if (p1 < 0.0)
-    {
-        p1 += m1;
-    }
-    m_currentState[0] = m_currentState[1];
-    m_currentState[1] = m_currentState[2];
-    m_currentState[2] = p1;
-
-    /* Component 2 */
-    p2 = a21 * m_currentState[5] - a23n * m_currentState[3];
-    k = static_cast<int32_t>(p2 / m2);
-    p2 -= k * m2;
-    if (p2 < 0.0)
+    // The products fit in 53 bits, so the double form of the recurrences by
+    // L'Ecuyer computes the same exact remainders as this integer form.
+    constexpr int64_t im1 = 4294967087;
+    constexpr int64_t im2 = 4294944443;
+    constexpr int64_t ia12 = 1403580;
+    constexpr int64_t ia13n = 810728;
+    constexpr int64_t ia21 = 527612;
+    constexpr int64_t ia23n = 1370589;
+
+    auto s10 = static_cast<int64_t>(m_currentState[0]);
+    auto s11 = static_cast<int64_t>(m_currentState[1]);
+    auto s12 = static_cast<int64_t>(m_currentState[2]);
+    auto s20 = static_cast<int64_t>(m_currentState[3]);
+    auto s21 = static_cast<int64_t>(m_currentState[4]);
+    auto s22 = static_cast<int64_t>(m_currentState[5]);
+
+    for (std::size_t i = 0; i < n; ++i)
     {
-        p2 += m2;
+        /* Component 1 */
+        int64_t p1 = (ia12 * s11 - ia13n * s10) % im1;
+        if (p1 < 0)
+        {
+            p1 += im1;
+        }
+        s10 = s11;
+        s11 = s12;
+        s12 = p1;
+
+        /* Component 2 */
+        int64_t p2 = (ia21 * s22 - ia23n * s20) % im2;
+        if (p2 < 0)
+        {
+            p2 += im2;
+        }
+        s20 = s21;
+        s21 = s22;
+        s22 = p2;
+
+        /* Combination */
+        values[i] = ((p1 > p2) ? static_cast<double>(p1 - p2) * MRG32k3a::norm
+                               : static_cast<double>(p1 - p2 + im1) * MRG32k3a::norm);
     }
-    m_currentState[3] = m_currentState[4];
-    m_currentState[4] = m_currentState[5];
-    m_currentState[5] = p2;
 
-    /* Combination */
-    u = ((p1 > p2) ? (p1 - p2) * MRG32k3a::norm : (p1 - p2 + m1) * MRG32k3a::norm);
+    m_currentState[0] = s10;
+    m_currentState[1] = s11;
+    m_currentState[2] = s12;
+    m_currentState[3] = s20;
+    m_currentState[4] = s21;
+    m_currentState[5] = s22;
+}
 
-    return u;
+void
+RngStream::RandU01(double* values, std::size_t n)
+{
+    std::size_t buffered = std::min(n, BATCH_SIZE - m_next);
+    std::copy_n(m_buffer + m_next, buffered, values);
+    m_next += buffered;
+    Generate(values + buffered, n - buffered);
 }
 
 RngStream::RngStream(uint32_t seedNumber, uint64_t stream, uint64_t substream)
@@ -376,6 +402,7 @@ RngStream::RngStream(uint32_t seedNumber, uint64_t stream, uint64_t substream)
     }
     AdvanceNthBy(stream, 127, m_currentState);
     AdvanceNthBy(substream, 76, m_currentState);
+    m_next = BATCH_SIZE;
 }
 
 RngStream::RngStream(const RngStream& r)
@@ -384,6 +411,8 @@ RngStream::RngStream(const RngStream& r)
     {
         m_currentState[i] = r.m_currentState[i];
     }
+    m_next = r.m_next;
+    std::copy_n(r.m_buffer + m_next, BATCH_SIZE - m_next, m_buffer + m_next);
 }
 
 void
@@ -7,6 +7,7 @@
 
 #ifndef RNGSTREAM_H
 #define RNGSTREAM_H
+#include <cstddef>
 #include <stdint.h>
 #include <string>
 
@@ -34,6 +35,11 @@ namespace ns3
  * holds a static instance of this class.  The details of this
  * class are explained in:
  * http://www.iro.umontreal.ca/~lecuyer/myftp/papers/streams00.pdf
+ *
+ * The randoms are generated in batches of BATCH_SIZE, with the integer
+ * form of the recurrences, and RandU01() returns them one at a time
+ * from a buffer.  The sequence of randoms is the same as when they were
+ * generated one at a time.
  */
 class RngStream
 {
@@ -58,9 +64,38 @@ class RngStream
      *
      * @returns The next random.
      */
-    double RandU01();
+    inline double RandU01()
+    {
+        if (m_next == BATCH_SIZE)
+        {
+            Generate(m_buffer, BATCH_SIZE);
+            m_next = 0;
+        }
+        return m_buffer[m_next++];
+    }
+
+    /**
+     * Generate the next \pname{n} random numbers for this stream, the
+     * same as \pname{n} calls of RandU01().
+     *
+     * @param [out] values The array of \pname{n} randoms to fill.
+     * @param [in] n The number of randoms.
+     */
+    void RandU01(double* values, std::size_t n);
+
+    /** The number of randoms generated at once. */
+    static constexpr std::size_t BATCH_SIZE = 16;
 
   private:
+    /**
+     * Advance the state vector of the RNG by \pname{n} randoms, which are
+     * stored in \pname{values}, without using the buffer.
+     *
+     * @param [out] values The array of \pname{n} randoms to fill.
+     * @param [in] n The number of randoms.
+     */
+    void Generate(double* values, std::size_t n);
+
     /**
      * Advance \pname{state} of the RNG by leaps and bounds.
      *
@@ -70,8 +105,12 @@ class RngStream
      */
     void AdvanceNthBy(uint64_t nth, int by, double state[6]);
 
-    /** The RNG state vector. */
+    /** The RNG state vector, after the randoms of the buffer. */
     double m_currentState[6];
+    /** The buffer of randoms generated in advance. */
+    double m_buffer[BATCH_SIZE];
+    /** The index of the next random of the buffer. */
+    std::size_t m_next;
 };
 
 } // namespace ns3
@@ -0,0 +1,104 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "simulation-checkpoint.h"
+
+#include "abort.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <map>
+
+#ifndef __WIN32__
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::SimulationCheckpoint implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SimulationCheckpoint");
+
+std::optional<uint32_t>
+SimulationCheckpoint::Branch(uint32_t nBranches, uint32_t maxConcurrent)
+{
+    NS_LOG_FUNCTION(this << nBranches << maxConcurrent);
+#ifdef __WIN32__
+    NS_FATAL_ERROR("SimulationCheckpoint requires fork(), which is not available");
+    return std::nullopt;
+#else
+    m_nFailed = 0;
+    if (maxConcurrent == 0)
+    {
+        maxConcurrent = nBranches;
+    }
+
+    // the buffered output would otherwise be written by every branch
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    std::map<pid_t, uint32_t> running; // the branch of each running child process
+    auto waitBranch = [this, &running]() {
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "waitpid failed: " << std::strerror(errno));
+            return;
+        }
+        auto it = running.find(pid);
+        if (it == running.end())
+        {
+            return; // not a branch
+        }
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            NS_LOG_WARN("Branch " << it->second << " failed with status " << status);
+            m_nFailed++;
+        }
+        running.erase(it);
+    };
+
+    for (uint32_t branch = 0; branch < nBranches; branch++)
+    {
+        while (running.size() >= maxConcurrent)
+        {
+            waitBranch();
+        }
+        pid_t pid = fork();
+        NS_ABORT_MSG_IF(pid < 0, "fork failed: " << std::strerror(errno));
+        if (pid == 0)
+        {
+            NS_LOG_INFO("Branch " << branch << " from " << Simulator::Now().As(Time::S));
+            return branch;
+        }
+        running.emplace(pid, branch);
+    }
+    while (!running.empty())
+    {
+        waitBranch();
+    }
+    return std::nullopt;
+#endif
+}
+
+uint32_t
+SimulationCheckpoint::GetNFailed() const
+{
+    return m_nFailed;
+}
+
+} // namespace ns3
@@ -0,0 +1,87 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef SIMULATION_CHECKPOINT_H
+#define SIMULATION_CHECKPOINT_H
+
+#include <cstdint>
+#include <optional>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::SimulationCheckpoint declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ *
+ * @brief Branch a simulation into several variants from the state it reached.
+ *
+ * A family of runs which share a warm-up period, such as the convergence of
+ * the routing protocols before the traffic starts, can compute the warm-up
+ * once: the simulation is run up to the end of the warm-up, then branched
+ * into copies of the process, which continue from the state reached, with
+ * the same scheduled events, nodes, protocol state, mobility and positions
+ * of the random number streams, and which each apply a different variant
+ * before running to the end:
+ *
+ * @code
+ *   Simulator::Stop(Seconds(50));
+ *   Simulator::Run();
+ *
+ *   SimulationCheckpoint checkpoint;
+ *   auto branch = checkpoint.Branch(nVariants);
+ *   if (!branch)
+ *   {
+ *       // all the branches completed
+ *       Simulator::Destroy();
+ *       return checkpoint.GetNFailed() == 0 ? 0 : 1;
+ *   }
+ *   // set up the variant *branch, for instance with RngSeedManager::SetRun()
+ *   // and the traffic applications
+ *   Simulator::Stop(Seconds(150));
+ *   Simulator::Run();
+ * @endcode
+ *
+ * The checkpoint is a copy-on-write copy of the memory of the process, made
+ * with fork(), rather than a file: the events of the simulator are arbitrary
+ * callables, which cannot be serialized.  As a consequence, it is only
+ * available on POSIX systems, the simulation must not run other threads at
+ * the time of the checkpoint, and the files opened before the checkpoint are
+ * shared by all the branches, which should therefore open their own output
+ * files.  The standard output streams are flushed before branching.
+ */
+class SimulationCheckpoint
+{
+  public:
+    /**
+     * Branch the simulation into copies of the process, at most
+     * \p maxConcurrent of which run at the same time.
+     *
+     * @param [in] nBranches The number of branches.
+     * @param [in] maxConcurrent The maximum number of branches running at the
+     *             same time, or 0 for no limit.
+     * @return The index of the branch, from 0 to \p nBranches - 1, in the copies
+     *         of the process, or nothing in the process which branched, once all
+     *         the branches completed.
+     */
+    std::optional<uint32_t> Branch(uint32_t nBranches, uint32_t maxConcurrent = 0);
+
+    /**
+     * @return The number of branches of the last call to Branch() which did not
+     *         exit successfully.
+     */
+    uint32_t GetNFailed() const;
+
+  private:
+    uint32_t m_nFailed{0}; //!< Number of failed branches
+};
+
+} // namespace ns3
+
+#endif /* SIMULATION_CHECKPOINT_H */
@@ -0,0 +1,398 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "timer-wheel.h"
+
+#include "assert.h"
+#include "event-profiler.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <bit>
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::TimerWheel timer class implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimerWheel");
+
+TimerWheel::Id::Id()
+    : m_index(0),
+      m_generation(0)
+{
+}
+
+TimerWheel::Id::Id(uint32_t index, uint32_t generation)
+    : m_index(index),
+      m_generation(generation)
+{
+}
+
+TimerWheel::TimerWheel()
+    : TimerWheel(TimeStep(1))
+{
+}
+
+TimerWheel::TimerWheel(const Time& tick)
+    : m_tick(tick.GetTimeStep()),
+      m_now(0),
+      m_sequence(0),
+      m_nTimers(0),
+      m_free(NONE),
+      m_eventTick(0)
+{
+    NS_LOG_FUNCTION(this << tick);
+    NS_ASSERT_MSG(m_tick > 0, "The tick of a TimerWheel must be strictly positive");
+    m_lists.fill(NONE);
+    m_occupied.fill(0);
+}
+
+TimerWheel::~TimerWheel()
+{
+    NS_LOG_FUNCTION(this);
+    m_event.Cancel();
+}
+
+TimerWheel::Id
+TimerWheel::Schedule(const Time& delay, std::function<void()> function)
+{
+    const auto& type = function.target_type();
+    return DoSchedule(delay, std::move(function), type, nullptr);
+}
+
+TimerWheel::Id
+TimerWheel::DoSchedule(const Time& delay,
+                       std::function<void()> function,
+                       const std::type_info& type,
+                       const void* callable)
+{
+    NS_LOG_FUNCTION(this << delay);
+    uint32_t index = m_free;
+    if (index == NONE)
+    {
+        index = m_nodes.size();
+        m_nodes.push_back({{}, nullptr, nullptr, 0, 0, NONE, NONE, 1, FREE});
+    }
+    else
+    {
+        m_free = m_nodes[index].next;
+    }
+    m_nodes[index].function = std::move(function);
+    m_nodes[index].type = &type;
+    m_nodes[index].callable = callable;
+    m_nTimers++;
+    Arm(index, delay);
+    return Id(index, m_nodes[index].generation);
+}
+
+bool
+TimerWheel::Reschedule(const Id& id, const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay);
+    const uint32_t index = Find(id);
+    if (index == NONE)
+    {
+        return false;
+    }
+    if (m_nodes[index].list != EXPIRED)
+    {
+        Unlink(index);
+    }
+    Arm(index, delay);
+    return true;
+}
+
+void
+TimerWheel::Cancel(const Id& id)
+{
+    NS_LOG_FUNCTION(this);
+    const uint32_t index = Find(id);
+    if (index == NONE)
+    {
+        return;
+    }
+    if (m_nodes[index].list != EXPIRED)
+    {
+        Unlink(index);
+    }
+    Release(index);
+    if (m_nTimers == 0)
+    {
+        m_event.Cancel();
+    }
+}
+
+void
+TimerWheel::CancelAll()
+{
+    NS_LOG_FUNCTION(this);
+    for (uint32_t index = 0; index < m_nodes.size(); index++)
+    {
+        if (m_nodes[index].list != FREE)
+        {
+            if (m_nodes[index].list != EXPIRED)
+            {
+                Unlink(index);
+            }
+            Release(index);
+        }
+    }
+    m_event.Cancel();
+}
+
+bool
+TimerWheel::IsRunning(const Id& id) const
+{
+    return Find(id) != NONE;
+}
+
+Time
+TimerWheel::GetDelayLeft(const Id& id) const
+{
+    const uint32_t index = Find(id);
+    if (index == NONE)
+    {
+        return Time(0);
+    }
+    const Time expiry = TimeStep(m_nodes[index].expiry * m_tick);
+    return std::max(expiry - Simulator::Now(), Time(0));
+}
+
+std::size_t
+TimerWheel::GetNTimers() const
+{
+    return m_nTimers;
+}
+
+uint32_t
+TimerWheel::Find(const Id& id) const
+{
+    if (id.m_index >= m_nodes.size())
+    {
+        return NONE;
+    }
+    const Node& node = m_nodes[id.m_index];
+    if (node.generation != id.m_generation || node.list == FREE)
+    {
+        return NONE;
+    }
+    return id.m_index;
+}
+
+void
+TimerWheel::Arm(uint32_t index, const Time& delay)
+{
+    NS_ASSERT_MSG(!delay.IsStrictlyNegative(), "A timer cannot expire in the past");
+    // round the expiration time up to a tick, so that no timer expires early
+    const int64_t expiry = (Simulator::Now() + delay).GetTimeStep();
+    m_nodes[index].expiry = expiry / m_tick + (expiry % m_tick != 0);
+    m_nodes[index].sequence = m_sequence++;
+    Link(index);
+    if (!m_event.IsPending() || m_nodes[index].expiry < m_eventTick)
+    {
+        ScheduleNext();
+    }
+}
+
+void
+TimerWheel::Link(uint32_t index)
+{
+    Node& node = m_nodes[index];
+    if (node.expiry <= m_now)
+    {
+        node.list = DUE_LIST;
+    }
+    else
+    {
+        // the level of the most significant group of bits in which the expiration
+        // tick differs from the current one, so that the slot of the timer is
+        // reached before any slot of that level wraps around
+        const uint32_t level = (std::bit_width(node.expiry ^ m_now) - 1) / LEVEL_BITS;
+        const uint32_t slot = (node.expiry >> (level * LEVEL_BITS)) & (SLOTS - 1);
+        node.list = level * SLOTS + slot;
+        m_occupied[level] |= uint64_t{1} << slot;
+    }
+    node.prev = NONE;
+    node.next = m_lists[node.list];
+    if (node.next != NONE)
+    {
+        m_nodes[node.next].prev = index;
+    }
+    m_lists[node.list] = index;
+}
+
+void
+TimerWheel::Unlink(uint32_t index)
+{
+    Node& node = m_nodes[index];
+    if (node.prev != NONE)
+    {
+        m_nodes[node.prev].next = node.next;
+    }
+    else
+    {
+        m_lists[node.list] = node.next;
+        if (node.next == NONE && node.list != DUE_LIST)
+        {
+            m_occupied[node.list / SLOTS] &= ~(uint64_t{1} << (node.list % SLOTS));
+        }
+    }
+    if (node.next != NONE)
+    {
+        m_nodes[node.next].prev = node.prev;
+    }
+}
+
+void
+TimerWheel::Release(uint32_t index)
+{
+    Node& node = m_nodes[index];
+    node.function = nullptr;
+    node.list = FREE;
+    // a generation of 0 would match the default-constructed Id
+    node.generation = (node.generation == UINT32_MAX) ? 1 : node.generation + 1;
+    node.next = m_free;
+    m_free = index;
+    m_nTimers--;
+}
+
+void
+TimerWheel::Advance(uint64_t now, std::vector<uint32_t>& expired)
+{
+    // the timers linked into a level share the bits above that level with the
+    // current tick, and are in a later slot of the level than the current tick
+    std::vector<uint32_t> moved;
+    for (uint32_t index = m_lists[DUE_LIST]; index != NONE; index = m_nodes[index].next)
+    {
+        moved.push_back(index);
+    }
+    m_lists[DUE_LIST] = NONE;
+    for (uint32_t level = 0; level < LEVELS; level++)
+    {
+        const uint32_t shift = level * LEVEL_BITS;
+        const uint32_t parentShift = shift + LEVEL_BITS;
+        uint64_t reached = m_occupied[level];
+        if (parentShift >= 64 || (m_now >> parentShift) == (now >> parentShift))
+        {
+            const uint32_t slot = (now >> shift) & (SLOTS - 1);
+            reached &= (slot == SLOTS - 1) ? ~uint64_t{0} : (uint64_t{2} << slot) - 1;
+        }
+        m_occupied[level] &= ~reached;
+        while (reached != 0)
+        {
+            const uint32_t list = level * SLOTS + std::countr_zero(reached);
+            reached &= reached - 1;
+            for (uint32_t index = m_lists[list]; index != NONE; index = m_nodes[index].next)
+            {
+                moved.push_back(index);
+            }
+            m_lists[list] = NONE;
+        }
+    }
+    m_now = now;
+    for (auto index : moved)
+    {
+        if (m_nodes[index].expiry <= now)
+        {
+            m_nodes[index].list = EXPIRED;
+            expired.push_back(index);
+        }
+        else
+        {
+            Link(index);
+        }
+    }
+}
+
+bool
+TimerWheel::GetNextTick(uint64_t& tick) const
+{
+    if (m_lists[DUE_LIST] != NONE)
+    {
+        tick = m_now;
+        return true;
+    }
+    // the slots of a level are reached before those of the higher levels
+    for (uint32_t level = 0; level < LEVELS; level++)
+    {
+        if (m_occupied[level] != 0)
+        {
+            const uint32_t shift = level * LEVEL_BITS;
+            const uint32_t parentShift = shift + LEVEL_BITS;
+            const uint64_t parent = (parentShift >= 64) ? 0 : (m_now >> parentShift) << parentShift;
+            tick = parent | (static_cast<uint64_t>(std::countr_zero(m_occupied[level])) << shift);
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+TimerWheel::ScheduleNext()
+{
+    m_event.Cancel();
+    uint64_t tick;
+    if (!GetNextTick(tick))
+    {
+        return;
+    }
+    // the wheel is only advanced by its event, so its slots may have been
+    // reached before the current time, if timers were armed since then
+    m_eventTick = std::max<uint64_t>(tick, Simulator::Now().GetTimeStep() / m_tick);
+    const Time delay = TimeStep(m_eventTick * m_tick) - Simulator::Now();
+    m_event = Simulator::Schedule(std::max(delay, Time(0)), &TimerWheel::Expire, this);
+}
+
+void
+TimerWheel::Expire()
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<uint32_t> expired;
+    Advance(Simulator::Now().GetTimeStep() / m_tick, expired);
+    std::sort(expired.begin(), expired.end(), [this](uint32_t a, uint32_t b) {
+        return std::make_pair(m_nodes[a].expiry, m_nodes[a].sequence) <
+               std::make_pair(m_nodes[b].expiry, m_nodes[b].sequence);
+    });
+    // remember the generation of the timers, which may be cancelled, re-armed
+    // or released and reused by the timers invoked before them
+    std::vector<std::pair<uint32_t, uint32_t>> timers;
+    timers.reserve(expired.size());
+    for (auto index : expired)
+    {
+        timers.emplace_back(index, m_nodes[index].generation);
+    }
+    for (const auto& [index, generation] : timers)
+    {
+        Node& node = m_nodes[index];
+        if (node.generation != generation || node.list != EXPIRED)
+        {
+            continue;
+        }
+        auto function = std::move(node.function);
+        const auto type = node.type;
+        const auto callable = node.callable;
+        Release(index);
+        if (auto profiler = EventProfiler::GetCurrent())
+        {
+            // attribute the timer to its callable rather than to the event of the wheel
+            profiler->InvokeNested(*type, callable, function);
+        }
+        else
+        {
+            function();
+        }
+    }
+    if (!m_event.IsPending())
+    {
+        ScheduleNext();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,282 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "event-id.h"
+#include "make-event.h"
+#include "nstime.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::TimerWheel timer class declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup timer
+ * @brief A hierarchical timing wheel multiplexing many timers onto a
+ * single simulator event.
+ *
+ * Protocols which keep a timer per destination, per neighbor or per
+ * packet can arm them on a TimerWheel instead of holding a Timer each:
+ * the wheel schedules a single event, at the earliest time at which one
+ * of its timers expires or must be moved to a finer level of the wheel,
+ * and arming, cancelling and re-arming a timer are constant time
+ * operations which do not touch the simulator event queue.
+ *
+ * The wheel has 11 levels of 64 slots.  A timer is linked into the level
+ * of the most significant group of 6 bits in which its expiration tick
+ * differs from the current tick of the wheel, and moves to lower levels
+ * as the wheel advances, at most once per level.
+ *
+ * The timers expire at their exact expiration time by default.  A wheel
+ * can be given a coarser tick, in which case the expiration time of the
+ * timers is rounded up to the next multiple of the tick.  The timers
+ * expiring on the same tick are invoked in the order in which they were
+ * armed.
+ *
+ * All the timers expiring on the same tick are invoked by a single
+ * simulator event, which the wheel schedules when it advances to that tick,
+ * not when the timers are armed.  Hence, relative to the other events
+ * scheduled for the same time, the timers of a wheel are invoked together,
+ * at the position of the event of the wheel, whereas Timers holding their
+ * own event would be interleaved with them in the order in which the
+ * events were scheduled.  Models whose behavior depends on the order of
+ * same-time events should not assume that a timer expiring at a given time
+ * runs before or after the other events of that time.
+ *
+ * A timer is identified by the TimerWheel::Id returned when it is armed,
+ * which becomes stale once the timer has expired or has been cancelled.
+ *
+ * When the events are profiled by an EventProfiler, each expired timer is
+ * attributed to the member function, function or lambda it invokes rather
+ * than to the event of the wheel.
+ */
+class TimerWheel
+{
+  public:
+    /**
+     * @brief Identifier of a timer armed on a TimerWheel.
+     *
+     * A default-constructed Id does not identify any timer.
+     */
+    class Id
+    {
+      public:
+        Id();
+
+      private:
+        friend class TimerWheel;
+
+        /**
+         * Constructor.
+         * @param index The index of the timer in the wheel.
+         * @param generation The generation of the timer.
+         */
+        Id(uint32_t index, uint32_t generation);
+
+        uint32_t m_index;      //!< Index of the timer in the wheel.
+        uint32_t m_generation; //!< Generation of the timer, 0 for no timer.
+    };
+
+    /** Constructor, for a wheel whose tick is one time step. */
+    TimerWheel();
+    /**
+     * Constructor.
+     * @param tick The tick of the wheel, strictly positive.
+     */
+    TimerWheel(const Time& tick);
+    /** Destructor, which cancels the timers of the wheel. */
+    ~TimerWheel();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * Arm a timer.
+     *
+     * @param [in] delay The delay after which the timer expires.
+     * @param [in] function The function invoked when the timer expires.
+     * @return The identifier of the timer.
+     */
+    Id Schedule(const Time& delay, std::function<void()> function);
+
+    /**
+     * Arm a timer invoking a member function or a function.
+     *
+     * @tparam FUNC \deduced The type of the function.
+     * @tparam Ts \deduced The types of the arguments.
+     * @param [in] delay The delay after which the timer expires.
+     * @param [in] f The member function or function.
+     * @param [in] args The object on which the member function is invoked, if any,
+     *             and the arguments, which are copied into the timer.
+     * @return The identifier of the timer.
+     */
+    template <typename FUNC, typename... Ts>
+    Id Schedule(const Time& delay, FUNC f, Ts&&... args);
+
+    /**
+     * Re-arm a running timer with a new delay, keeping its function.
+     *
+     * @param [in] id The identifier of the timer.
+     * @param [in] delay The delay after which the timer expires.
+     * @return False if the timer was not running, in which case it is not re-armed.
+     */
+    bool Reschedule(const Id& id, const Time& delay);
+
+    /**
+     * Cancel a timer.  Does nothing if the timer is not running.
+     *
+     * @param [in] id The identifier of the timer.
+     */
+    void Cancel(const Id& id);
+
+    /** Cancel all the timers of the wheel. */
+    void CancelAll();
+
+    /**
+     * @param [in] id The identifier of a timer.
+     * @return True if the timer is armed and has not expired yet.
+     */
+    bool IsRunning(const Id& id) const;
+
+    /**
+     * @param [in] id The identifier of a timer.
+     * @return The time left until the timer expires, or zero if it is not running.
+     */
+    Time GetDelayLeft(const Id& id) const;
+
+    /** @return The number of running timers. */
+    std::size_t GetNTimers() const;
+
+  private:
+    static constexpr uint32_t LEVEL_BITS = 6;            //!< Bits of the ticks per level
+    static constexpr uint32_t SLOTS = 1 << LEVEL_BITS;   //!< Slots per level
+    static constexpr uint32_t LEVELS = 11;               //!< Levels, covering 64 bits
+    static constexpr uint16_t DUE_LIST = LEVELS * SLOTS; //!< List of the due timers
+    static constexpr uint16_t EXPIRED = DUE_LIST + 1;    //!< State of the expired timers
+    static constexpr uint16_t FREE = DUE_LIST + 2;       //!< State of the free nodes
+    static constexpr uint32_t NONE = UINT32_MAX;         //!< No node
+
+    static_assert(LEVELS * LEVEL_BITS >= 64, "The levels must cover the 64 bits of the ticks");
+
+    /** A timer of the wheel. */
+    struct Node
+    {
+        std::function<void()> function; //!< Function invoked on expiration
+        const std::type_info* type;     //!< Type of the callable, for the event profiler
+        const void* callable;           //!< Address of the callable, for the event profiler
+        uint64_t expiry;                //!< Expiration tick
+        uint64_t sequence;              //!< Arming order, among the timers of a tick
+        uint32_t prev;                  //!< Previous node of the list
+        uint32_t next;                  //!< Next node of the list, or of the free list
+        uint32_t generation;            //!< Generation of the node
+        uint16_t list;                  //!< List of the node, or EXPIRED or FREE
+    };
+
+    /**
+     * Arm a timer.
+     *
+     * @param [in] delay The delay after which the timer expires.
+     * @param [in] function The function invoked when the timer expires.
+     * @param [in] type The type of the callable invoked by the function.
+     * @param [in] callable The address of the callable, or null if unknown.
+     * @return The identifier of the timer.
+     */
+    Id DoSchedule(const Time& delay,
+                  std::function<void()> function,
+                  const std::type_info& type,
+                  const void* callable);
+    /**
+     * @param [in] id The identifier of a timer.
+     * @return The index of the timer, or NONE if the timer is not running.
+     */
+    uint32_t Find(const Id& id) const;
+    /**
+     * Set the expiration tick of a timer and link it into the wheel.
+     * @param [in] index The index of the timer.
+     * @param [in] delay The delay after which the timer expires.
+     */
+    void Arm(uint32_t index, const Time& delay);
+    /**
+     * Link a timer into the list of its expiration tick.
+     * @param [in] index The index of the timer.
+     */
+    void Link(uint32_t index);
+    /**
+     * Unlink a timer from its list.
+     * @param [in] index The index of the timer.
+     */
+    void Unlink(uint32_t index);
+    /**
+     * Release a timer, which makes its identifier stale.
+     * @param [in] index The index of the timer.
+     */
+    void Release(uint32_t index);
+    /**
+     * Advance the wheel, moving the timers of the slots which were reached
+     * to lower levels.
+     * @param [in] now The current tick.
+     * @param [out] expired The timers which expired.
+     */
+    void Advance(uint64_t now, std::vector<uint32_t>& expired);
+    /**
+     * @param [out] tick The tick at which the wheel must be advanced next.
+     * @return False if the wheel has no timers.
+     */
+    bool GetNextTick(uint64_t& tick) const;
+    /** Schedule the event of the wheel at the next tick at which it must be advanced. */
+    void ScheduleNext();
+    /** Advance the wheel and invoke the expired timers. */
+    void Expire();
+
+    int64_t m_tick;                             //!< Time steps per tick
+    uint64_t m_now;                             //!< Tick to which the wheel was advanced
+    uint64_t m_sequence;                        //!< Sequence number of the next armed timer
+    std::size_t m_nTimers;                      //!< Number of running timers
+    std::vector<Node> m_nodes;                  //!< The timers
+    uint32_t m_free;                            //!< First free node
+    std::array<uint32_t, DUE_LIST + 1> m_lists; //!< First node of each slot, and the due list
+    std::array<uint64_t, LEVELS> m_occupied;    //!< Non-empty slots of each level
+    EventId m_event;                            //!< The event advancing the wheel
+    uint64_t m_eventTick;                       //!< The tick of the event
+};
+
+} // namespace ns3
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3
+{
+
+template <typename FUNC, typename... Ts>
+TimerWheel::Id
+TimerWheel::Schedule(const Time& delay, FUNC f, Ts&&... args)
+{
+    const void* callable = internal::GetCallableAddress(f, args...);
+    return DoSchedule(delay,
+                      std::function<void()>([f, ... args = std::forward<Ts>(args)]() mutable {
+                          std::invoke(f, args...);
+                      }),
+                      typeid(FUNC),
+                      callable);
+}
+
+} // namespace ns3
+
+#endif /* TIMER_WHEEL_H */
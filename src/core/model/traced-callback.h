@@ -11,7 +11,7 @@
 
 #include "callback.h"
 
-#include <list>
+#include <vector>
 
 /**
  * @file
@@ -36,6 +36,12 @@ namespace ns3
  * calling the \c operator() form with the appropriate
  * number of arguments.
  *
+ * The chain is stored contiguously, so that firing a trace source
+ * with no connected sink costs a single test, and firing it with
+ * connected sinks walks an array rather than a linked list.  A
+ * Callback connected by a sink while the chain is invoked is also
+ * invoked by that call.
+ *
  * @tparam Ts \explicit Types of the functor arguments.
  */
 template <typename... Ts>
@@ -54,7 +60,9 @@ class TracedCallback
      * Append a Callback to the chain with a context.
      *
      * The context string will be provided as the first argument
-     * to the Callback.
+     * to the Callback, which may take it either by value or by
+     * const reference.  In the latter case, the string is not
+     * copied when the chain is invoked.
      *
      * @param [in] callback Callback to add to chain.
      * @param [in] path Context string to provide when invoking the Callback.
@@ -81,6 +89,10 @@ class TracedCallback
     void operator()(Ts... args) const;
     /**
      * @brief Checks if the Callbacks list is empty.
+     *
+     * This is cheap enough to be called before computing the
+     * arguments of an expensive trace.
+     *
      * @return true if the Callbacks list is empty.
      */
     bool IsEmpty() const;
@@ -102,7 +114,7 @@ class TracedCallback
      *
      * @tparam Ts \deduced Types of the functor arguments.
      */
-    typedef std::list<Callback<void, Ts...>> CallbackList;
+    typedef std::vector<Callback<void, Ts...>> CallbackList;
     /** The chain of Callbacks. */
     CallbackList m_callbackList;
 };
@@ -138,6 +150,15 @@ template <typename... Ts>
 void
 TracedCallback<Ts...>::Connect(const CallbackBase& callback, std::string path)
 {
+    // a Callback taking the context by const reference is passed the bound
+    // path without a copy of the string at each invocation
+    Callback<void, const std::string&, Ts...> refCb;
+    if (refCb.CheckType(callback))
+    {
+        refCb.Assign(callback);
+        m_callbackList.push_back(refCb.Bind(path));
+        return;
+    }
     Callback<void, std::string, Ts...> cb;
     if (!cb.Assign(callback))
     {
@@ -168,6 +189,13 @@ template <typename... Ts>
 void
 TracedCallback<Ts...>::Disconnect(const CallbackBase& callback, std::string path)
 {
+    Callback<void, const std::string&, Ts...> refCb;
+    if (refCb.CheckType(callback))
+    {
+        refCb.Assign(callback);
+        DisconnectWithoutContext(refCb.Bind(path));
+        return;
+    }
     Callback<void, std::string, Ts...> cb;
     if (!cb.Assign(callback))
     {
@@ -181,9 +209,11 @@ template <typename... Ts>
 void
 TracedCallback<Ts...>::operator()(Ts... args) const
 {
-    for (auto i = m_callbackList.begin(); i != m_callbackList.end(); i++)
+    // the size is read at each iteration and the Callbacks are accessed by
+    // index because a Callback may connect another one to this chain
+    for (std::size_t i = 0; i < m_callbackList.size(); i++)
     {
-        (*i)(args...);
+        m_callbackList[i](args...);
     }
 }
 
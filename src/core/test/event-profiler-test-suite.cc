@@ -0,0 +1,347 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "ns3/config.h"
+#include "ns3/event-profiler.h"
+#include "ns3/make-event.h"
+#include "ns3/object.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/timer-wheel.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup simulator
+ * @ingroup simulator-tests
+ * EventProfiler test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup simulator-tests
+ * Object whose member function is invoked by the profiled events.
+ */
+class EventProfilerTestObject : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::tests::EventProfilerTestObject")
+                                .SetParent<Object>()
+                                .SetGroupName("Core")
+                                .AddConstructor<EventProfilerTestObject>();
+        return tid;
+    }
+
+    /** Count an invocation. */
+    void Count()
+    {
+        m_count++;
+    }
+
+    /** Count an invocation, overridden by the derived objects. */
+    virtual void CountVirtual()
+    {
+        m_count++;
+    }
+
+    uint32_t m_count{0}; //!< Number of invocations
+};
+
+/**
+ * @ingroup simulator-tests
+ * Object overriding the virtual member function invoked by the profiled events.
+ */
+class EventProfilerTestDerived : public EventProfilerTestObject
+{
+  public:
+    void CountVirtual() override
+    {
+        m_count += 2;
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * Function invoked by the profiled events.
+ */
+void
+EventProfilerTestFunction()
+{
+}
+
+/**
+ * @ingroup simulator-tests
+ * Read the lines of a report.
+ * @param filename The name of the report.
+ * @return The lines of the report.
+ */
+static std::vector<std::string>
+ReadLines(const std::string& filename)
+{
+    std::vector<std::string> lines;
+    std::ifstream is(filename);
+    for (std::string line; std::getline(is, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/**
+ * @ingroup simulator-tests
+ * @return Whether the symbols of the callables are looked up on this platform.
+ */
+static bool
+HasSymbolNames()
+{
+#if (defined(__linux__) || defined(__APPLE__)) && defined(__GNUC__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @ingroup simulator-tests
+ * Check the names of the callables and modules to which events are attributed.
+ */
+class EventProfilerNamesTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    EventProfilerNamesTestCase()
+        : TestCase("Check the names of the callables and modules of the events")
+    {
+    }
+
+    void DoRun() override
+    {
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetCallableName(
+                                  "ns3::MakeEvent<void (ns3::Foo::*)(int), ns3::Foo*, int>(void "
+                                  "(ns3::Foo::*)(int), ns3::Foo*, int)::EventMemberImpl"),
+                              "void (ns3::Foo::*)(int)",
+                              "Wrong name of a member function");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetCallableName(
+                                  "ns3::MakeEvent<double, double>(void (*)(double), "
+                                  "double)::EventFunctionImpl"),
+                              "void (*)(double)",
+                              "Wrong name of a function");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetCallableName(
+                                  "ns3::MakeEvent<main::{lambda()#1}>(main::{lambda()#1})::"
+                                  "EventImplFunctional"),
+                              "main::{lambda()#1}",
+                              "Wrong name of a lambda");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetCallableName("ns3::Foo::EventImpl"),
+                              "ns3::Foo::EventImpl",
+                              "Wrong name of an event not created by MakeEvent");
+
+        NS_TEST_EXPECT_MSG_EQ(
+            EventProfiler::GetModuleName("void (ns3::DefaultSimulatorImpl::*)()"),
+            "Core",
+            "Wrong module of a member function");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetModuleName("ns3::Object::Dispose()::{lambda()#1}"),
+                              "Core",
+                              "Wrong module of a lambda");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetModuleName("void (ns3::NoSuchClass::*)()"),
+                              "unknown",
+                              "Wrong module of a class without TypeId");
+        NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetModuleName("void (*)(double)"),
+                              "unknown",
+                              "Wrong module of a function");
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * Check the addresses of the callables of the events and their symbols.
+ */
+class EventProfilerCallableTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    EventProfilerCallableTestCase()
+        : TestCase("Check the callables of the events and their symbols")
+    {
+    }
+
+    void DoRun() override
+    {
+        Ptr<EventProfilerTestObject> object = CreateObject<EventProfilerTestDerived>();
+        EventImpl* member = MakeEvent(&EventProfilerTestObject::Count, object);
+        EventImpl* overridden = MakeEvent(&EventProfilerTestObject::CountVirtual, object);
+        EventImpl* function = MakeEvent(&EventProfilerTestFunction);
+        EventImpl* lambda = MakeEvent([]() {});
+
+        NS_TEST_EXPECT_MSG_EQ(lambda->GetCallable(),
+                              nullptr,
+                              "A lambda should have no address");
+        if (HasSymbolNames())
+        {
+            NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetSymbolName(member->GetCallable()),
+                                  "ns3::tests::EventProfilerTestObject::Count()",
+                                  "Wrong symbol of a member function");
+            NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetSymbolName(overridden->GetCallable()),
+                                  "ns3::tests::EventProfilerTestDerived::CountVirtual()",
+                                  "Wrong symbol of an overridden virtual member function");
+            NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetSymbolName(function->GetCallable()),
+                                  "ns3::tests::EventProfilerTestFunction()",
+                                  "Wrong symbol of a function");
+            // an address within a function is not the one of its symbol
+            NS_TEST_EXPECT_MSG_EQ(EventProfiler::GetSymbolName(
+                                      static_cast<const char*>(function->GetCallable()) + 1),
+                                  "",
+                                  "An address within a function should have no symbol");
+        }
+
+        overridden->Invoke();
+        NS_TEST_EXPECT_MSG_EQ(object->m_count, 2, "The overriding function was not invoked");
+        for (auto event : {member, overridden, function, lambda})
+        {
+            event->Unref();
+        }
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * Check the reports of the events invoked through an EventProfiler.
+ */
+class EventProfilerReportTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    EventProfilerReportTestCase()
+        : TestCase("Check the reports of the profiled events")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        const std::string filename = CreateTempDirFilename("event-profile.folded");
+        auto object = CreateObject<EventProfilerTestObject>();
+        EventProfiler profiler(filename);
+        for (uint32_t context : {1U, 2U, 1U, uint32_t{Simulator::NO_CONTEXT}})
+        {
+            EventImpl* event = MakeEvent(&EventProfilerTestObject::Count, object);
+            profiler.Invoke(event, context);
+            event->Unref();
+        }
+        NS_TEST_EXPECT_MSG_EQ(object->m_count, 4, "The events were not invoked");
+        profiler.Write();
+
+        const std::string stack =
+            HasSymbolNames() ? "Core;ns3::tests::EventProfilerTestObject::Count();"
+                             : "Core;void (ns3::tests::EventProfilerTestObject::*)();";
+        const auto events = ReadLines(filename + ".events");
+        NS_TEST_ASSERT_MSG_EQ(events.size(), 3, "Wrong number of lines of the event counts");
+        NS_TEST_EXPECT_MSG_EQ(events[0], stack + "no context 1", "Wrong event count");
+        NS_TEST_EXPECT_MSG_EQ(events[1], stack + "node 1 2", "Wrong event count");
+        NS_TEST_EXPECT_MSG_EQ(events[2], stack + "node 2 1", "Wrong event count");
+
+        const auto times = ReadLines(filename);
+        NS_TEST_ASSERT_MSG_EQ(times.size(), 3, "Wrong number of lines of the wall clock times");
+        for (std::size_t i = 0; i < times.size(); i++)
+        {
+            const auto frames = events[i].substr(0, events[i].rfind(' ') + 1);
+            NS_TEST_EXPECT_MSG_EQ(times[i].substr(0, frames.size()),
+                                  frames,
+                                  "Wrong stack of a wall clock time");
+        }
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * Check that the timers of a TimerWheel are attributed to their callables.
+ */
+class EventProfilerTimerWheelTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    EventProfilerTimerWheelTestCase()
+        : TestCase("Check the attribution of the timers of a TimerWheel")
+    {
+    }
+
+  private:
+    void DoRun() override
+    {
+        const std::string filename = CreateTempDirFilename("timer-wheel-profile.folded");
+        Simulator::Destroy();
+        Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFile", StringValue(filename));
+        auto object = CreateObject<EventProfilerTestObject>();
+        {
+            TimerWheel wheel;
+            wheel.Schedule(MilliSeconds(1), &EventProfilerTestObject::Count, object);
+            wheel.Schedule(MilliSeconds(2), &EventProfilerTestObject::Count, object);
+            Simulator::Run();
+        }
+        Simulator::Destroy();
+        Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFile", StringValue(""));
+        NS_TEST_EXPECT_MSG_EQ(object->m_count, 2, "The timers were not invoked");
+
+        const auto events = ReadLines(filename + ".events");
+        auto timers = std::find_if(events.cbegin(), events.cend(), [](const auto& line) {
+            return line.find("EventProfilerTestObject") != std::string::npos;
+        });
+        NS_TEST_ASSERT_MSG_EQ((timers != events.cend()),
+                              true,
+                              "The timers were not attributed to their callable");
+        NS_TEST_EXPECT_MSG_EQ(timers->substr(timers->rfind(' ')),
+                              " 2",
+                              "Wrong count of the timers");
+        NS_TEST_EXPECT_MSG_EQ(std::any_of(events.cbegin(),
+                                          events.cend(),
+                                          [](const auto& line) {
+                                              return line.find("TimerWheel") != std::string::npos;
+                                          }),
+                              true,
+                              "The events of the wheel were not reported");
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * EventProfiler test suite
+ */
+class EventProfilerTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    EventProfilerTestSuite()
+        : TestSuite("event-profiler", Type::UNIT)
+    {
+        AddTestCase(new EventProfilerNamesTestCase());
+        AddTestCase(new EventProfilerCallableTestCase());
+        AddTestCase(new EventProfilerReportTestCase());
+        AddTestCase(new EventProfilerTimerWheelTestCase());
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * EventProfilerTestSuite instance variable.
+ */
+static EventProfilerTestSuite g_eventProfilerTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
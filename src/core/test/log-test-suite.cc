@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/log.h"
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/test.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup logging
+ * @ingroup logging-tests
+ * Log test suite.
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup logging-tests Logging tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+NS_LOG_COMPONENT_DEFINE("LogTestSuite");
+
+/**
+ * @ingroup logging-tests
+ * Check that the arguments of the logging macros are not evaluated when
+ * their level is disabled.
+ */
+class LogDisabledTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    LogDisabledTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LogDisabledTestCase::LogDisabledTestCase()
+    : TestCase("Check that disabled logging macros do not evaluate their arguments")
+{
+}
+
+void
+LogDisabledTestCase::DoRun()
+{
+    LogComponentDisable("LogTestSuite", LOG_LEVEL_ALL);
+    uint32_t evaluated = 0;
+    auto argument = [&evaluated]() { return ++evaluated; };
+
+    NS_LOG_FUNCTION(argument());
+    NS_LOG_DEBUG("argument " << argument());
+    NS_LOG_ERROR(argument());
+    NS_TEST_ASSERT_MSG_EQ(evaluated, 0, "Arguments of disabled logging macros evaluated");
+
+#ifdef NS3_LOG_ENABLE
+    LogComponentEnable("LogTestSuite", LOG_INFO);
+    std::ostringstream os;
+    auto clog = std::clog.rdbuf(os.rdbuf());
+    NS_LOG_INFO(argument());
+    NS_LOG_LOGIC(argument());
+    std::clog.rdbuf(clog);
+    LogComponentDisable("LogTestSuite", LOG_LEVEL_ALL);
+    NS_TEST_ASSERT_MSG_EQ(evaluated, 1, "Arguments of enabled logging macros not evaluated");
+#endif
+}
+
+/**
+ * @ingroup logging-tests
+ * Check that a log file of the binary backend decodes to the text the
+ * logging macros print.
+ */
+class BinaryLogTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    BinaryLogTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Object logged through a Ptr
+    class LoggedObject : public SimpleRefCount<LoggedObject>
+    {
+    };
+
+    /**
+     * Log messages with all the kinds of arguments.
+     * @param i A loop index.
+     */
+    void Log(int i);
+};
+
+BinaryLogTestCase::BinaryLogTestCase()
+    : TestCase("Check the decoding of the binary logging backend")
+{
+}
+
+void
+BinaryLogTestCase::Log(int i)
+{
+    static const auto object = Create<LoggedObject>();
+    const std::vector<uint16_t> vector{1, 2, 3};
+
+    NS_LOG_FUNCTION(this << i << "string" << std::string("std::string") << 0.25 << uint8_t{65}
+                         << true << object);
+    NS_LOG_FUNCTION(vector);
+    NS_LOG_FUNCTION_NOARGS();
+    NS_LOG_DEBUG("int " << i << " double " << 1.0 / 3 << " char " << 'c' << uint8_t{66} << " bool "
+                        << false << " hex " << std::hex << 255 << " dec " << std::dec << 255
+                        << std::setw(5) << 7 << std::endl
+                        << int64_t{-5} << uint64_t{7} << nullptr);
+    NS_LOG_INFO(1.5f << ' ' << object << " " << static_cast<const char*>("const char*"));
+    NS_LOG_LOGIC(std::fixed << std::setprecision(2) << 3.14159 << std::defaultfloat
+                            << std::setprecision(6) << " " << 3.14159);
+    NS_LOG_WARN(std::string(300, 'w'));
+    NS_LOG_ERROR(i);
+}
+
+void
+BinaryLogTestCase::DoRun()
+{
+    LogComponentEnable("LogTestSuite", LOG_LEVEL_ALL);
+    LogComponentEnable("LogTestSuite", LOG_PREFIX_FUNC);
+    LogComponentEnable("LogTestSuite", LOG_PREFIX_LEVEL);
+
+    std::ostringstream text;
+    auto clog = std::clog.rdbuf(text.rdbuf());
+    for (int i = 0; i < 10; i++)
+    {
+        Log(i);
+    }
+
+    // a small buffer, to write the records in many chunks
+    const std::string filename = CreateTempDirFilename("binary-log.log");
+    bool enabled = BinaryLog::Enable(filename, 256);
+    for (int i = 0; i < 10; i++)
+    {
+        Log(i);
+    }
+    BinaryLog::Disable();
+    std::clog.rdbuf(clog);
+    LogComponentDisable("LogTestSuite", LOG_LEVEL_ALL);
+    LogComponentDisable("LogTestSuite", LOG_PREFIX_ALL);
+    NS_TEST_ASSERT_MSG_EQ(enabled, true, "Cannot create " << filename);
+
+    std::ifstream is(filename, std::ios::binary);
+    std::ostringstream decoded;
+    bool complete = BinaryLog::Decode(is, decoded);
+    NS_TEST_ASSERT_MSG_EQ(complete, true, "Incomplete binary log file");
+    NS_TEST_EXPECT_MSG_EQ(decoded.str(), text.str(), "Decoded text differs from printed text");
+    std::remove(filename.c_str());
+}
+
+/**
+ * @ingroup logging-tests
+ * Log test suite.
+ */
+class LogTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    LogTestSuite();
+};
+
+LogTestSuite::LogTestSuite()
+    : TestSuite("log")
+{
+    AddTestCase(new LogDisabledTestCase());
+    AddTestCase(new BinaryLogTestCase());
+}
+
+/**
+ * @ingroup logging-tests
+ * LogTestSuite instance variable.
+ */
+static LogTestSuite g_logTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -147,6 +147,14 @@ class DerivedB : public BaseB
     }
 };
 
+/**
+ * @ingroup object-tests
+ * Class derived from BaseA which does not register its own TypeId.
+ */
+class UnregisteredA : public BaseA
+{
+};
+
 NS_OBJECT_ENSURE_REGISTERED(BaseA);
 NS_OBJECT_ENSURE_REGISTERED(DerivedA);
 NS_OBJECT_ENSURE_REGISTERED(BaseB);
@@ -521,6 +529,88 @@ UnidirectionalAggregateObjectTestCase::DoRun()
                           "Can GetObject (through baseB) for BaseA Object");
 }
 
+/**
+ * @ingroup object-tests
+ * Test GetObject finds the aggregates after the aggregation changes.
+ */
+class AggregateLookupTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    AggregateLookupTestCase();
+    /** Destructor. */
+    ~AggregateLookupTestCase() override;
+
+  private:
+    void DoRun() override;
+};
+
+AggregateLookupTestCase::AggregateLookupTestCase()
+    : TestCase("Check GetObject after successive aggregations")
+{
+}
+
+AggregateLookupTestCase::~AggregateLookupTestCase()
+{
+}
+
+void
+AggregateLookupTestCase::DoRun()
+{
+    //
+    // Look up both objects before they are aggregated, so that their lookup
+    // tables are built.
+    //
+    Ptr<DerivedA> derivedA = CreateObject<DerivedA>();
+    Ptr<DerivedB> derivedB = CreateObject<DerivedB>();
+    NS_TEST_ASSERT_MSG_EQ(derivedA->GetObject<BaseA>(),
+                          derivedA,
+                          "Cannot GetObject (through derivedA) for BaseA Object");
+    NS_TEST_ASSERT_MSG_EQ(derivedA->GetObject<BaseB>(),
+                          nullptr,
+                          "Unexpectedly found a BaseB through derivedA");
+    NS_TEST_ASSERT_MSG_EQ(derivedB->GetObject<DerivedA>(),
+                          nullptr,
+                          "Unexpectedly found a DerivedA through derivedB");
+
+    //
+    // The aggregation must discard the lookup tables built before.
+    //
+    derivedA->AggregateObject(derivedB);
+    NS_TEST_ASSERT_MSG_EQ(derivedA->GetObject<BaseB>(),
+                          derivedB,
+                          "Cannot GetObject (through derivedA) for BaseB Object");
+    NS_TEST_ASSERT_MSG_EQ(derivedA->GetObject<DerivedB>(),
+                          derivedB,
+                          "Cannot GetObject (through derivedA) for DerivedB Object");
+    NS_TEST_ASSERT_MSG_EQ(derivedB->GetObject<DerivedA>(),
+                          derivedA,
+                          "Cannot GetObject (through derivedB) for DerivedA Object");
+    NS_TEST_ASSERT_MSG_EQ(derivedB->GetObject<BaseA>(BaseA::GetTypeId()),
+                          derivedA,
+                          "Cannot GetObject (through derivedB) for BaseA TypeId");
+    NS_TEST_ASSERT_MSG_EQ(derivedB->GetObject<BaseB>(BaseB::GetTypeId()),
+                          derivedB,
+                          "Cannot GetObject (through derivedB) for BaseB TypeId");
+
+    //
+    // A class without its own TypeId is looked up with the TypeId of its
+    // base class, which an aggregate of the base class also matches.
+    //
+    Ptr<BaseA> baseA = CreateObject<BaseA>();
+    Ptr<BaseB> baseB = CreateObject<BaseB>();
+    baseB->AggregateObject(baseA);
+    NS_TEST_ASSERT_MSG_EQ(baseB->GetObject<UnregisteredA>(),
+                          nullptr,
+                          "Unexpectedly found an UnregisteredA through baseB");
+    Ptr<UnregisteredA> unregisteredA = CreateObject<UnregisteredA>();
+    baseB = CreateObject<BaseB>();
+    baseB->AggregateObject(unregisteredA);
+    NS_TEST_ASSERT_MSG_EQ(baseB->GetObject<UnregisteredA>(),
+                          unregisteredA,
+                          "Cannot GetObject (through baseB) for UnregisteredA Object");
+}
+
 /**
  * @ingroup object-tests
  * Test an Object factory can create Objects
@@ -623,6 +713,7 @@ ObjectTestSuite::ObjectTestSuite()
     AddTestCase(new CreateObjectTestCase);
     AddTestCase(new AggregateObjectTestCase);
     AddTestCase(new UnidirectionalAggregateObjectTestCase);
+    AddTestCase(new AggregateLookupTestCase);
     AddTestCase(new ObjectFactoryTestCase);
 }
 
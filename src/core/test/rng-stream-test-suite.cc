@@ -0,0 +1,232 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-stream.h"
+#include "ns3/test.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup rng-tests
+ * RngStream batched generation tests.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup rng-tests
+ *
+ * The MRG32k3a generator of L'Ecuyer, generating one random at a time
+ * with the double form of the recurrences.
+ */
+class ReferenceMrg32k3a
+{
+  public:
+    /**
+     * Constructor, with the state of a stream and substream 0.
+     * @param seed The seed.
+     */
+    ReferenceMrg32k3a(uint32_t seed)
+    {
+        m_state.fill(seed);
+    }
+
+    /**
+     * Generate the next random.
+     * @return The next random.
+     */
+    double RandU01()
+    {
+        const double m1 = 4294967087.0;
+        const double m2 = 4294944443.0;
+        const double norm = 1.0 / (m1 + 1.0);
+
+        double p1 = 1403580.0 * m_state[1] - 810728.0 * m_state[0];
+        auto k = static_cast<int32_t>(p1 / m1);
+        p1 -= k * m1;
+        if (p1 < 0.0)
+        {
+            p1 += m1;
+        }
+        m_state[0] = m_state[1];
+        m_state[1] = m_state[2];
+        m_state[2] = p1;
+
+        double p2 = 527612.0 * m_state[5] - 1370589.0 * m_state[3];
+        k = static_cast<int32_t>(p2 / m2);
+        p2 -= k * m2;
+        if (p2 < 0.0)
+        {
+            p2 += m2;
+        }
+        m_state[3] = m_state[4];
+        m_state[4] = m_state[5];
+        m_state[5] = p2;
+
+        return ((p1 > p2) ? (p1 - p2) * norm : (p1 - p2 + m1) * norm);
+    }
+
+  private:
+    std::array<double, 6> m_state; //!< The state vector.
+};
+
+/**
+ * @ingroup rng-tests
+ *
+ * Check that the batched generation of RngStream gives the sequence of
+ * randoms generated one at a time.
+ */
+class RngStreamSequenceTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    RngStreamSequenceTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+RngStreamSequenceTestCase::RngStreamSequenceTestCase()
+    : TestCase("Check the sequence of the batched generation of randoms")
+{
+}
+
+void
+RngStreamSequenceTestCase::DoRun()
+{
+    for (uint32_t seed : {1U, 12345U, 4294944442U})
+    {
+        RngStream stream(seed, 0, 0);
+        ReferenceMrg32k3a reference(seed);
+        for (int i = 0; i < 100000; i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(stream.RandU01(),
+                                  reference.RandU01(),
+                                  "Random " << i << " of seed " << seed << " differs");
+        }
+
+        // interleave bulk and single randoms, at all the positions in the buffer
+        std::vector<double> values(100);
+        for (std::size_t n : {1, 5, 16, 17, 3, 100, 31})
+        {
+            stream.RandU01(values.data(), n);
+            for (std::size_t i = 0; i < n; i++)
+            {
+                NS_TEST_ASSERT_MSG_EQ(values[i],
+                                      reference.RandU01(),
+                                      "Random " << i << " of " << n << " differs");
+            }
+            NS_TEST_ASSERT_MSG_EQ(stream.RandU01(), reference.RandU01(), "Random differs");
+        }
+
+        // a copy continues the sequence, from the middle of the buffer
+        RngStream copy(stream);
+        for (int i = 0; i < 100; i++)
+        {
+            const double expected = reference.RandU01();
+            NS_TEST_ASSERT_MSG_EQ(stream.RandU01(), expected, "Random differs");
+            NS_TEST_ASSERT_MSG_EQ(copy.RandU01(), expected, "Random of the copy differs");
+        }
+    }
+}
+
+/**
+ * @ingroup rng-tests
+ *
+ * Check that RandomVariableStream::GetValues gives the values of as many
+ * calls of GetValue.
+ */
+class RandomVariableGetValuesTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    RandomVariableGetValuesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the values of two random variables with the same stream,
+     * one drawn with GetValues and the other with GetValue.
+     * @param bulk The random variable drawn with GetValues.
+     * @param single The random variable drawn with GetValue.
+     */
+    void Compare(Ptr<RandomVariableStream> bulk, Ptr<RandomVariableStream> single);
+};
+
+RandomVariableGetValuesTestCase::RandomVariableGetValuesTestCase()
+    : TestCase("Check the values drawn with RandomVariableStream::GetValues")
+{
+}
+
+void
+RandomVariableGetValuesTestCase::Compare(Ptr<RandomVariableStream> bulk,
+                                         Ptr<RandomVariableStream> single)
+{
+    bulk->SetStream(7);
+    single->SetStream(7);
+    std::vector<double> values(100);
+    for (std::size_t n : {3, 20, 100, 1})
+    {
+        bulk->GetValues(values.data(), n);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(values[i],
+                                  single->GetValue(),
+                                  bulk->GetInstanceTypeId().GetName()
+                                      << ": value " << i << " of " << n << " differs");
+        }
+    }
+}
+
+void
+RandomVariableGetValuesTestCase::DoRun()
+{
+    for (bool antithetic : {false, true})
+    {
+        auto uniform = [antithetic]() {
+            auto x = CreateObject<UniformRandomVariable>();
+            x->SetAttribute("Min", DoubleValue(2));
+            x->SetAttribute("Max", DoubleValue(7.5));
+            x->SetAttribute("Antithetic", BooleanValue(antithetic));
+            return x;
+        };
+        Compare(uniform(), uniform());
+    }
+    Compare(CreateObject<ExponentialRandomVariable>(), CreateObject<ExponentialRandomVariable>());
+}
+
+/**
+ * @ingroup rng-tests
+ *
+ * RngStream batched generation test suite.
+ */
+class RngStreamTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    RngStreamTestSuite();
+};
+
+RngStreamTestSuite::RngStreamTestSuite()
+    : TestSuite("rng-stream", Type::UNIT)
+{
+    AddTestCase(new RngStreamSequenceTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new RandomVariableGetValuesTestCase, TestCase::Duration::QUICK);
+}
+
+static RngStreamTestSuite g_rngStreamTestSuite; //!< Static variable for test initialization
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,137 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulation-checkpoint.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <cstdlib>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup simulator
+ * @ingroup simulator-tests
+ * SimulationCheckpoint test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup simulator-tests
+ * Check that the branches of a simulation continue from the state reached
+ * at the checkpoint: the time, the scheduled events and the positions of
+ * the random number streams.
+ */
+class SimulationCheckpointTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    SimulationCheckpointTestCase()
+        : TestCase("Check the state of the branches of a simulation")
+    {
+    }
+
+  private:
+    /** Count an event and schedule the next one. */
+    void Tick()
+    {
+        m_ticks++;
+        Simulator::Schedule(Seconds(1), &SimulationCheckpointTestCase::Tick, this);
+    }
+
+    /**
+     * Run a branch, which exits the process.
+     * @param branch The index of the branch.
+     */
+    [[noreturn]] void RunBranch(uint32_t branch)
+    {
+        bool ok = (Simulator::Now() == Seconds(10)) && (m_ticks == 10);
+
+        // the random number stream continues from its position at the checkpoint
+        auto twin = CreateObject<UniformRandomVariable>();
+        twin->SetStream(m_random->GetStream());
+        for (uint32_t i = 0; i < m_nDrawn; i++)
+        {
+            twin->GetValue();
+        }
+        ok = ok && (m_random->GetValue() == twin->GetValue());
+
+        // the scheduled events continue
+        Simulator::Stop(Seconds(5 + branch));
+        Simulator::Run();
+        ok = ok && (m_ticks == 15 + branch);
+        Simulator::Destroy();
+        std::_Exit(ok ? 0 : 1);
+    }
+
+    void DoRun() override
+    {
+        m_random = CreateObject<UniformRandomVariable>();
+        m_random->SetStream(42);
+        for (uint32_t i = 0; i < m_nDrawn; i++)
+        {
+            m_random->GetValue();
+        }
+
+        Simulator::Schedule(Seconds(0), &SimulationCheckpointTestCase::Tick, this);
+        Simulator::Stop(Seconds(10));
+        Simulator::Run();
+
+        SimulationCheckpoint checkpoint;
+        if (auto branch = checkpoint.Branch(4, 2))
+        {
+            RunBranch(*branch);
+        }
+        NS_TEST_EXPECT_MSG_EQ(checkpoint.GetNFailed(), 0, "A branch failed");
+
+        // a failing branch is reported
+        if (auto branch = checkpoint.Branch(3); branch && *branch == 1)
+        {
+            std::_Exit(1);
+        }
+        else if (branch)
+        {
+            std::_Exit(0);
+        }
+        NS_TEST_EXPECT_MSG_EQ(checkpoint.GetNFailed(), 1, "The failed branch was not reported");
+
+        NS_TEST_EXPECT_MSG_EQ(m_ticks, 10, "The branches modified the state of the simulation");
+        Simulator::Destroy();
+    }
+
+    uint32_t m_ticks{0};                   //!< Number of events executed
+    Ptr<UniformRandomVariable> m_random;   //!< The random number stream
+    static constexpr uint32_t m_nDrawn{7}; //!< Random numbers drawn before the checkpoint
+};
+
+/**
+ * @ingroup simulator-tests
+ * SimulationCheckpoint test suite
+ */
+class SimulationCheckpointTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    SimulationCheckpointTestSuite()
+        : TestSuite("simulation-checkpoint", Type::UNIT)
+    {
+        AddTestCase(new SimulationCheckpointTestCase());
+    }
+};
+
+/**
+ * @ingroup simulator-tests
+ * SimulationCheckpointTestSuite instance variable.
+ */
+static SimulationCheckpointTestSuite g_simulationCheckpointTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -12,9 +12,11 @@
 #include "ns3/nstime.h"
 #include "ns3/test.h"
 
+#include <algorithm>
 #include <array>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <tuple>
@@ -523,6 +525,98 @@ TimeInputOutputTestCase::DoRun()
     CheckAs(t * 1e+8, "+9.961925y");
 }
 
+/**
+ * @ingroup core-tests
+ * @brief Check that the conversions of whole numbers done without
+ * int64x64_t give the same results as the int64x64_t conversions.
+ */
+class TimeExactConversionTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor for TimeExactConversionTestCase.
+     */
+    TimeExactConversionTestCase();
+
+  private:
+    /**
+     * Run the test case.
+     */
+    void DoRun() override;
+};
+
+TimeExactConversionTestCase::TimeExactConversionTestCase()
+    : TestCase("Check the conversions of whole numbers without int64x64_t")
+{
+}
+
+void
+TimeExactConversionTestCase::DoRun()
+{
+    const std::array<double, 16> values{1,
+                                        2.5,
+                                        0.1,
+                                        11.2,
+                                        1e-3,
+                                        1.5e-9,
+                                        123456.789,
+                                        1.0 / 3,
+                                        4503599627370495.0,
+                                        2251799813685247.0,
+                                        2251799813685248.0,
+                                        1e-10,
+                                        0.5e-9,
+                                        7e-12,
+                                        3.0517578125e-05,
+                                        1e6};
+    const std::array<int64_t, 8> steps{1,
+                                       999,
+                                       1000000000,
+                                       3000000000000,
+                                       123456789123,
+                                       2251799813685247,
+                                       4503599627370496,
+                                       std::numeric_limits<int64_t>::max() / 1000};
+
+    for (int u = Time::Y; u < Time::LAST; u++)
+    {
+        const auto unit = static_cast<Time::Unit>(u);
+        // skip the values overflowing the int64x64_t conversions
+        const auto from = static_cast<double>(Time::FromInteger(1, unit).GetTimeStep());
+        const int64_t to = std::max<int64_t>(Time(1).ToInteger(unit), 1);
+        for (double value : values)
+        {
+            if (value * from > 1e18)
+            {
+                continue;
+            }
+            for (double v : {value, -value})
+            {
+                const Time time = Time::FromDouble(v, unit);
+                const Time expected = Time::From(int64x64_t(v), unit);
+                NS_TEST_EXPECT_MSG_EQ(time.GetTimeStep(),
+                                      expected.GetTimeStep(),
+                                      "FromDouble(" << v << ", " << unit << ")");
+            }
+        }
+        for (int64_t step : steps)
+        {
+            if (step > std::numeric_limits<int64_t>::max() / to)
+            {
+                continue;
+            }
+            for (int64_t s : {step, -step})
+            {
+                const Time time(s);
+                const double expected = time.To(unit).GetDouble();
+                NS_TEST_EXPECT_MSG_EQ(time.ToDouble(unit),
+                                      expected,
+                                      "Time(" << s << ").ToDouble(" << unit << ")");
+            }
+        }
+    }
+}
+
 /**
  * @ingroup core-tests
  * @brief   Time test Suite.  Runs the appropriate test cases for time
@@ -535,6 +629,7 @@ static class TimeTestSuite : public TestSuite
     {
         AddTestCase(new TimeWithSignTestCase(), TestCase::Duration::QUICK);
         AddTestCase(new TimeInputOutputTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new TimeExactConversionTestCase(), TestCase::Duration::QUICK);
         // This should be last, since it changes the resolution
         AddTestCase(new TimeSimpleTestCase(), TestCase::Duration::QUICK);
     }
@@ -0,0 +1,343 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/timer-wheel.h"
+
+#include <map>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup timer
+ * @ingroup timer-tests
+ * TimerWheel test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup timer-tests
+ * Check the expiration time and order of the timers of a TimerWheel.
+ */
+class TimerWheelExpiryTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    TimerWheelExpiryTestCase();
+    void DoRun() override;
+
+  private:
+    /**
+     * Record the expiration of a timer.
+     * @param timer The number of the timer.
+     */
+    void Expire(uint32_t timer);
+
+    std::vector<std::pair<uint32_t, Time>> m_expired; //!< Expired timers and their time
+};
+
+TimerWheelExpiryTestCase::TimerWheelExpiryTestCase()
+    : TestCase("Check the expiration time and order of the timers")
+{
+}
+
+void
+TimerWheelExpiryTestCase::Expire(uint32_t timer)
+{
+    m_expired.emplace_back(timer, Simulator::Now());
+}
+
+void
+TimerWheelExpiryTestCase::DoRun()
+{
+    TimerWheel wheel;
+    const std::vector<Time> delays{NanoSeconds(1),
+                                   NanoSeconds(63),
+                                   NanoSeconds(64),
+                                   NanoSeconds(4097),
+                                   MicroSeconds(1),
+                                   MilliSeconds(3),
+                                   Seconds(2),
+                                   Seconds(2),
+                                   Seconds(1000),
+                                   NanoSeconds(1)};
+    for (uint32_t timer = 0; timer < delays.size(); timer++)
+    {
+        wheel.Schedule(delays[timer], &TimerWheelExpiryTestCase::Expire, this, timer);
+    }
+    NS_TEST_EXPECT_MSG_EQ(wheel.GetNTimers(), delays.size(), "Wrong number of timers");
+    // arm timers while the wheel has already been advanced
+    Simulator::Schedule(MicroSeconds(70), [&wheel, this]() {
+        wheel.Schedule(NanoSeconds(0), &TimerWheelExpiryTestCase::Expire, this, 10);
+        wheel.Schedule(MicroSeconds(1), &TimerWheelExpiryTestCase::Expire, this, 11);
+    });
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const std::vector<std::pair<uint32_t, Time>> expected{{0, NanoSeconds(1)},
+                                                          {9, NanoSeconds(1)},
+                                                          {1, NanoSeconds(63)},
+                                                          {2, NanoSeconds(64)},
+                                                          {4, MicroSeconds(1)},
+                                                          {3, NanoSeconds(4097)},
+                                                          {10, MicroSeconds(70)},
+                                                          {11, MicroSeconds(71)},
+                                                          {5, MilliSeconds(3)},
+                                                          {6, Seconds(2)},
+                                                          {7, Seconds(2)},
+                                                          {8, Seconds(1000)}};
+    NS_TEST_ASSERT_MSG_EQ(m_expired.size(), expected.size(), "Wrong number of expired timers");
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].first, expected[i].first, "Wrong order of expiration");
+        NS_TEST_EXPECT_MSG_EQ(m_expired[i].second, expected[i].second, "Wrong expiration time");
+    }
+    NS_TEST_EXPECT_MSG_EQ(wheel.GetNTimers(), 0, "The expired timers are still running");
+}
+
+/**
+ * @ingroup timer-tests
+ * Check cancelling and re-arming the timers of a TimerWheel, including from
+ * the function of another timer expiring on the same tick.
+ */
+class TimerWheelCancelTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    TimerWheelCancelTestCase();
+    void DoRun() override;
+};
+
+TimerWheelCancelTestCase::TimerWheelCancelTestCase()
+    : TestCase("Check cancelling and re-arming the timers")
+{
+}
+
+void
+TimerWheelCancelTestCase::DoRun()
+{
+    TimerWheel wheel;
+    std::map<int, Time> expired;
+    auto record = [&expired](int timer) { expired[timer] = Simulator::Now(); };
+
+    TimerWheel::Id none;
+    NS_TEST_EXPECT_MSG_EQ(wheel.IsRunning(none), false, "A null id identifies a timer");
+    wheel.Cancel(none);
+    NS_TEST_EXPECT_MSG_EQ(wheel.Reschedule(none, Seconds(1)), false, "A null id was re-armed");
+
+    auto cancelled = wheel.Schedule(Seconds(1), record, 0);
+    auto rearmed = wheel.Schedule(Seconds(1), record, 1);
+    auto later = wheel.Schedule(Seconds(3), record, 2);
+    NS_TEST_EXPECT_MSG_EQ(wheel.GetDelayLeft(later), Seconds(3), "Wrong delay left");
+    wheel.Cancel(cancelled);
+    NS_TEST_EXPECT_MSG_EQ(wheel.IsRunning(cancelled), false, "The timer was not cancelled");
+    NS_TEST_EXPECT_MSG_EQ(wheel.Reschedule(rearmed, Seconds(5)), true, "Timer not re-armed");
+    NS_TEST_EXPECT_MSG_EQ(wheel.GetDelayLeft(rearmed), Seconds(5), "Wrong delay left");
+
+    // a timer expiring on the same tick as the other two cancels the
+    // first one and re-arms the second one
+    TimerWheel::Id first;
+    TimerWheel::Id second;
+    wheel.Schedule(Seconds(4), [&]() {
+        record(3);
+        wheel.Cancel(first);
+        wheel.Reschedule(second, Seconds(1));
+        // a timer armed from an expiring timer gets the slot of the cancelled one
+        wheel.Schedule(Seconds(0), record, 6);
+    });
+    first = wheel.Schedule(Seconds(4), record, 4);
+    second = wheel.Schedule(Seconds(4), record, 5);
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const std::map<int, Time> expected{{1, Seconds(5)},
+                                       {2, Seconds(3)},
+                                       {3, Seconds(4)},
+                                       {5, Seconds(5)},
+                                       {6, Seconds(4)}};
+    NS_TEST_EXPECT_MSG_EQ((expired == expected), true, "Wrong expired timers");
+    NS_TEST_EXPECT_MSG_EQ(wheel.IsRunning(later), false, "An expired timer is still running");
+    NS_TEST_EXPECT_MSG_EQ(wheel.Reschedule(later, Seconds(1)), false, "Expired timer re-armed");
+}
+
+/**
+ * @ingroup timer-tests
+ * Check that the timers of a TimerWheel with a coarse tick expire on the
+ * first tick after their expiration time.
+ */
+class TimerWheelTickTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    TimerWheelTickTestCase();
+    void DoRun() override;
+};
+
+TimerWheelTickTestCase::TimerWheelTickTestCase()
+    : TestCase("Check the rounding of the expiration time to the tick")
+{
+}
+
+void
+TimerWheelTickTestCase::DoRun()
+{
+    TimerWheel wheel(MilliSeconds(1));
+    std::vector<Time> expired;
+    auto record = [&expired]() { expired.push_back(Simulator::Now()); };
+    wheel.Schedule(MicroSeconds(1), record);
+    wheel.Schedule(MilliSeconds(2), record);
+    Simulator::Schedule(MicroSeconds(2500), [&]() { wheel.Schedule(MilliSeconds(1), record); });
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const std::vector<Time> expected{MilliSeconds(1), MilliSeconds(2), MilliSeconds(4)};
+    NS_TEST_EXPECT_MSG_EQ((expired == expected), true, "Wrong expiration times");
+}
+
+/**
+ * @ingroup timer-tests
+ * Check that random sequences of arming, re-arming and cancelling timers
+ * expire the timers at the same time as the simulator events they replace.
+ */
+class TimerWheelRandomTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    TimerWheelRandomTestCase();
+    void DoRun() override;
+
+  private:
+    /**
+     * Arm, re-arm or cancel a random timer, and schedule the next operation.
+     * @param remaining The number of operations left.
+     */
+    void Operate(uint32_t remaining);
+    /**
+     * Check the expiration of a timer.
+     * @param timer The number of the timer.
+     */
+    void Expire(uint32_t timer);
+    /** @return A random delay below 2^31 ns, with a log-uniform magnitude. */
+    Time GetDelay();
+
+    TimerWheel m_wheel;                  //!< The wheel
+    Ptr<UniformRandomVariable> m_random; //!< Random variable
+    std::vector<TimerWheel::Id> m_ids;   //!< The ids of the timers
+    std::vector<Time> m_expected;        //!< Expected expiration time, or -1
+    uint32_t m_nExpired;                 //!< Number of expired timers
+};
+
+TimerWheelRandomTestCase::TimerWheelRandomTestCase()
+    : TestCase("Check random sequences of operations on the timers")
+{
+}
+
+Time
+TimerWheelRandomTestCase::GetDelay()
+{
+    const uint32_t bits = m_random->GetInteger(0, 31);
+    return NanoSeconds(m_random->GetInteger(0, (uint32_t{1} << bits) - 1));
+}
+
+void
+TimerWheelRandomTestCase::Expire(uint32_t timer)
+{
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), m_expected[timer], "Wrong expiration time");
+    m_expected[timer] = Time(-1);
+    m_nExpired++;
+}
+
+void
+TimerWheelRandomTestCase::Operate(uint32_t remaining)
+{
+    const uint32_t timer = m_random->GetInteger(0, m_ids.size() - 1);
+    const uint32_t operation = m_random->GetInteger(0, 2);
+    const bool running = m_wheel.IsRunning(m_ids[timer]);
+    NS_TEST_EXPECT_MSG_EQ(running, (m_expected[timer] != Time(-1)), "Wrong timer state");
+    if (running && operation == 0)
+    {
+        m_wheel.Cancel(m_ids[timer]);
+        m_expected[timer] = Time(-1);
+    }
+    else if (running)
+    {
+        const Time delay = GetDelay();
+        m_wheel.Reschedule(m_ids[timer], delay);
+        m_expected[timer] = Simulator::Now() + delay;
+        NS_TEST_EXPECT_MSG_EQ(m_wheel.GetDelayLeft(m_ids[timer]), delay, "Wrong delay left");
+    }
+    else
+    {
+        const Time delay = GetDelay();
+        m_ids[timer] = m_wheel.Schedule(delay, &TimerWheelRandomTestCase::Expire, this, timer);
+        m_expected[timer] = Simulator::Now() + delay;
+    }
+    if (remaining > 0)
+    {
+        Simulator::Schedule(GetDelay() / 16,
+                            &TimerWheelRandomTestCase::Operate,
+                            this,
+                            remaining - 1);
+    }
+}
+
+void
+TimerWheelRandomTestCase::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    m_random = CreateObject<UniformRandomVariable>();
+    m_ids.resize(200);
+    m_expected.assign(m_ids.size(), Time(-1));
+    m_nExpired = 0;
+
+    Simulator::Schedule(Seconds(0), &TimerWheelRandomTestCase::Operate, this, 20000);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    for (uint32_t timer = 0; timer < m_ids.size(); timer++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_expected[timer], Time(-1), "A timer did not expire");
+    }
+    NS_TEST_EXPECT_MSG_GT(m_nExpired, 1000, "Too few timers expired");
+    NS_TEST_EXPECT_MSG_EQ(m_wheel.GetNTimers(), 0, "Timers still running");
+}
+
+/**
+ * @ingroup timer-tests
+ * TimerWheel test suite
+ */
+class TimerWheelTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    TimerWheelTestSuite()
+        : TestSuite("timer-wheel", Type::UNIT)
+    {
+        AddTestCase(new TimerWheelExpiryTestCase());
+        AddTestCase(new TimerWheelCancelTestCase());
+        AddTestCase(new TimerWheelTickTestCase());
+        AddTestCase(new TimerWheelRandomTestCase());
+    }
+};
+
+/**
+ * @ingroup timer-tests
+ * TimerWheelTestSuite instance variable.
+ */
+static TimerWheelTestSuite g_timerWheelTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -7,6 +7,8 @@
 #include "ns3/test.h"
 #include "ns3/traced-callback.h"
 
+#include <map>
+
 using namespace ns3;
 
 /**
@@ -122,6 +124,203 @@ BasicTracedCallbackTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_two, true, "Callback CbTwo not called");
 }
 
+/**
+ * @ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check that a Callback connected by another one
+ * while the chain is invoked is also invoked.
+ */
+class ConnectWhileInvokedTestCase : public TestCase
+{
+  public:
+    ConnectWhileInvokedTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Callback connecting many other callbacks to the traced callback.
+     * @param a Parameter.
+     */
+    void CbConnect(uint32_t a);
+
+    /**
+     * Callback counting its calls.
+     * @param a Parameter.
+     */
+    void CbCount(uint32_t a);
+
+    TracedCallback<uint32_t> m_trace; //!< traced callback
+    uint32_t m_count;                 //!< number of calls of CbCount
+};
+
+ConnectWhileInvokedTestCase::ConnectWhileInvokedTestCase()
+    : TestCase("Check a TracedCallback connected while invoked")
+{
+}
+
+void
+ConnectWhileInvokedTestCase::CbConnect(uint32_t a)
+{
+    // connect enough callbacks for the storage of the chain to be reallocated
+    for (uint32_t i = 0; i < a; i++)
+    {
+        m_trace.ConnectWithoutContext(MakeCallback(&ConnectWhileInvokedTestCase::CbCount, this));
+    }
+}
+
+void
+ConnectWhileInvokedTestCase::CbCount(uint32_t /* a */)
+{
+    m_count++;
+}
+
+void
+ConnectWhileInvokedTestCase::DoRun()
+{
+    m_trace.ConnectWithoutContext(MakeCallback(&ConnectWhileInvokedTestCase::CbConnect, this));
+    m_count = 0;
+    m_trace(100);
+    NS_TEST_ASSERT_MSG_EQ(m_count, 100, "Callbacks connected while invoked not called");
+
+    m_trace.DisconnectWithoutContext(MakeCallback(&ConnectWhileInvokedTestCase::CbConnect, this));
+    m_count = 0;
+    m_trace(100);
+    NS_TEST_ASSERT_MSG_EQ(m_count, 100, "Unexpected number of calls");
+
+    m_trace.DisconnectWithoutContext(MakeCallback(&ConnectWhileInvokedTestCase::CbCount, this));
+    NS_TEST_ASSERT_MSG_EQ(m_trace.IsEmpty(), true, "Callbacks not disconnected");
+}
+
+/**
+ * @ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check that Callbacks taking the context by value
+ * and by const reference are passed the context they were connected with.
+ */
+class ContextTestCase : public TestCase
+{
+  public:
+    ContextTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Callback taking the context by value.
+     * @param context The context.
+     * @param a Parameter.
+     */
+    void CbValue(std::string context, uint32_t a);
+
+    /**
+     * Callback taking the context by const reference.
+     * @param context The context.
+     * @param a Parameter.
+     */
+    void CbRef(const std::string& context, uint32_t a);
+
+    std::string m_value; //!< Context received by CbValue
+    std::string m_ref;   //!< Context received by CbRef
+};
+
+ContextTestCase::ContextTestCase()
+    : TestCase("Check a TracedCallback connected with a context")
+{
+}
+
+void
+ContextTestCase::CbValue(std::string context, uint32_t /* a */)
+{
+    m_value = context;
+}
+
+void
+ContextTestCase::CbRef(const std::string& context, uint32_t /* a */)
+{
+    m_ref = context;
+}
+
+void
+ContextTestCase::DoRun()
+{
+    TracedCallback<uint32_t> trace;
+    trace.Connect(MakeCallback(&ContextTestCase::CbValue, this), "/value/context/path");
+    trace.Connect(MakeCallback(&ContextTestCase::CbRef, this), "/reference/context/path");
+    trace(1);
+    NS_TEST_ASSERT_MSG_EQ(m_value, "/value/context/path", "Wrong context passed by value");
+    NS_TEST_ASSERT_MSG_EQ(m_ref, "/reference/context/path", "Wrong context passed by reference");
+
+    trace.Disconnect(MakeCallback(&ContextTestCase::CbRef, this), "/other/context/path");
+    trace.Disconnect(MakeCallback(&ContextTestCase::CbRef, this), "/reference/context/path");
+    m_value.clear();
+    m_ref.clear();
+    trace(2);
+    NS_TEST_ASSERT_MSG_EQ(m_value, "/value/context/path", "Wrong context passed by value");
+    NS_TEST_ASSERT_MSG_EQ(m_ref.empty(), true, "Callback not disconnected");
+
+    trace.Disconnect(MakeCallback(&ContextTestCase::CbValue, this), "/value/context/path");
+    NS_TEST_ASSERT_MSG_EQ(trace.IsEmpty(), true, "Callbacks not disconnected");
+}
+
+/**
+ * @ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check a TracedCallback whose first argument is a
+ * container of values which cannot be compared, hence cannot be bound.
+ */
+class UncomparableArgumentTestCase : public TestCase
+{
+  public:
+    UncomparableArgumentTestCase();
+
+  private:
+    /// A key which can be ordered but not compared for equality
+    struct Key
+    {
+        int value; //!< Value of the key
+
+        /**
+         * @param other The other key.
+         * @return \c true if this key is ordered before the other key.
+         */
+        bool operator<(const Key& other) const
+        {
+            return value < other.value;
+        }
+    };
+
+    void DoRun() override;
+
+    /**
+     * Callback taking the container.
+     * @param values The container.
+     */
+    void Cb(std::map<Key, int> values);
+
+    std::size_t m_size{0}; //!< Size of the container received by Cb
+};
+
+UncomparableArgumentTestCase::UncomparableArgumentTestCase()
+    : TestCase("Check a TracedCallback passing a container of uncomparable values")
+{
+}
+
+void
+UncomparableArgumentTestCase::Cb(std::map<Key, int> values)
+{
+    m_size = values.size();
+}
+
+void
+UncomparableArgumentTestCase::DoRun()
+{
+    TracedCallback<std::map<Key, int>> trace;
+    trace.ConnectWithoutContext(MakeCallback(&UncomparableArgumentTestCase::Cb, this));
+    trace(std::map<Key, int>{{Key{1}, 1}, {Key{2}, 2}});
+    NS_TEST_ASSERT_MSG_EQ(m_size, 2, "Wrong container passed");
+}
+
 /**
  * @ingroup tracedcallback-tests
  *
@@ -137,6 +336,9 @@ TracedCallbackTestSuite::TracedCallbackTestSuite()
     : TestSuite("traced-callback", Type::UNIT)
 {
     AddTestCase(new BasicTracedCallbackTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new ConnectWhileInvokedTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new ContextTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new UncomparableArgumentTestCase, TestCase::Duration::QUICK);
 }
 
 static TracedCallbackTestSuite
@@ -224,11 +224,11 @@ DsrOptionField::Serialize(Buffer::Iterator start) const
 uint32_t
 DsrOptionField::Deserialize(Buffer::Iterator start, uint32_t length)
 {
-    std::vector<uint8_t> buf(length);
-    start.Read(buf.data(), length);
     m_optionData = Buffer();
     m_optionData.AddAtEnd(length);
-    m_optionData.Begin().Write(buf.data(), buf.size());
+    Buffer::Iterator end = start;
+    end.Next(length);
+    m_optionData.Begin().Write(start, end);
     return length;
 }
 
@@ -237,7 +237,29 @@ DsrOptionField::AddDsrOption(const DsrOptionHeader& option)
 {
     NS_LOG_FUNCTION_NOARGS();
 
-    uint32_t pad = CalculatePad(option.GetAlignment());
+    AddPadding(option.GetAlignment());
+    m_optionData.AddAtEnd(option.GetSerializedSize());
+    Buffer::Iterator it = m_optionData.End();
+    it.Prev(option.GetSerializedSize());
+    option.Serialize(it);
+}
+
+void
+DsrOptionField::AddDsrOption(const DsrSourceRouteView& sourceRoute)
+{
+    NS_LOG_FUNCTION_NOARGS();
+
+    AddPadding(sourceRoute.GetAlignment());
+    m_optionData.AddAtEnd(sourceRoute.GetSerializedSize());
+    Buffer::Iterator it = m_optionData.End();
+    it.Prev(sourceRoute.GetSerializedSize());
+    sourceRoute.Serialize(it);
+}
+
+void
+DsrOptionField::AddPadding(DsrOptionHeader::Alignment alignment)
+{
+    uint32_t pad = CalculatePad(alignment);
     NS_LOG_LOGIC("need " << pad << " bytes padding");
     switch (pad)
     {
@@ -250,11 +272,6 @@ DsrOptionField::AddDsrOption(const DsrOptionHeader& option)
         AddDsrOption(DsrOptionPadnHeader(pad));
         break;
     }
-
-    m_optionData.AddAtEnd(option.GetSerializedSize());
-    Buffer::Iterator it = m_optionData.End();
-    it.Prev(option.GetSerializedSize());
-    option.Serialize(it);
 }
 
 uint32_t
@@ -231,6 +231,12 @@ class DsrOptionField
      * @param option the option header to serialize
      */
     void AddDsrOption(const DsrOptionHeader& option);
+    /**
+     * @brief Serialize a source route option read from a packet, prepending
+     * pad1 or padn option as necessary
+     * @param sourceRoute the view of the source route option to serialize
+     */
+    void AddDsrOption(const DsrSourceRouteView& sourceRoute);
     /**
      * @brief Get the offset where the options begin, measured from the start of
      * the extension header.
@@ -250,6 +256,11 @@ class DsrOptionField
      * @return the number of bytes required to pad
      */
     uint32_t CalculatePad(DsrOptionHeader::Alignment alignment) const;
+    /**
+     * @brief Add the pad1 or padn option aligning the next option.
+     * @param alignment the alignment of the next option
+     */
+    void AddPadding(DsrOptionHeader::Alignment alignment);
     /**
      * @brief Data payload.
      */
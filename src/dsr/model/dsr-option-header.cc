@@ -27,6 +27,8 @@
 #include "ns3/log.h"
 #include "ns3/packet.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -709,6 +711,141 @@ DsrOptionSRHeader::GetAlignment() const
     return retVal;
 }
 
+DsrSourceRouteView::DsrSourceRouteView()
+    : m_size(0)
+{
+    m_data.fill(0);
+    m_data[0] = OPT_NUMBER;
+    m_data[1] = 2;
+}
+
+bool
+DsrSourceRouteView::Read(Ptr<const Packet> packet)
+{
+    NS_LOG_FUNCTION(this << packet);
+    m_size = std::min<uint32_t>(packet->GetSize(), m_data.size());
+    packet->CopyData(m_data.data(), m_size);
+    if (m_size < 4 || m_data[0] != OPT_NUMBER || m_data[1] < 2 || m_size < 2U + m_data[1])
+    {
+        NS_LOG_LOGIC("The packet does not start with a source route option");
+        m_size = 0;
+        return false;
+    }
+    return true;
+}
+
+uint8_t
+DsrSourceRouteView::GetLength() const
+{
+    return m_data[1];
+}
+
+uint8_t
+DsrSourceRouteView::GetSalvage() const
+{
+    return m_data[2];
+}
+
+uint8_t
+DsrSourceRouteView::GetSegmentsLeft() const
+{
+    return m_data[3];
+}
+
+void
+DsrSourceRouteView::SetSegmentsLeft(uint8_t segmentsLeft)
+{
+    m_data[3] = segmentsLeft;
+}
+
+uint8_t
+DsrSourceRouteView::GetNumberAddress() const
+{
+    return (m_data[1] - 2) / 4;
+}
+
+Ipv4Address
+DsrSourceRouteView::GetNodeAddress(uint8_t index) const
+{
+    NS_ASSERT(index < GetNumberAddress());
+    return Ipv4Address::Deserialize(&m_data[4 + 4 * index]);
+}
+
+std::vector<Ipv4Address>
+DsrSourceRouteView::GetNodesAddress() const
+{
+    std::vector<Ipv4Address> nodeList;
+    nodeList.reserve(GetNumberAddress());
+    for (uint8_t index = 0; index < GetNumberAddress(); index++)
+    {
+        nodeList.push_back(GetNodeAddress(index));
+    }
+    return nodeList;
+}
+
+Ipv4Address
+DsrSourceRouteView::SearchNextHop(Ipv4Address ipv4Address) const
+{
+    NS_LOG_FUNCTION(this << ipv4Address);
+    const uint8_t numberAddress = GetNumberAddress();
+    if (numberAddress == 2)
+    {
+        NS_LOG_DEBUG("The two nodes are neighbors");
+        return GetNodeAddress(1);
+    }
+    if (numberAddress == 0)
+    {
+        return Ipv4Address("0.0.0.0");
+    }
+    if (ipv4Address == GetNodeAddress(numberAddress - 1))
+    {
+        NS_LOG_DEBUG("We have reached to the final destination " << ipv4Address);
+        return ipv4Address;
+    }
+    // the node forwarding the packet is the one before the next hop given by
+    // the segments left field, unless the route was altered
+    const uint8_t segmentsLeft = GetSegmentsLeft();
+    if (segmentsLeft >= 1 && segmentsLeft < numberAddress &&
+        GetNodeAddress(numberAddress - segmentsLeft - 1) == ipv4Address)
+    {
+        return GetNodeAddress(numberAddress - segmentsLeft);
+    }
+    for (uint8_t index = 0; index + 1 < numberAddress; index++)
+    {
+        if (GetNodeAddress(index) == ipv4Address)
+        {
+            return GetNodeAddress(index + 1);
+        }
+    }
+    NS_LOG_DEBUG("next hop address not found, route corrupted");
+    return Ipv4Address("0.0.0.0");
+}
+
+uint8_t
+DsrSourceRouteView::GetNextOptionType() const
+{
+    return (m_size > GetSerializedSize()) ? m_data[GetSerializedSize()] : 0;
+}
+
+uint32_t
+DsrSourceRouteView::GetSerializedSize() const
+{
+    return 2 + m_data[1];
+}
+
+void
+DsrSourceRouteView::Serialize(Buffer::Iterator start) const
+{
+    start.Write(m_data.data(), GetSerializedSize());
+}
+
+DsrOptionHeader::Alignment
+DsrSourceRouteView::GetAlignment() const
+{
+    DsrOptionHeader::Alignment retVal = {4, 0};
+    return retVal;
+}
+
 NS_OBJECT_ENSURE_REGISTERED(DsrOptionRerrHeader);
 
 TypeId
@@ -22,10 +22,13 @@
 
 #include "ns3/header.h"
 #include "ns3/ipv4-address.h"
+#include "ns3/packet.h"
 #include "ns3/simulator.h"
 
 #include <algorithm>
+#include <array>
 #include <ostream>
+#include <vector>
 
 namespace ns3
 {
@@ -673,6 +676,108 @@ class DsrOptionSRHeader : public DsrOptionHeader
     VectorIpv4Address_t m_ipv4Address;
 };
 
+/**
+ * @ingroup dsr
+ * @brief View of the source route option at the start of a packet
+ *
+ * Unlike DsrOptionSRHeader, the view does not deserialize the route into a
+ * vector of addresses: it keeps the raw bytes of the option, at most 257, and
+ * reads the fields and the addresses from them on demand.  The segments left
+ * field is updated in place, and the view is added to a DsrRoutingHeader as
+ * it is, so that forwarding a packet along its source route does not build,
+ * search nor serialize the route.
+ */
+class DsrSourceRouteView
+{
+  public:
+    /**
+     * @brief Constructor.
+     */
+    DsrSourceRouteView();
+    /**
+     * @brief Read the source route option at the start of a packet
+     * @param packet the packet
+     * @return false if the packet does not start with a complete source route option
+     */
+    bool Read(Ptr<const Packet> packet);
+    /**
+     * @brief Get the option data length
+     * @return the option data length
+     */
+    uint8_t GetLength() const;
+    /**
+     * @brief Get the salvage value for a packet
+     * @return The salvage value of the packet
+     */
+    uint8_t GetSalvage() const;
+    /**
+     * @brief Get the number of segments left to send
+     * @return The segments left
+     */
+    uint8_t GetSegmentsLeft() const;
+    /**
+     * @brief Set the number of segments left to send
+     * @param segmentsLeft The segments left
+     */
+    void SetSegmentsLeft(uint8_t segmentsLeft);
+    /**
+     * @brief Get the number of addresses of the route
+     * @return the number of addresses
+     */
+    uint8_t GetNumberAddress() const;
+    /**
+     * @brief Get a Node IPv4 Address.
+     * @param index the index of the IPv4 Address, lower than GetNumberAddress ()
+     * @return the router IPv4 Address
+     */
+    Ipv4Address GetNodeAddress(uint8_t index) const;
+    /**
+     * @brief Get the vector of ipv4 address
+     * @return the vector of ipv4 address
+     */
+    std::vector<Ipv4Address> GetNodesAddress() const;
+    /**
+     * @brief Search the next hop after an address in the route, like
+     * DsrOptions::SearchNextHop
+     *
+     * The address is first looked for at the position given by the segments
+     * left field, and the route is only scanned if it is not found there.
+     *
+     * @param ipv4Address the address
+     * @return the next hop, the address itself if it ends the route, or
+     *         0.0.0.0 if the route does not contain the address
+     */
+    Ipv4Address SearchNextHop(Ipv4Address ipv4Address) const;
+    /**
+     * @brief Get the type of the option following the source route option
+     * @return the option type, or 0 if the packet ends with the source route option
+     */
+    uint8_t GetNextOptionType() const;
+    /**
+     * @brief Get the serialized size of the option.
+     * @return size
+     */
+    uint32_t GetSerializedSize() const;
+    /**
+     * @brief Serialize the option.
+     * @param start Buffer iterator
+     */
+    void Serialize(Buffer::Iterator start) const;
+    /**
+     * @brief Get the Alignment requirement of the option
+     * @return The required alignment
+     */
+    DsrOptionHeader::Alignment GetAlignment() const;
+
+  private:
+    /// The option type of the source route option
+    static constexpr uint8_t OPT_NUMBER = 96;
+    /// The bytes of the option, followed by the type of the next option
+    std::array<uint8_t, 2 + 255 + 1> m_data;
+    /// The number of bytes read from the packet
+    uint32_t m_size;
+};
+
 /**
  * @ingroup dsr
  * @enum ErrorType
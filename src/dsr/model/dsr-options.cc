@@ -1266,19 +1266,19 @@ DsrOptionSR::Process(Ptr<Packet> packet,
 {
     NS_LOG_FUNCTION(this << packet << dsrP << ipv4Address << source << ipv4Address << ipv4Header
                          << (uint32_t)protocol << isPromisc);
-    Ptr<Packet> p = packet->Copy();
-    // Get the number of routers' address field
-    uint8_t buf[2];
-    p->CopyData(buf, sizeof(buf));
-    uint8_t numberAddress = (buf[1] - 2) / 4;
-    DsrOptionSRHeader sourceRoute;
-    sourceRoute.SetNumberAddress(numberAddress);
-    p->RemoveHeader(sourceRoute);
-
-    // The route size saved in the source route
-    std::vector<Ipv4Address> nodeList = sourceRoute.GetNodesAddress();
+    /*
+     * Read the source route in place: the route is neither copied into a
+     * vector nor serialized again when the packet is forwarded
+     */
+    DsrSourceRouteView sourceRoute;
+    if (!sourceRoute.Read(packet) || sourceRoute.GetNumberAddress() == 0)
+    {
+        NS_LOG_LOGIC("Malformed header. Drop!");
+        m_dropTrace(packet);
+        return 0;
+    }
+    uint8_t numberAddress = sourceRoute.GetNumberAddress();
     uint8_t segsLeft = sourceRoute.GetSegmentsLeft();
-    uint8_t salvage = sourceRoute.GetSalvage();
     /*
      * Get the node from IP address and get the DSR extension object
      */
@@ -1291,7 +1291,7 @@ DsrOptionSR::Process(Ptr<Packet> packet,
     Ipv4Address destAddress = ipv4Header.GetDestination();
 
     // Get the node list destination
-    Ipv4Address destination = nodeList.back();
+    Ipv4Address destination = sourceRoute.GetNodeAddress(numberAddress - 1);
     /*
      * If it's a promiscuous receive data packet,
      * 1. see if automatic route shortening possible or not
@@ -1300,6 +1300,7 @@ DsrOptionSR::Process(Ptr<Packet> packet,
     if (isPromisc)
     {
         NS_LOG_LOGIC("We process promiscuous receipt data packet");
+        std::vector<Ipv4Address> nodeList = sourceRoute.GetNodesAddress();
         if (ContainAddressAfter(ipv4Address, destAddress, nodeList))
         {
             NS_LOG_LOGIC("Send back the gratuitous reply");
@@ -1374,11 +1375,7 @@ DsrOptionSR::Process(Ptr<Packet> packet,
         Ipv4Address nextAddress;
 
         // Get the option type value
-        uint32_t size = p->GetSize();
-        auto data = new uint8_t[size];
-        p->CopyData(data, size);
-        uint8_t optionType = 0;
-        optionType = *(data);
+        uint8_t optionType = sourceRoute.GetNextOptionType();
         /// When the option type is 160, means there is ACK request header after the source route,
         /// we need to send back acknowledgment
         if (optionType == 160)
@@ -1386,32 +1383,28 @@ DsrOptionSR::Process(Ptr<Packet> packet,
             NS_LOG_LOGIC("Remove the ack request header and add ack header to the packet");
             // Here we remove the ack packet to the previous hop
             DsrOptionAckReqHeader ackReq;
+            Ptr<Packet> p = packet->Copy();
+            p->RemoveAtStart(sourceRoute.GetSerializedSize());
             p->RemoveHeader(ackReq);
             uint16_t ackId = ackReq.GetAckId();
             /*
-             * Send back acknowledgment packet to the earlier hop
-             * If the node list is not empty, find the previous hop from the node list,
-             * otherwise, use srcAddress
+             * Send back acknowledgment packet to the earlier hop, found from the node list
              */
-            Ipv4Address ackAddress = srcAddress;
-            if (!nodeList.empty())
+            if (segsLeft > numberAddress) // The segmentsLeft field should not be larger than
+                                          // the total number of ip addresses
             {
-                if (segsLeft > numberAddress) // The segmentsLeft field should not be larger than
-                                              // the total number of ip addresses
-                {
-                    NS_LOG_LOGIC("Malformed header. Drop!");
-                    m_dropTrace(packet);
-                    return 0;
-                }
-                // -fstrict-overflow sensitive, see bug 1868
-                if (numberAddress - segsLeft < 2) // The index is invalid
-                {
-                    NS_LOG_LOGIC("Malformed header. Drop!");
-                    m_dropTrace(packet);
-                    return 0;
-                }
-                ackAddress = nodeList[numberAddress - segsLeft - 2];
+                NS_LOG_LOGIC("Malformed header. Drop!");
+                m_dropTrace(packet);
+                return 0;
             }
+            // -fstrict-overflow sensitive, see bug 1868
+            if (numberAddress - segsLeft < 2) // The index is invalid
+            {
+                NS_LOG_LOGIC("Malformed header. Drop!");
+                m_dropTrace(packet);
+                return 0;
+            }
+            Ipv4Address ackAddress = sourceRoute.GetNodeAddress(numberAddress - segsLeft - 2);
             m_ipv4Route = SetRoute(ackAddress, ipv4Address);
             NS_LOG_DEBUG("Send back ACK to the earlier hop " << ackAddress << " from us "
                                                              << ipv4Address);
@@ -1443,25 +1436,20 @@ DsrOptionSR::Process(Ptr<Packet> packet,
             return 0;
         }
 
-        DsrOptionSRHeader newSourceRoute;
-        newSourceRoute.SetSegmentsLeft(segsLeft - 1);
-        newSourceRoute.SetSalvage(salvage);
-        newSourceRoute.SetNodesAddress(nodeList);
         nextAddressIndex = numberAddress - segsLeft;
-        nextAddress = newSourceRoute.GetNodeAddress(nextAddressIndex);
+        nextAddress = sourceRoute.GetNodeAddress(nextAddressIndex);
         NS_LOG_DEBUG("The next address of source route option "
                      << nextAddress << " and the nextAddressIndex: " << (uint32_t)nextAddressIndex
                      << " and the segments left : " << (uint32_t)segsLeft);
         /*
          * Get the target Address in the node list
          */
-        Ipv4Address targetAddress = nodeList.back();
-        Ipv4Address realSource = nodeList.front();
+        Ipv4Address targetAddress = destination;
+        Ipv4Address realSource = sourceRoute.GetNodeAddress(0);
         /*
-         * Search the vector for next hop address
+         * Search the source route for next hop address
          */
-        Ipv4Address nextHop = SearchNextHop(ipv4Address, nodeList);
-        PrintVector(nodeList);
+        Ipv4Address nextHop = sourceRoute.SearchNextHop(ipv4Address);
 
         if (nextHop == "0.0.0.0")
         {
@@ -1473,8 +1461,7 @@ DsrOptionSR::Process(Ptr<Packet> packet,
         if (ipv4Address == nextHop)
         {
             NS_LOG_DEBUG("We have reached the destination");
-            newSourceRoute.SetSegmentsLeft(0);
-            return newSourceRoute.GetSerializedSize();
+            return sourceRoute.GetSerializedSize();
         }
         // Verify the multicast address, leave it here for now
         if (nextAddress.IsMulticast() || destAddress.IsMulticast())
@@ -1485,8 +1472,9 @@ DsrOptionSR::Process(Ptr<Packet> packet,
         // Set the route and forward the data packet
         SetRoute(nextAddress, ipv4Address);
         NS_LOG_DEBUG("dsr packet size " << dsrP->GetSize());
+        sourceRoute.SetSegmentsLeft(segsLeft - 1);
         dsr->ForwardPacket(dsrP,
-                           newSourceRoute,
+                           sourceRoute,
                            ipv4Header,
                            realSource,
                            nextAddress,
@@ -101,6 +101,18 @@ DsrLinkStab::Print() const
 
 typedef std::list<DsrRouteCacheEntry>::value_type route_pair;
 
+/**
+ * @brief Compute the key of a link in the link index
+ * @param a the address of the first endpoint
+ * @param b the address of the second endpoint
+ * @return the key of the link from a to b
+ */
+static uint64_t
+LinkKey(Ipv4Address a, Ipv4Address b)
+{
+    return (static_cast<uint64_t>(a.Get()) << 32) | b.Get();
+}
+
 DsrRouteCacheEntry::DsrRouteCacheEntry(IP_VECTOR const& ip, Ipv4Address dst, Time exp)
     : m_ackTimer(Timer::CANCEL_ON_DESTROY),
       m_dst(dst),
@@ -143,6 +155,8 @@ DsrRouteCache::GetTypeId()
 
 DsrRouteCache::DsrRouteCache()
     : m_vector(0),
+      m_deadHops(0),
+      m_slotsPerDst(3),
       m_maxEntriesEachDst(3),
       m_isLinkCache(false),
       m_ntimer(Timer::CANCEL_ON_DESTROY),
@@ -159,7 +173,7 @@ DsrRouteCache::~DsrRouteCache()
 {
     NS_LOG_FUNCTION_NOARGS();
     // clear the route cache when done
-    m_sortedRoutes.clear();
+    Clear();
 }
 
 void
@@ -174,28 +188,20 @@ bool
 DsrRouteCache::UpdateRouteEntry(Ipv4Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
-    auto i = m_sortedRoutes.find(dst);
-    if (i == m_sortedRoutes.end())
+    auto i = m_destinations.find(dst);
+    if (i == m_destinations.end())
     {
         NS_LOG_LOGIC("Failed to find the route entry for the destination " << dst);
         return false;
     }
-    else
-    {
-        std::list<DsrRouteCacheEntry> rtVector = i->second;
-        DsrRouteCacheEntry successEntry = rtVector.front();
-        successEntry.SetExpireTime(RouteCacheTimeout);
-        rtVector.pop_front();
-        rtVector.push_back(successEntry);
-        rtVector.sort(CompareRoutesExpire); // sort the route vector first
-        m_sortedRoutes.erase(dst);          // erase the entry first
-        /*
-         * Save the new route cache along with the destination address in map
-         */
-        auto result = m_sortedRoutes.insert(std::make_pair(dst, rtVector));
-        return result.second;
-    }
-    return false;
+    const auto block = i->second;
+    auto slots = m_routeSlots.begin() + block * m_slotsPerDst;
+    const auto count = m_routeCounts[block];
+    // refresh the first route and move it behind the routes with the same expire time
+    slots[0].expire = Simulator::Now() + RouteCacheTimeout;
+    std::rotate(slots, slots + 1, slots + count);
+    SortSlots(block);
+    return true;
 }
 
 bool
@@ -208,62 +214,55 @@ DsrRouteCache::LookupRoute(Ipv4Address id, DsrRouteCacheEntry& rt)
     }
 
     Purge(); // Purge first to remove expired entries
-    if (m_sortedRoutes.empty())
+    if (m_destinations.empty())
     {
-        NS_LOG_LOGIC("Route to " << id << " not found; m_sortedRoutes is empty");
+        NS_LOG_LOGIC("Route to " << id << " not found; the route cache is empty");
         return false;
     }
-    auto i = m_sortedRoutes.find(id);
-    if (i == m_sortedRoutes.end())
+    if (m_destinations.find(id) == m_destinations.end())
     {
         NS_LOG_LOGIC("No Direct Route to " << id << " found");
-        for (auto j = m_sortedRoutes.begin(); j != m_sortedRoutes.end(); ++j)
+        /*
+         * Look for a route going through id and keep the prefix up to id of the last one found
+         */
+        bool found = false;
+        RouteSlot subRoute;
+        uint32_t subRouteLength = 0;
+        for (const auto& [dst, block] : m_destinations)
         {
-            std::list<DsrRouteCacheEntry> rtVector =
-                j->second; // The route cache vector linked with destination address
-            /*
-             * Loop through the possibly multiple routes within the route vector
-             */
-            for (auto k = rtVector.begin(); k != rtVector.end(); ++k)
+            auto slots = m_routeSlots.cbegin() + block * m_slotsPerDst;
+            for (uint32_t k = 0; k < m_routeCounts[block]; k++)
             {
-                // return the first route in the route vector
-                DsrRouteCacheEntry::IP_VECTOR routeVector = k->GetVector();
-                DsrRouteCacheEntry::IP_VECTOR changeVector;
-
-                for (auto l = routeVector.begin(); l != routeVector.end(); ++l)
-                {
-                    changeVector.push_back(*l);
-
-                    if (*l == id)
-                    {
-                        break;
-                    }
-                }
+                const auto& record = m_paths[slots[k].path];
+                const auto hops = m_pathHops.cbegin() + record.offset;
+                const auto length = std::find(hops, hops + record.length, id) - hops + 1;
                 /*
-                 * When the changed vector is smaller in size and larger than 1, which means we
+                 * When the sub route is shorter than the route and has more than one hop, we
                  * have found a route with the destination address we are looking for
                  */
-                if ((changeVector.size() < routeVector.size()) && (changeVector.size() > 1))
+                if (length < record.length && length > 1)
                 {
-                    DsrRouteCacheEntry changeEntry; // Create the route entry
-                    changeEntry.SetVector(changeVector);
-                    changeEntry.SetDestination(id);
-                    // Use the expire time from original route entry
-                    changeEntry.SetExpireTime(k->GetExpireTime());
-                    // We need to add new route entry here
-                    std::list<DsrRouteCacheEntry> newVector;
-                    newVector.push_back(changeEntry);
-                    newVector.sort(CompareRoutesExpire); // sort the route vector first
-                    m_sortedRoutes[id] =
-                        newVector; // Only get the first sub route and add it in route cache
-                    NS_LOG_INFO("We have a sub-route to " << id << " add it in route cache");
+                    found = true;
+                    subRoute = slots[k];
+                    subRouteLength = length;
                 }
             }
         }
+        if (found)
+        {
+            const auto& record = m_paths[subRoute.path];
+            const auto hops = m_pathHops.cbegin() + record.offset;
+            // Only get the last sub route and add it in route cache
+            const auto path =
+                InternPath(DsrRouteCacheEntry::IP_VECTOR(hops, hops + subRouteLength));
+            // Use the expire time from original route entry
+            PushSlot(GetBlock(id), {path, id, subRoute.expire});
+            NS_LOG_INFO("We have a sub-route to " << id << " add it in route cache");
+        }
     }
     NS_LOG_INFO("Here we check the route cache again after updated the sub routes");
-    auto m = m_sortedRoutes.find(id);
-    if (m == m_sortedRoutes.end())
+    auto m = m_destinations.find(id);
+    if (m == m_destinations.end())
     {
         NS_LOG_LOGIC("No updated route till last time");
         return false;
@@ -271,9 +270,8 @@ DsrRouteCache::LookupRoute(Ipv4Address id, DsrRouteCacheEntry& rt)
     /*
      * We have a direct route to the destination address
      */
-    std::list<DsrRouteCacheEntry> rtVector = m->second;
-    rt = rtVector.front(); // use the first entry in the route vector
-    NS_LOG_LOGIC("Route to " << id << " with route size " << rtVector.size());
+    rt = GetEntry(m_routeSlots[m->second * m_slotsPerDst]); // use the first route
+    NS_LOG_LOGIC("Route to " << id << " with route size " << m_routeCounts[m->second]);
     return true;
 }
 
@@ -647,113 +645,82 @@ DsrRouteCache::AddRoute(DsrRouteCacheEntry& rt)
 {
     NS_LOG_FUNCTION(this);
     Purge();
-    std::list<DsrRouteCacheEntry> rtVector; // Declare the route cache entry vector
     Ipv4Address dst = rt.GetDestination();
-    std::vector<Ipv4Address> route = rt.GetVector();
+    const auto expire = Simulator::Now() + rt.GetExpireTime();
 
     NS_LOG_DEBUG("The route destination we have " << dst);
-    auto i = m_sortedRoutes.find(dst);
+    auto i = m_destinations.find(dst);
 
-    if (i == m_sortedRoutes.end())
+    if (i == m_destinations.end())
     {
-        rtVector.push_back(rt);
-        m_sortedRoutes.erase(dst); // Erase the route entries for dst first
         /**
-         * Save the new route cache along with the destination address in map
+         * Save the new route cache along with the destination address
          */
-        auto result = m_sortedRoutes.insert(std::make_pair(dst, rtVector));
-        return result.second;
+        PushSlot(GetBlock(dst), {InternPath(rt.GetVector()), dst, expire});
+        return true;
     }
 
-    rtVector = i->second;
-    NS_LOG_DEBUG("The existing route size " << rtVector.size() << " for destination address "
-                                            << dst);
+    const auto block = i->second;
+    auto slots = m_routeSlots.begin() + block * m_slotsPerDst;
+    const auto count = m_routeCounts[block];
+    NS_LOG_DEBUG("The existing route size " << count << " for destination address " << dst);
     /**
-     * @brief Drop the most aged packet when buffer reaches to max
+     * @brief Drop the most aged route when the cache is full. The routes are sorted,
+     * hence the last one is dropped, unless the new route is neither found nor added.
      */
-    if (rtVector.size() >= m_maxEntriesEachDst)
-    {
-        RemoveLastEntry(rtVector); // Drop the last entry for the sorted route cache, the route
-                                   // has already been sorted
-    }
-
-    if (FindSameRoute(rt, rtVector))
-    {
-        NS_LOG_DEBUG(
-            "Find same vector, the FindSameRoute function will update the route expire time");
-        return true;
-    }
-    else
-    {
-        // Check if the expire time for the new route has expired or not
-        if (rt.GetExpireTime().IsStrictlyPositive())
-        {
-            rtVector.push_back(rt);
-            // This sort function will sort the route cache entries based on the size of route
-            // in each of the route entries
-            rtVector.sort(CompareRoutesExpire);
-            NS_LOG_DEBUG("The first time" << rtVector.front().GetExpireTime().As(Time::S)
-                                          << " The second time "
-                                          << rtVector.back().GetExpireTime().As(Time::S));
-            NS_LOG_DEBUG("The first hop" << rtVector.front().GetVector().size()
-                                         << " The second hop "
-                                         << rtVector.back().GetVector().size());
-            m_sortedRoutes.erase(dst); // erase the route entries for dst first
-            /**
-             * Save the new route cache along with the destination address in map
-             */
-            auto result = m_sortedRoutes.insert(std::make_pair(dst, rtVector));
-            return result.second;
-        }
-        else
-        {
-            NS_LOG_INFO("The newly found route is already expired");
-        }
-    }
-
-    return false;
-}
+    const bool full = (count >= m_maxEntriesEachDst);
+    const uint32_t kept = full ? count - 1 : count;
+    const auto path = InternPath(rt.GetVector());
 
-bool
-DsrRouteCache::FindSameRoute(DsrRouteCacheEntry& rt, std::list<DsrRouteCacheEntry>& rtVector)
-{
-    NS_LOG_FUNCTION(this);
-    for (auto i = rtVector.begin(); i != rtVector.end(); ++i)
+    // interned paths are equal if and only if their indices are equal
+    for (uint32_t k = 0; k < kept; k++)
     {
-        // return the first route in the route vector
-        DsrRouteCacheEntry::IP_VECTOR routeVector = i->GetVector();
-        DsrRouteCacheEntry::IP_VECTOR newVector = rt.GetVector();
-
-        if (routeVector == newVector)
+        if (slots[k].path == path)
         {
             NS_LOG_DEBUG("Found same routes in the route cache with the vector size "
-                         << rt.GetDestination() << " " << rtVector.size());
+                         << dst << " " << count);
             NS_LOG_DEBUG("The new route expire time " << rt.GetExpireTime().As(Time::S)
                                                       << " the original expire time "
-                                                      << i->GetExpireTime().As(Time::S));
-            if (rt.GetExpireTime() > i->GetExpireTime())
+                                                      << (slots[k].expire - Simulator::Now())
+                                                             .As(Time::S));
+            ReleasePath(path); // the route already holds a reference to the path
+            slots[k].expire = std::max(slots[k].expire, expire);
+            if (full)
             {
-                i->SetExpireTime(rt.GetExpireTime());
+                EraseSlot(block, count - 1);
             }
-            m_sortedRoutes.erase(rt.GetDestination()); // erase the entry first
-            rtVector.sort(CompareRoutesExpire);        // sort the route vector first
-            /*
-             * Save the new route cache along with the destination address in map
-             */
-            auto result = m_sortedRoutes.insert(std::make_pair(rt.GetDestination(), rtVector));
-            return result.second;
+            SortSlots(block);
+            return true;
         }
     }
+
+    // Check if the expire time for the new route has expired or not
+    if (rt.GetExpireTime().IsStrictlyPositive())
+    {
+        if (full)
+        {
+            EraseSlot(block, count - 1);
+        }
+        PushSlot(block, {path, dst, expire});
+        SortSlots(block);
+        return true;
+    }
+
+    NS_LOG_INFO("The newly found route is already expired");
+    ReleasePath(path);
     return false;
 }
 
+
 bool
 DsrRouteCache::DeleteRoute(Ipv4Address dst)
 {
     NS_LOG_FUNCTION(this << dst);
     Purge(); // purge the route cache first to remove timeout entries
-    if (m_sortedRoutes.erase(dst) != 0)
+    auto i = m_destinations.find(dst);
+    if (i != m_destinations.end())
     {
+        EraseDestination(i);
         NS_LOG_LOGIC("Route deletion to " << dst << " successful");
         return true;
     }
@@ -813,109 +780,26 @@ DsrRouteCache::DeleteAllRoutesIncludeLink(Ipv4Address errorSrc,
          *
          */
         Purge();
-        if (m_sortedRoutes.empty())
+        auto i = m_linkIndex.find(LinkKey(errorSrc, unreachNode));
+        if (i == m_linkIndex.end())
         {
+            NS_LOG_DEBUG("No route contains the broken link");
             return;
         }
         /*
-         * Loop all the routes saved in the route cache
+         * Only process the destinations with a route containing the broken link
          */
-        for (auto j = m_sortedRoutes.begin(); j != m_sortedRoutes.end();)
+        std::vector<uint32_t> blocks;
+        blocks.reserve(i->second.size());
+        for (const auto& ref : i->second)
         {
-            auto jtmp = j;
-            Ipv4Address address = j->first;
-            std::list<DsrRouteCacheEntry> rtVector = j->second;
-            /*
-             * Loop all the routes for a single destination
-             */
-            for (auto k = rtVector.begin(); k != rtVector.end();)
-            {
-                // return the first route in the route vector
-                DsrRouteCacheEntry::IP_VECTOR routeVector = k->GetVector();
-                DsrRouteCacheEntry::IP_VECTOR changeVector;
-                /*
-                 * Loop the ip addresses within a single route entry
-                 */
-                for (auto i = routeVector.begin(); i != routeVector.end(); ++i)
-                {
-                    if (*i != errorSrc)
-                    {
-                        changeVector.push_back(*i);
-                    }
-                    else
-                    {
-                        changeVector.push_back(*i);
-
-                        if (*(i + 1) == unreachNode)
-                        {
-                            break;
-                        }
-                    }
-                }
-                /*
-                 * Verify if need to remove some affected links
-                 */
-                if (changeVector.size() == routeVector.size())
-                {
-                    NS_LOG_DEBUG("The route does not contain the broken link");
-                    ++k;
-                }
-                else if ((changeVector.size() < routeVector.size()) && (changeVector.size() > 1))
-                {
-                    NS_LOG_DEBUG("sub route " << m_subRoute);
-                    if (m_subRoute)
-                    {
-                        Time expire = k->GetExpireTime();
-                        /*
-                         * Remove the route first
-                         */
-                        k = rtVector.erase(k);
-                        DsrRouteCacheEntry changeEntry;
-                        changeEntry.SetVector(changeVector);
-                        Ipv4Address destination = changeVector.back();
-                        NS_LOG_DEBUG("The destination of the newly formed route "
-                                     << destination << " and the size of the route "
-                                     << changeVector.size());
-                        changeEntry.SetDestination(destination);
-                        changeEntry.SetExpireTime(
-                            expire); // Initialize the timeout value to the one it has
-                        rtVector.push_back(changeEntry); // Add the route entry to the route list
-                        NS_LOG_DEBUG("We have a sub-route to " << destination);
-                    }
-                    else
-                    {
-                        /*
-                         * Remove the route
-                         */
-                        k = rtVector.erase(k);
-                    }
-                }
-                else
-                {
-                    NS_LOG_LOGIC("Cut route unsuccessful and erase the route");
-                    /*
-                     * Remove the route
-                     */
-                    k = rtVector.erase(k);
-                }
-            }
-            ++j;
-            if (!IsLinkCache())
-            {
-                m_sortedRoutes.erase(jtmp);
-            }
-            if (!rtVector.empty())
-            {
-                /*
-                 * Save the new route cache along with the destination address in map
-                 */
-                rtVector.sort(CompareRoutesExpire);
-                m_sortedRoutes[address] = rtVector;
-            }
-            else
-            {
-                NS_LOG_DEBUG("There is no route left for that destination " << address);
-            }
+            blocks.push_back(ref.block);
+        }
+        std::sort(blocks.begin(), blocks.end());
+        blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+        for (const auto block : blocks)
+        {
+            CutRoutes(block, errorSrc, unreachNode);
         }
     }
 }
@@ -958,64 +842,33 @@ DsrRouteCache::Purge()
 {
     NS_LOG_FUNCTION(this);
     // Trying to purge the route cache
-    if (m_sortedRoutes.empty())
+    if (m_destinations.empty())
     {
         NS_LOG_DEBUG("The route cache is empty");
         return;
     }
-    for (auto i = m_sortedRoutes.begin(); i != m_sortedRoutes.end();)
+    const auto now = Simulator::Now();
+    for (auto i = m_destinations.begin(); i != m_destinations.end();)
     {
-        // Loop of route cache entry with the route size
-        auto itmp = i;
+        const auto block = i->second;
+        auto slots = m_routeSlots.cbegin() + block * m_slotsPerDst;
+        auto& count = m_routeCounts[block];
         /*
-         * The route cache entry vector
+         * The routes are sorted by decreasing expire time, hence the expired ones are the last
          */
-        Ipv4Address dst = i->first;
-        std::list<DsrRouteCacheEntry> rtVector = i->second;
-        NS_LOG_DEBUG("The route vector size of 1 " << dst << " " << rtVector.size());
-        if (!rtVector.empty())
+        while (count > 0 && slots[count - 1].expire < now)
         {
-            for (auto j = rtVector.begin(); j != rtVector.end();)
-            {
-                NS_LOG_DEBUG("The expire time of every entry with expire time "
-                             << j->GetExpireTime());
-                /*
-                 * First verify if the route has expired or not
-                 */
-                if (j->GetExpireTime().IsNegative())
-                {
-                    /*
-                     * When the expire time has passed, erase the certain route
-                     */
-                    NS_LOG_DEBUG("Erase the expired route for " << dst << " with expire time "
-                                                                << j->GetExpireTime());
-                    j = rtVector.erase(j);
-                }
-                else
-                {
-                    ++j;
-                }
-            }
-            NS_LOG_DEBUG("The route vector size of 2 " << dst << " " << rtVector.size());
-            if (!rtVector.empty())
-            {
-                ++i;
-                m_sortedRoutes.erase(itmp); // erase the entry first
-                /*
-                 * Save the new route cache along with the destination address in map
-                 */
-                m_sortedRoutes.insert(std::make_pair(dst, rtVector));
-            }
-            else
-            {
-                ++i;
-                m_sortedRoutes.erase(itmp);
-            }
+            NS_LOG_DEBUG("Erase the expired route for " << i->first << " with expire time "
+                                                        << slots[count - 1].expire - now);
+            EraseSlot(block, count - 1);
+        }
+        if (count == 0)
+        {
+            i = EraseDestination(i);
         }
         else
         {
             ++i;
-            m_sortedRoutes.erase(itmp);
         }
     }
 }
@@ -1027,13 +880,329 @@ DsrRouteCache::Print(std::ostream& os)
     Purge();
     os << "\nDSR Route Cache\n"
        << "Destination\tGateway\t\tInterface\tFlag\tExpire\tHops\n";
-    for (auto i = m_routeEntryVector.begin(); i != m_routeEntryVector.end(); ++i)
+    for (const auto& [dst, block] : m_destinations)
     {
-        i->Print(os);
+        auto slots = m_routeSlots.cbegin() + block * m_slotsPerDst;
+        for (uint32_t k = 0; k < m_routeCounts[block]; k++)
+        {
+            GetEntry(slots[k]).Print(os);
+            os << m_paths[slots[k].path].length << "\n";
+        }
     }
     os << "\n";
 }
 
+void
+DsrRouteCache::Clear()
+{
+    NS_LOG_FUNCTION(this);
+    m_destinations.clear();
+    m_routeSlots.clear();
+    m_routeCounts.clear();
+    m_blockDsts.clear();
+    m_freeBlocks.clear();
+    m_linkIndex.clear();
+    m_pathHops.clear();
+    m_paths.clear();
+    m_freePaths.clear();
+    m_pathIndex.clear();
+    m_deadHops = 0;
+}
+
+uint32_t
+DsrRouteCache::InternPath(const DsrRouteCacheEntry::IP_VECTOR& hops)
+{
+    std::size_t hash = hops.size();
+    for (const auto& hop : hops)
+    {
+        hash ^= std::hash<uint32_t>{}(hop.Get()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    auto [first, last] = m_pathIndex.equal_range(hash);
+    for (auto i = first; i != last; ++i)
+    {
+        auto& record = m_paths[i->second];
+        if (record.length == hops.size() &&
+            std::equal(hops.cbegin(), hops.cend(), m_pathHops.cbegin() + record.offset))
+        {
+            record.refCount++;
+            return i->second;
+        }
+    }
+    uint32_t path;
+    if (m_freePaths.empty())
+    {
+        path = m_paths.size();
+        m_paths.emplace_back();
+    }
+    else
+    {
+        path = m_freePaths.back();
+        m_freePaths.pop_back();
+    }
+    m_paths[path] = {static_cast<uint32_t>(m_pathHops.size()),
+                     static_cast<uint32_t>(hops.size()),
+                     1,
+                     hash};
+    m_pathHops.insert(m_pathHops.end(), hops.cbegin(), hops.cend());
+    m_pathIndex.emplace(hash, path);
+    return path;
+}
+
+void
+DsrRouteCache::ReleasePath(uint32_t path)
+{
+    auto& record = m_paths[path];
+    NS_ASSERT(record.refCount > 0);
+    if (--record.refCount > 0)
+    {
+        return;
+    }
+    auto [first, last] = m_pathIndex.equal_range(record.hash);
+    for (auto i = first; i != last; ++i)
+    {
+        if (i->second == path)
+        {
+            m_pathIndex.erase(i);
+            break;
+        }
+    }
+    m_deadHops += record.length;
+    record.length = 0;
+    m_freePaths.push_back(path);
+    // compact the arena when most of it is made of freed hops
+    if (m_deadHops > 64 && 2 * m_deadHops > m_pathHops.size())
+    {
+        CompactPaths();
+    }
+}
+
+void
+DsrRouteCache::CompactPaths()
+{
+    NS_LOG_FUNCTION(this << m_pathHops.size() << m_deadHops);
+    std::vector<Ipv4Address> hops;
+    hops.reserve(m_pathHops.size() - m_deadHops);
+    for (auto& record : m_paths)
+    {
+        const auto offset = static_cast<uint32_t>(hops.size());
+        hops.insert(hops.end(),
+                    m_pathHops.cbegin() + record.offset,
+                    m_pathHops.cbegin() + record.offset + record.length);
+        record.offset = offset;
+    }
+    m_pathHops.swap(hops);
+    m_deadHops = 0;
+}
+
+DsrRouteCacheEntry::IP_VECTOR
+DsrRouteCache::GetPath(uint32_t path) const
+{
+    const auto& record = m_paths[path];
+    return DsrRouteCacheEntry::IP_VECTOR(m_pathHops.cbegin() + record.offset,
+                                         m_pathHops.cbegin() + record.offset + record.length);
+}
+
+DsrRouteCacheEntry
+DsrRouteCache::GetEntry(const RouteSlot& slot) const
+{
+    return DsrRouteCacheEntry(GetPath(slot.path), slot.dst, slot.expire - Simulator::Now());
+}
+
+uint32_t
+DsrRouteCache::GetBlock(Ipv4Address dst)
+{
+    auto i = m_destinations.find(dst);
+    if (i != m_destinations.end())
+    {
+        return i->second;
+    }
+    uint32_t block;
+    if (m_freeBlocks.empty())
+    {
+        block = m_routeCounts.size();
+        m_routeCounts.push_back(0);
+        m_blockDsts.push_back(dst);
+        m_routeSlots.resize(m_routeSlots.size() + m_slotsPerDst);
+    }
+    else
+    {
+        block = m_freeBlocks.back();
+        m_freeBlocks.pop_back();
+        m_blockDsts[block] = dst;
+    }
+    m_destinations.emplace(dst, block);
+    return block;
+}
+
+std::map<Ipv4Address, uint32_t>::iterator
+DsrRouteCache::EraseDestination(std::map<Ipv4Address, uint32_t>::iterator it)
+{
+    const auto block = it->second;
+    while (m_routeCounts[block] > 0)
+    {
+        EraseSlot(block, m_routeCounts[block] - 1);
+    }
+    m_freeBlocks.push_back(block);
+    return m_destinations.erase(it);
+}
+
+void
+DsrRouteCache::PushSlot(uint32_t block, const RouteSlot& slot)
+{
+    auto& count = m_routeCounts[block];
+    NS_ASSERT(count < m_slotsPerDst);
+    m_routeSlots[block * m_slotsPerDst + count] = slot;
+    count++;
+    IndexLinks(block, slot.path, true);
+}
+
+void
+DsrRouteCache::EraseSlot(uint32_t block, uint32_t index)
+{
+    auto slots = m_routeSlots.begin() + block * m_slotsPerDst;
+    auto& count = m_routeCounts[block];
+    NS_ASSERT(index < count);
+    const auto path = slots[index].path;
+    IndexLinks(block, path, false);
+    std::move(slots + index + 1, slots + count, slots + index);
+    count--;
+    ReleasePath(path);
+}
+
+void
+DsrRouteCache::SortSlots(uint32_t block)
+{
+    // insertion sort, which is stable and does not allocate, of a few slots
+    auto slots = m_routeSlots.begin() + block * m_slotsPerDst;
+    for (uint32_t i = 1; i < m_routeCounts[block]; i++)
+    {
+        const auto slot = slots[i];
+        auto j = i;
+        for (; j > 0 && slots[j - 1].expire < slot.expire; j--)
+        {
+            slots[j] = slots[j - 1];
+        }
+        slots[j] = slot;
+    }
+}
+
+void
+DsrRouteCache::IndexLinks(uint32_t block, uint32_t path, bool add)
+{
+    const auto& record = m_paths[path];
+    const auto hops = m_pathHops.cbegin() + record.offset;
+    for (uint32_t i = 0; i + 1 < record.length; i++)
+    {
+        const auto key = LinkKey(hops[i], hops[i + 1]);
+        if (add)
+        {
+            m_linkIndex[key].push_back({block, path});
+            continue;
+        }
+        auto it = m_linkIndex.find(key);
+        NS_ASSERT(it != m_linkIndex.end());
+        auto& refs = it->second;
+        auto ref = std::find_if(refs.begin(), refs.end(), [block, path](const RouteRef& r) {
+            return r.block == block && r.path == path;
+        });
+        NS_ASSERT(ref != refs.end());
+        *ref = refs.back();
+        refs.pop_back();
+        if (refs.empty())
+        {
+            m_linkIndex.erase(it);
+        }
+    }
+}
+
+void
+DsrRouteCache::ResizeRouteSlots(uint32_t slotsPerDst)
+{
+    if (slotsPerDst == m_slotsPerDst)
+    {
+        return;
+    }
+    std::vector<RouteSlot> routeSlots(m_routeCounts.size() * slotsPerDst);
+    for (uint32_t block = 0; block < m_routeCounts.size(); block++)
+    {
+        // drop the routes with the earliest expire time that no longer fit
+        while (m_routeCounts[block] > slotsPerDst)
+        {
+            EraseSlot(block, m_routeCounts[block] - 1);
+        }
+        auto slots = m_routeSlots.cbegin() + block * m_slotsPerDst;
+        std::copy(slots, slots + m_routeCounts[block], routeSlots.begin() + block * slotsPerDst);
+    }
+    m_routeSlots.swap(routeSlots);
+    m_slotsPerDst = slotsPerDst;
+}
+
+void
+DsrRouteCache::CutRoutes(uint32_t block, Ipv4Address errorSrc, Ipv4Address unreachNode)
+{
+    NS_LOG_FUNCTION(this << block << errorSrc << unreachNode);
+    auto slots = m_routeSlots.begin() + block * m_slotsPerDst;
+    /*
+     * Loop all the routes for a single destination; the sub routes appended
+     * to the block are visited as well and kept, as they end with errorSrc
+     */
+    for (uint32_t k = 0; k < m_routeCounts[block];)
+    {
+        const auto& record = m_paths[slots[k].path];
+        const auto hops = m_pathHops.cbegin() + record.offset;
+        // length of the route up to the first hop of the broken link
+        uint32_t length = 0;
+        for (uint32_t i = 0; i + 1 < record.length; i++)
+        {
+            if (hops[i] == errorSrc && hops[i + 1] == unreachNode)
+            {
+                length = i + 1;
+                break;
+            }
+        }
+        /*
+         * Verify if need to remove some affected links
+         */
+        if (length == 0)
+        {
+            NS_LOG_DEBUG("The route does not contain the broken link");
+            ++k;
+        }
+        else if (length > 1 && m_subRoute)
+        {
+            DsrRouteCacheEntry::IP_VECTOR changeVector(hops, hops + length);
+            const auto expire = slots[k].expire;
+            /*
+             * Remove the route first
+             */
+            EraseSlot(block, k);
+            Ipv4Address destination = changeVector.back();
+            NS_LOG_DEBUG("The destination of the newly formed route "
+                         << destination << " and the size of the route " << changeVector.size());
+            // Add the route entry to the route list, with the timeout value it has
+            PushSlot(block, {InternPath(changeVector), destination, expire});
+            NS_LOG_DEBUG("We have a sub-route to " << destination);
+        }
+        else
+        {
+            NS_LOG_LOGIC("Cut route unsuccessful and erase the route");
+            /*
+             * Remove the route
+             */
+            EraseSlot(block, k);
+        }
+    }
+    if (m_routeCounts[block] == 0)
+    {
+        NS_LOG_DEBUG("There is no route left for that destination " << m_blockDsts[block]);
+        EraseDestination(m_destinations.find(m_blockDsts[block]));
+    }
+    else
+    {
+        SortSlots(block);
+    }
+}
+
 // ----------------------------------------------------------------------------------------------------------
 /**
  * This part of code maintains an Acknowledgment id cache for next hop and remove duplicate ids
@@ -38,11 +38,13 @@
 #include "ns3/simulator.h"
 #include "ns3/timer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <map>
 #include <stdint.h>
 #include <sys/types.h>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -457,6 +459,7 @@ class DsrRouteCache : public Object
     void SetMaxEntriesEachDst(uint32_t entries)
     {
         m_maxEntriesEachDst = entries;
+        ResizeRouteSlots(std::max<uint32_t>(entries, 1));
     }
 
     /**
@@ -597,13 +600,6 @@ class DsrRouteCache : public Object
      * @param route the route list
      */
     void PrintRouteVector(std::list<DsrRouteCacheEntry> route);
-    /**
-     * @brief Find the same route in the route cache
-     * @param rt entry with destination address dst, if exists
-     * @param rtVector the route vector
-     * @return true if same
-     */
-    bool FindSameRoute(DsrRouteCacheEntry& rt, std::list<DsrRouteCacheEntry>& rtVector);
     /**
      * @brief Delete the route with certain destination address
      * @param dst the destination address of the routes that should be deleted
@@ -623,10 +619,7 @@ class DsrRouteCache : public Object
                                     Ipv4Address node);
 
     /// Delete all entries from routing table
-    void Clear()
-    {
-        m_routeEntryVector.erase(m_routeEntryVector.begin(), m_routeEntryVector.end());
-    }
+    void Clear();
 
     /// Delete all outdated entries and invalidate valid entry if Lifetime is expired
     void Purge();
@@ -763,15 +756,128 @@ class DsrRouteCache : public Object
     Time m_initStability;           ///< initial stability
     Time m_minLifeTime;             ///< minimum lifetime
     Time m_useExtends;              ///< use extend
+    /*
+     * Define the path cache data structure. The routes to each destination are
+     * stored in a block of fixed-capacity slots, sorted by decreasing expire time.
+     * The hop sequences of the routes are interned into a shared arena, and each
+     * link is indexed to the routes whose path contains it.
+     */
+
+    /// Hop sequence interned into the path arena
+    struct PathRecord
+    {
+        uint32_t offset;   ///< index of the first hop in m_pathHops
+        uint32_t length;   ///< number of hops
+        uint32_t refCount; ///< number of route slots using the path
+        std::size_t hash;  ///< hash of the hops
+    };
+
+    /// Route to a destination
+    struct RouteSlot
+    {
+        uint32_t path;   ///< index of the interned path
+        Ipv4Address dst; ///< destination of the route entry
+        Time expire;     ///< absolute expire time
+    };
+
+    /// Reference to the route slots of a block using a path
+    struct RouteRef
+    {
+        uint32_t block; ///< block of the destination
+        uint32_t path;  ///< index of the interned path
+    };
+
+    /**
+     * @brief Intern a hop sequence, taking a reference to it
+     * @param hops the hop sequence
+     * @return the index of the interned path
+     */
+    uint32_t InternPath(const DsrRouteCacheEntry::IP_VECTOR& hops);
+    /**
+     * @brief Drop a reference to an interned path, freeing it when unused
+     * @param path the index of the interned path
+     */
+    void ReleasePath(uint32_t path);
+    /**
+     * @brief Move the live paths to the beginning of the arena
+     */
+    void CompactPaths();
+    /**
+     * @brief Get an interned path
+     * @param path the index of the interned path
+     * @return the hop sequence
+     */
+    DsrRouteCacheEntry::IP_VECTOR GetPath(uint32_t path) const;
+    /**
+     * @brief Build a route cache entry from a slot
+     * @param slot the route slot
+     * @return the route cache entry
+     */
+    DsrRouteCacheEntry GetEntry(const RouteSlot& slot) const;
+    /**
+     * @brief Get the block of the routes to a destination, allocating it if needed
+     * @param dst the destination
+     * @return the block index
+     */
+    uint32_t GetBlock(Ipv4Address dst);
+    /**
+     * @brief Remove the routes to a destination
+     * @param it the destination to remove
+     * @return the next destination
+     */
+    std::map<Ipv4Address, uint32_t>::iterator EraseDestination(
+        std::map<Ipv4Address, uint32_t>::iterator it);
+    /**
+     * @brief Append a route to a block, taking ownership of a path reference
+     * @param block the block index
+     * @param slot the route
+     */
+    void PushSlot(uint32_t block, const RouteSlot& slot);
+    /**
+     * @brief Remove a route from a block, keeping the order of the other routes
+     * @param block the block index
+     * @param index the index of the route in the block
+     */
+    void EraseSlot(uint32_t block, uint32_t index);
+    /**
+     * @brief Stable sort of the routes of a block by decreasing expire time
+     * @param block the block index
+     */
+    void SortSlots(uint32_t block);
+    /**
+     * @brief Add or remove the references from the links of a path to a block
+     * @param block the block index
+     * @param path the index of the interned path
+     * @param add whether to add or remove the references
+     */
+    void IndexLinks(uint32_t block, uint32_t path, bool add);
+    /**
+     * @brief Change the capacity of the blocks
+     * @param slotsPerDst the new number of slots of each block
+     */
+    void ResizeRouteSlots(uint32_t slotsPerDst);
     /**
-     * Define the route cache data structure
+     * @brief Process the routes of a block for a broken link
+     * @param block the block index
+     * @param errorSrc the source of the broken link
+     * @param unreachNode the destination of the broken link
      */
-    typedef std::list<DsrRouteCacheEntry> routeEntryVector;
+    void CutRoutes(uint32_t block, Ipv4Address errorSrc, Ipv4Address unreachNode);
 
-    std::map<Ipv4Address, routeEntryVector>
-        m_sortedRoutes; ///< Map the ipv4Address to route entry vector
+    std::vector<Ipv4Address> m_pathHops;                        ///< arena of the interned hops
+    std::vector<PathRecord> m_paths;                            ///< interned paths
+    std::vector<uint32_t> m_freePaths;                          ///< unused path records
+    std::unordered_multimap<std::size_t, uint32_t> m_pathIndex; ///< interned paths by hash
+    uint32_t m_deadHops; ///< number of hops of the freed paths in the arena
 
-    routeEntryVector m_routeEntryVector; ///< Define the route vector
+    std::vector<RouteSlot> m_routeSlots;            ///< blocks of route slots
+    std::vector<uint32_t> m_routeCounts;            ///< number of routes in each block
+    std::vector<Ipv4Address> m_blockDsts;           ///< destination of each block
+    std::vector<uint32_t> m_freeBlocks;             ///< unused blocks
+    uint32_t m_slotsPerDst;                         ///< number of slots of each block
+    std::map<Ipv4Address, uint32_t> m_destinations; ///< block of each destination
+    /// Routes using each link, indexed by the addresses of its endpoints
+    std::unordered_map<uint64_t, std::vector<RouteRef>> m_linkIndex;
 
     uint32_t m_maxEntriesEachDst; ///< number of entries for each destination
 
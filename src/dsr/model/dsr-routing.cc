@@ -572,9 +572,29 @@ DsrRouting::DoDispose()
             }
         }
     }
+    m_timerWheel.CancelAll();
+    m_addressReqTimer.clear();
+    m_nonPropReqTimer.clear();
+    m_addressForwardTimer.clear();
+    m_passiveAckTimer.clear();
+    m_linkAckTimer.clear();
     IpL4Protocol::DoDispose();
 }
 
+template <typename K>
+bool
+DsrRouting::CancelTimer(std::map<K, TimerWheel::Id>& timers, const K& key)
+{
+    auto timer = timers.find(key);
+    if (timer == timers.end())
+    {
+        return false;
+    }
+    m_timerWheel.Cancel(timer->second);
+    timers.erase(timer);
+    return true;
+}
+
 void
 DsrRouting::SetNode(Ptr<Node> node)
 {
@@ -1848,8 +1868,7 @@ DsrRouting::IncreaseRetransTimer()
         {
             if (nextHop == j->first.m_nextHop)
             {
-                NS_LOG_DEBUG("The network delay left is " << j->second.GetDelayLeft());
-                j->second.SetDelay(j->second.GetDelayLeft() + m_retransIncr);
+                NS_LOG_DEBUG("The network delay left is " << m_timerWheel.GetDelayLeft(j->second));
             }
         }
     }
@@ -2237,24 +2256,13 @@ DsrRouting::CancelLinkPacketTimer(DsrMaintainBuffEntry& mb)
     // TODO if find the linkkey, we need to remove it
 
     // Find the network acknowledgment timer
-    auto i = m_linkAckTimer.find(linkKey);
-    if (i == m_linkAckTimer.end())
+    if (!CancelTimer(m_linkAckTimer, linkKey))
     {
         NS_LOG_INFO("did not find the link timer");
     }
     else
     {
         NS_LOG_INFO("did find the link timer");
-        /*
-         * Schedule the packet retry
-         * Push back the nextHop, source, destination address
-         */
-        m_linkAckTimer[linkKey].Cancel();
-        if (m_linkAckTimer[linkKey].IsRunning())
-        {
-            NS_LOG_INFO("Timer not canceled");
-        }
-        m_linkAckTimer.erase(linkKey);
     }
 
     // Erase the maintenance entry
@@ -2286,24 +2294,13 @@ DsrRouting::CancelNetworkPacketTimer(DsrMaintainBuffEntry& mb)
                          << mb.GetNextHop() << " source " << mb.GetSrc() << " destination "
                          << mb.GetDst() << " segsLeft " << (uint32_t)mb.GetSegsLeft());
     // Find the network acknowledgment timer
-    auto i = m_addressForwardTimer.find(networkKey);
-    if (i == m_addressForwardTimer.end())
+    if (!CancelTimer(m_addressForwardTimer, networkKey))
     {
         NS_LOG_INFO("did not find the packet timer");
     }
     else
     {
         NS_LOG_INFO("did find the packet timer");
-        /*
-         * Schedule the packet retry
-         * Push back the nextHop, source, destination address
-         */
-        m_addressForwardTimer[networkKey].Cancel();
-        if (m_addressForwardTimer[networkKey].IsRunning())
-        {
-            NS_LOG_INFO("Timer not canceled");
-        }
-        m_addressForwardTimer.erase(networkKey);
     }
     // Erase the maintenance entry
     // yet this does not check the segments left value here
@@ -2326,24 +2323,14 @@ DsrRouting::CancelPassivePacketTimer(DsrMaintainBuffEntry& mb)
     m_passiveCnt[passiveKey] = 0;
     m_passiveCnt.erase(passiveKey);
 
-    // Find the passive acknowledgment timer
-    auto j = m_passiveAckTimer.find(passiveKey);
-    if (j == m_passiveAckTimer.end())
+    // Find and cancel the passive acknowledgment timer
+    if (!CancelTimer(m_passiveAckTimer, passiveKey))
     {
         NS_LOG_INFO("did not find the passive timer");
     }
     else
     {
         NS_LOG_INFO("find the passive timer");
-        /*
-         * Cancel passive acknowledgment timer
-         */
-        m_passiveAckTimer[passiveKey].Cancel();
-        if (m_passiveAckTimer[passiveKey].IsRunning())
-        {
-            NS_LOG_INFO("Timer not canceled");
-        }
-        m_passiveAckTimer.erase(passiveKey);
     }
 }
 
@@ -2550,15 +2537,13 @@ DsrRouting::ScheduleLinkPacketRetry(DsrMaintainBuffEntry& mb, uint8_t protocol)
     linkKey.m_ourAdd = mb.GetOurAdd();
     linkKey.m_nextHop = mb.GetNextHop();
 
-    if (m_linkAckTimer.find(linkKey) == m_linkAckTimer.end())
-    {
-        Timer timer(Timer::CANCEL_ON_DESTROY);
-        m_linkAckTimer[linkKey] = timer;
-    }
-    m_linkAckTimer[linkKey].SetFunction(&DsrRouting::LinkScheduleTimerExpire, this);
-    m_linkAckTimer[linkKey].Cancel();
-    m_linkAckTimer[linkKey].SetArguments(mb, protocol);
-    m_linkAckTimer[linkKey].Schedule(m_linkAckTimeout);
+    auto& timer = m_linkAckTimer[linkKey];
+    m_timerWheel.Cancel(timer);
+    timer = m_timerWheel.Schedule(m_linkAckTimeout,
+                                  &DsrRouting::LinkScheduleTimerExpire,
+                                  this,
+                                  mb,
+                                  protocol);
 }
 
 void
@@ -2579,16 +2564,14 @@ DsrRouting::SchedulePassivePacketRetry(DsrMaintainBuffEntry& mb, uint8_t protoco
     passiveKey.m_destination = mb.GetDst();
     passiveKey.m_segsLeft = mb.GetSegsLeft();
 
-    if (m_passiveAckTimer.find(passiveKey) == m_passiveAckTimer.end())
-    {
-        Timer timer(Timer::CANCEL_ON_DESTROY);
-        m_passiveAckTimer[passiveKey] = timer;
-    }
     NS_LOG_DEBUG("The passive acknowledgment option for data packet");
-    m_passiveAckTimer[passiveKey].SetFunction(&DsrRouting::PassiveScheduleTimerExpire, this);
-    m_passiveAckTimer[passiveKey].Cancel();
-    m_passiveAckTimer[passiveKey].SetArguments(mb, protocol);
-    m_passiveAckTimer[passiveKey].Schedule(m_passiveAckTimeout);
+    auto& timer = m_passiveAckTimer[passiveKey];
+    m_timerWheel.Cancel(timer);
+    timer = m_timerWheel.Schedule(m_passiveAckTimeout,
+                                  &DsrRouting::PassiveScheduleTimerExpire,
+                                  this,
+                                  mb,
+                                  protocol);
 }
 
 void
@@ -2632,23 +2615,19 @@ DsrRouting::ScheduleNetworkPacketRetry(DsrMaintainBuffEntry& mb, bool isFirst, u
             NS_LOG_ERROR("Failed to enqueue packet retry");
         }
 
-        if (m_addressForwardTimer.find(networkKey) == m_addressForwardTimer.end())
-        {
-            Timer timer(Timer::CANCEL_ON_DESTROY);
-            m_addressForwardTimer[networkKey] = timer;
-        }
-
         // After m_tryPassiveAcks, schedule the packet retransmission using network acknowledgment
         // option
-        m_addressForwardTimer[networkKey].SetFunction(&DsrRouting::NetworkScheduleTimerExpire,
-                                                      this);
-        m_addressForwardTimer[networkKey].Cancel();
-        m_addressForwardTimer[networkKey].SetArguments(newEntry, protocol);
+        auto& timer = m_addressForwardTimer[networkKey];
+        m_timerWheel.Cancel(timer);
         NS_LOG_DEBUG("The packet retries time for " << newEntry.GetAckId() << " is "
                                                     << m_sendRetries << " and the delay time is "
                                                     << Time(2 * m_nodeTraversalTime).As(Time::S));
         // Back-off mechanism
-        m_addressForwardTimer[networkKey].Schedule(Time(2 * m_nodeTraversalTime));
+        timer = m_timerWheel.Schedule(Time(2 * m_nodeTraversalTime),
+                                      &DsrRouting::NetworkScheduleTimerExpire,
+                                      this,
+                                      newEntry,
+                                      protocol);
     }
     else
     {
@@ -2691,15 +2670,17 @@ DsrRouting::ScheduleNetworkPacketRetry(DsrMaintainBuffEntry& mb, bool isFirst, u
 
         // After m_tryPassiveAcks, schedule the packet retransmission using network acknowledgment
         // option
-        m_addressForwardTimer[networkKey].SetFunction(&DsrRouting::NetworkScheduleTimerExpire,
-                                                      this);
-        m_addressForwardTimer[networkKey].Cancel();
-        m_addressForwardTimer[networkKey].SetArguments(mb, protocol);
+        auto& timer = m_addressForwardTimer[networkKey];
+        m_timerWheel.Cancel(timer);
         NS_LOG_DEBUG("The packet retries time for "
                      << mb.GetAckId() << " is " << m_sendRetries << " and the delay time is "
                      << Time(2 * m_sendRetries * m_nodeTraversalTime).As(Time::S));
         // Back-off mechanism
-        m_addressForwardTimer[networkKey].Schedule(Time(2 * m_sendRetries * m_nodeTraversalTime));
+        timer = m_timerWheel.Schedule(Time(2 * m_sendRetries * m_nodeTraversalTime),
+                                      &DsrRouting::NetworkScheduleTimerExpire,
+                                      this,
+                                      mb,
+                                      protocol);
     }
 }
 
@@ -2718,13 +2699,8 @@ DsrRouting::LinkScheduleTimerExpire(DsrMaintainBuffEntry& mb, uint8_t protocol)
     lk.m_ourAdd = mb.GetOurAdd();
     lk.m_nextHop = mb.GetNextHop();
 
-    // Cancel passive ack timer
-    m_linkAckTimer[lk].Cancel();
-    if (m_linkAckTimer[lk].IsRunning())
-    {
-        NS_LOG_DEBUG("Timer not canceled");
-    }
-    m_linkAckTimer.erase(lk);
+    // Cancel link ack timer
+    CancelTimer(m_linkAckTimer, lk);
 
     // Increase the send retry times
     m_linkRetries = m_linkCnt[lk];
@@ -2764,12 +2740,7 @@ DsrRouting::PassiveScheduleTimerExpire(DsrMaintainBuffEntry& mb, uint8_t protoco
     pk.m_segsLeft = mb.GetSegsLeft();
 
     // Cancel passive ack timer
-    m_passiveAckTimer[pk].Cancel();
-    if (m_passiveAckTimer[pk].IsRunning())
-    {
-        NS_LOG_DEBUG("Timer not canceled");
-    }
-    m_passiveAckTimer.erase(pk);
+    CancelTimer(m_passiveAckTimer, pk);
 
     // Increase the send retry times
     m_passiveRetries = m_passiveCnt[pk];
@@ -2833,7 +2804,7 @@ DsrRouting::NetworkScheduleTimerExpire(DsrMaintainBuffEntry& mb, uint8_t protoco
 
 void
 DsrRouting::ForwardPacket(Ptr<const Packet> packet,
-                          DsrOptionSRHeader& sourceRoute,
+                          const DsrSourceRouteView& sourceRoute,
                           const Ipv4Header& ipv4Header,
                           Ipv4Address source,
                           Ipv4Address nextHop,
@@ -2841,8 +2812,8 @@ DsrRouting::ForwardPacket(Ptr<const Packet> packet,
                           uint8_t protocol,
                           Ptr<Ipv4Route> route)
 {
-    NS_LOG_FUNCTION(this << packet << sourceRoute << source << nextHop << targetAddress
-                         << (uint32_t)protocol << route);
+    NS_LOG_FUNCTION(this << packet << (uint32_t)sourceRoute.GetSegmentsLeft() << source << nextHop
+                         << targetAddress << (uint32_t)protocol << route);
     NS_ASSERT_MSG(!m_downTarget.IsNull(), "Error, DsrRouting cannot send downward");
 
     DsrRoutingHeader dsrRoutingHeader;
@@ -3079,7 +3050,7 @@ DsrRouting::CancelRreqTimer(Ipv4Address dst, bool isRemove)
 {
     NS_LOG_FUNCTION(this << dst << isRemove);
     // Cancel the non propagation request timer if found
-    if (m_nonPropReqTimer.find(dst) == m_nonPropReqTimer.end())
+    if (!CancelTimer(m_nonPropReqTimer, dst))
     {
         NS_LOG_DEBUG("Did not find the non-propagation timer");
     }
@@ -3087,16 +3058,9 @@ DsrRouting::CancelRreqTimer(Ipv4Address dst, bool isRemove)
     {
         NS_LOG_DEBUG("did find the non-propagation timer");
     }
-    m_nonPropReqTimer[dst].Cancel();
-
-    if (m_nonPropReqTimer[dst].IsRunning())
-    {
-        NS_LOG_DEBUG("Timer not canceled");
-    }
-    m_nonPropReqTimer.erase(dst);
 
     // Cancel the address request timer if found
-    if (m_addressReqTimer.find(dst) == m_addressReqTimer.end())
+    if (!CancelTimer(m_addressReqTimer, dst))
     {
         NS_LOG_DEBUG("Did not find the propagation timer");
     }
@@ -3104,12 +3068,6 @@ DsrRouting::CancelRreqTimer(Ipv4Address dst, bool isRemove)
     {
         NS_LOG_DEBUG("did find the propagation timer");
     }
-    m_addressReqTimer[dst].Cancel();
-    if (m_addressReqTimer[dst].IsRunning())
-    {
-        NS_LOG_DEBUG("Timer not canceled");
-    }
-    m_addressReqTimer.erase(dst);
     /*
      * If the route request is scheduled to remove the route request entry
      * Remove the route request entry with the route retry times done for certain destination
@@ -3134,40 +3092,29 @@ DsrRouting::ScheduleRreqRetry(Ptr<Packet> packet,
     if (nonProp)
     {
         // The nonProp route request is only sent out only and is already used
-        if (m_nonPropReqTimer.find(dst) == m_nonPropReqTimer.end())
-        {
-            Timer timer(Timer::CANCEL_ON_DESTROY);
-            m_nonPropReqTimer[dst] = timer;
-        }
         std::vector<Ipv4Address> address;
         address.push_back(source);
         address.push_back(dst);
-        m_nonPropReqTimer[dst].SetFunction(&DsrRouting::RouteRequestTimerExpire, this);
-        m_nonPropReqTimer[dst].Cancel();
-        m_nonPropReqTimer[dst].SetArguments(packet, address, requestId, protocol);
-        m_nonPropReqTimer[dst].Schedule(m_nonpropRequestTimeout);
+        auto& timer = m_nonPropReqTimer[dst];
+        m_timerWheel.Cancel(timer);
+        timer = m_timerWheel.Schedule(m_nonpropRequestTimeout,
+                                      &DsrRouting::RouteRequestTimerExpire,
+                                      this,
+                                      packet,
+                                      address,
+                                      requestId,
+                                      protocol);
     }
     else
     {
         // Cancel the non propagation request timer if found
-        m_nonPropReqTimer[dst].Cancel();
-        if (m_nonPropReqTimer[dst].IsRunning())
-        {
-            NS_LOG_DEBUG("Timer not canceled");
-        }
-        m_nonPropReqTimer.erase(dst);
+        CancelTimer(m_nonPropReqTimer, dst);
 
-        if (m_addressReqTimer.find(dst) == m_addressReqTimer.end())
-        {
-            Timer timer(Timer::CANCEL_ON_DESTROY);
-            m_addressReqTimer[dst] = timer;
-        }
         std::vector<Ipv4Address> address;
         address.push_back(source);
         address.push_back(dst);
-        m_addressReqTimer[dst].SetFunction(&DsrRouting::RouteRequestTimerExpire, this);
-        m_addressReqTimer[dst].Cancel();
-        m_addressReqTimer[dst].SetArguments(packet, address, requestId, protocol);
+        auto& timer = m_addressReqTimer[dst];
+        m_timerWheel.Cancel(timer);
         Time rreqDelay;
         // back off mechanism for sending route requests
         if (m_rreqTable->GetRreqCnt(dst))
@@ -3188,13 +3135,19 @@ DsrRouting::ScheduleRreqRetry(Ptr<Packet> packet,
         {
             // use the max request period
             NS_LOG_LOGIC("The max request delay time " << m_maxRequestPeriod.As(Time::S));
-            m_addressReqTimer[dst].Schedule(m_maxRequestPeriod);
+            rreqDelay = m_maxRequestPeriod;
         }
         else
         {
             NS_LOG_LOGIC("The request delay time " << rreqDelay.As(Time::S));
-            m_addressReqTimer[dst].Schedule(rreqDelay);
         }
+        timer = m_timerWheel.Schedule(rreqDelay,
+                                      &DsrRouting::RouteRequestTimerExpire,
+                                      this,
+                                      packet,
+                                      address,
+                                      requestId,
+                                      protocol);
     }
 }
 
@@ -3543,9 +3496,8 @@ DsrRouting::Receive(Ptr<Packet> p, const Ipv4Header& ip, Ptr<Ipv4Interface> inco
     /*
      * Peek data to get the option type as well as length and segmentsLeft field
      */
-    uint32_t size = p->GetSize();
-    auto data = new uint8_t[size];
-    p->CopyData(data, size);
+    uint8_t data[4] = {0};
+    p->CopyData(data, sizeof(data));
 
     uint8_t optionType = 0;
     uint8_t optionLength = 0;
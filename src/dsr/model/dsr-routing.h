@@ -51,6 +51,7 @@
 #include "ns3/random-variable-stream.h"
 #include "ns3/socket.h"
 #include "ns3/test.h"
+#include "ns3/timer-wheel.h"
 #include "ns3/timer.h"
 #include "ns3/traced-callback.h"
 #include "ns3/wifi-mac.h"
@@ -526,7 +527,7 @@ class DsrRouting : public IpL4Protocol
      * @param route route
      */
     void ForwardPacket(Ptr<const Packet> packet,
-                       DsrOptionSRHeader& sourceRoute,
+                       const DsrSourceRouteView& sourceRoute,
                        const Ipv4Header& ipv4Header,
                        Ipv4Address source,
                        Ipv4Address destination,
@@ -689,6 +690,17 @@ class DsrRouting : public IpL4Protocol
      * @param isRemove whether to remove the route request entry or not
      */
     void CancelRreqTimer(Ipv4Address dst, bool isRemove);
+
+    /**
+     * Cancel the timer of a key, if any, and remove it from its map
+     *
+     * @tparam K \deduced The type of the key
+     * @param timers the map of the timers
+     * @param key the key
+     * @return true if the map had a timer for the key
+     */
+    template <typename K>
+    bool CancelTimer(std::map<K, TimerWheel::Id>& timers, const K& key);
     /**
      * @brief Schedule the route request retry.
      * @param packet the original packet
@@ -894,21 +906,28 @@ class DsrRouting : public IpL4Protocol
 
     std::vector<Ipv4Address> m_finalRoute; ///< The route cache
 
-    std::map<Ipv4Address, Timer> m_addressReqTimer; ///< Map IP address + RREQ timer.
+    TimerWheel m_timerWheel; ///< Per-destination and per-packet timers, on a single event
+
+    /// Map IP address + RREQ timer, armed on m_timerWheel.
+    std::map<Ipv4Address, TimerWheel::Id> m_addressReqTimer;
 
-    std::map<Ipv4Address, Timer> m_nonPropReqTimer; ///< Map IP address + RREQ timer.
+    /// Map IP address + non-propagating RREQ timer, armed on m_timerWheel.
+    std::map<Ipv4Address, TimerWheel::Id> m_nonPropReqTimer;
 
-    std::map<NetworkKey, Timer> m_addressForwardTimer; ///< Map network key + forward timer.
+    /// Map network key + forward timer, armed on m_timerWheel.
+    std::map<NetworkKey, TimerWheel::Id> m_addressForwardTimer;
 
     std::map<NetworkKey, uint32_t> m_addressForwardCnt; ///< Map network key + forward counts.
 
     std::map<PassiveKey, uint32_t> m_passiveCnt; ///< Map packet key + passive forward counts.
 
-    std::map<PassiveKey, Timer> m_passiveAckTimer; ///< The timer for passive acknowledgment
+    /// The timer for passive acknowledgment, armed on m_timerWheel.
+    std::map<PassiveKey, TimerWheel::Id> m_passiveAckTimer;
 
     std::map<LinkKey, uint32_t> m_linkCnt; ///< Map packet key + link forward counts.
 
-    std::map<LinkKey, Timer> m_linkAckTimer; ///< The timer for link acknowledgment
+    /// The timer for link acknowledgment, armed on m_timerWheel.
+    std::map<LinkKey, TimerWheel::Id> m_linkAckTimer;
 
     Ptr<dsr::DsrRouteCache>
         m_routeCache; ///< A "drop-front" queue used by the routing layer to cache routes found.
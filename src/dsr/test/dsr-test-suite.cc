@@ -255,6 +255,88 @@ DsrSRHeaderTest::DoRun()
     NS_TEST_EXPECT_MSG_EQ(bytes, 16, "Total RREP is 16 bytes long");
 }
 
+// -----------------------------------------------------------------------------
+/**
+ * @ingroup dsr-test
+ * @ingroup tests
+ *
+ * @class DsrSourceRouteViewTest
+ * @brief Unit test for the view of the Source Route read from a packet
+ */
+class DsrSourceRouteViewTest : public TestCase
+{
+  public:
+    DsrSourceRouteViewTest();
+    ~DsrSourceRouteViewTest() override;
+    void DoRun() override;
+};
+
+DsrSourceRouteViewTest::DsrSourceRouteViewTest()
+    : TestCase("DSR Source Route view")
+{
+}
+
+DsrSourceRouteViewTest::~DsrSourceRouteViewTest()
+{
+}
+
+void
+DsrSourceRouteViewTest::DoRun()
+{
+    const std::vector<Ipv4Address> nodeList{
+        Ipv4Address("1.1.1.0"),
+        Ipv4Address("1.1.1.1"),
+        Ipv4Address("1.1.1.2"),
+        Ipv4Address("1.1.1.3"),
+    };
+
+    dsr::DsrOptionSRHeader h;
+    h.SetNodesAddress(nodeList);
+    h.SetSalvage(1);
+    h.SetSegmentsLeft(2);
+
+    Ptr<Packet> p = Create<Packet>();
+    dsr::DsrRoutingHeader header;
+    header.AddDsrOption(h);
+    header.AddDsrOption(dsr::DsrOptionAckReqHeader());
+    p->AddHeader(header);
+    p->RemoveAtStart(8);
+
+    dsr::DsrSourceRouteView view;
+    NS_TEST_ASSERT_MSG_EQ(view.Read(p), true, "The packet starts with a source route");
+    NS_TEST_EXPECT_MSG_EQ(view.GetNumberAddress(), 4, "trivial");
+    NS_TEST_EXPECT_MSG_EQ(view.GetSalvage(), 1, "trivial");
+    NS_TEST_EXPECT_MSG_EQ(view.GetSegmentsLeft(), 2, "trivial");
+    NS_TEST_EXPECT_MSG_EQ(view.GetSerializedSize(), h.GetSerializedSize(), "Same size");
+    NS_TEST_EXPECT_MSG_EQ(view.GetNextOptionType(), 160, "The ack request follows");
+    NS_TEST_EXPECT_MSG_EQ((view.GetNodesAddress() == nodeList), true, "Same route");
+
+    // the next hops of the nodes of the route, before and after the expected one
+    NS_TEST_EXPECT_MSG_EQ(view.SearchNextHop(nodeList[1]), nodeList[2], "Expected node");
+    NS_TEST_EXPECT_MSG_EQ(view.SearchNextHop(nodeList[0]), nodeList[1], "Earlier node");
+    NS_TEST_EXPECT_MSG_EQ(view.SearchNextHop(nodeList[3]), nodeList[3], "Destination");
+    NS_TEST_EXPECT_MSG_EQ(view.SearchNextHop(Ipv4Address("1.1.1.9")),
+                          Ipv4Address("0.0.0.0"),
+                          "Not in the route");
+
+    // the forwarded option only differs from the received one by its segments left
+    view.SetSegmentsLeft(1);
+    dsr::DsrRoutingHeader forwarded;
+    forwarded.AddDsrOption(view);
+    Ptr<Packet> q = Create<Packet>();
+    q->AddHeader(forwarded);
+    q->RemoveAtStart(8);
+    dsr::DsrOptionSRHeader h2;
+    h2.SetNumberAddress(4);
+    q->RemoveHeader(h2);
+    NS_TEST_EXPECT_MSG_EQ(h2.GetSegmentsLeft(), 1, "Updated segments left");
+    NS_TEST_EXPECT_MSG_EQ(h2.GetSalvage(), 1, "trivial");
+    NS_TEST_EXPECT_MSG_EQ((h2.GetNodesAddress() == nodeList), true, "Same route");
+
+    Ptr<Packet> empty = Create<Packet>(2);
+    NS_TEST_EXPECT_MSG_EQ(view.Read(empty), false, "Not a source route");
+}
+
 // -----------------------------------------------------------------------------
 /**
  * @ingroup dsr-test
@@ -464,6 +546,125 @@ DsrCacheEntryTest::DoRun()
     NS_TEST_EXPECT_MSG_EQ(rcache->DeleteRoute(Ipv4Address("1.1.1.1")), false, "trivial");
 }
 
+// -----------------------------------------------------------------------------
+/**
+ * @ingroup dsr-test
+ * @ingroup tests
+ *
+ * @class DsrPathCacheTest
+ * @brief Unit test for the DSR path cache
+ */
+class DsrPathCacheTest : public TestCase
+{
+  public:
+    DsrPathCacheTest();
+    ~DsrPathCacheTest() override;
+    void DoRun() override;
+    /// Check that the expired routes have been purged
+    void CheckPurge();
+
+    Ptr<dsr::DsrRouteCache> m_rcache; ///< route cache
+};
+
+DsrPathCacheTest::DsrPathCacheTest()
+    : TestCase("DSR path cache")
+{
+}
+
+DsrPathCacheTest::~DsrPathCacheTest()
+{
+}
+
+void
+DsrPathCacheTest::DoRun()
+{
+    m_rcache = CreateObject<dsr::DsrRouteCache>();
+    m_rcache->SetCacheType("PathCache");
+    m_rcache->SetSubRoute(true);
+    m_rcache->SetCacheTimeout(Seconds(100));
+    m_rcache->SetMaxEntriesEachDst(2);
+
+    auto path = [](std::vector<uint8_t> hops) {
+        std::vector<Ipv4Address> ip;
+        for (auto hop : hops)
+        {
+            ip.emplace_back(Ipv4Address(0x0a000000 | hop));
+        }
+        return ip;
+    };
+    const Ipv4Address dst("10.0.0.9");
+    dsr::DsrRouteCacheEntry rt;
+
+    dsr::DsrRouteCacheEntry a(path({1, 2, 9}), dst, Seconds(5));
+    dsr::DsrRouteCacheEntry b(path({1, 3, 9}), dst, Seconds(10));
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(a), true, "new destination");
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(b), true, "new route");
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(dst, rt), true, "route to dst");
+    NS_TEST_EXPECT_MSG_EQ((rt.GetVector() == path({1, 3, 9})), true, "latest expiring first");
+
+    // the same route is refreshed, not duplicated
+    a.SetExpireTime(Seconds(20));
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(a), true, "same route");
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(dst, rt), true, "route to dst");
+    NS_TEST_EXPECT_MSG_EQ((rt.GetVector() == path({1, 2, 9})), true, "refreshed route first");
+    NS_TEST_EXPECT_MSG_EQ(rt.GetExpireTime(), Seconds(20), "refreshed expire time");
+
+    // the cache is full, so the earliest expiring route is dropped
+    dsr::DsrRouteCacheEntry c(path({1, 4, 9}), dst, Seconds(15));
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(c), true, "route added to a full cache");
+    m_rcache->DeleteAllRoutesIncludeLink(Ipv4Address("10.0.0.1"),
+                                         Ipv4Address("10.0.0.2"),
+                                         Ipv4Address("10.0.0.1"));
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(dst, rt), true, "route to dst");
+    NS_TEST_EXPECT_MSG_EQ((rt.GetVector() == path({1, 4, 9})), true, "route left after break");
+    m_rcache->DeleteAllRoutesIncludeLink(Ipv4Address("10.0.0.1"),
+                                         Ipv4Address("10.0.0.4"),
+                                         Ipv4Address("10.0.0.1"));
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->LookupRoute(dst, rt), false, "all routes broken");
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(c), true, "new destination");
+
+    // a route to an intermediate node is taken from a longer route
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(Ipv4Address("10.0.0.4"), rt), true, "sub-route");
+    NS_TEST_EXPECT_MSG_EQ((rt.GetVector() == path({1, 4})), true, "sub-route path");
+    NS_TEST_EXPECT_MSG_EQ(rt.GetDestination(), Ipv4Address("10.0.0.4"), "sub-route dst");
+
+    // a broken route is truncated at the link
+    const Ipv4Address dst2("10.0.0.7");
+    dsr::DsrRouteCacheEntry e(path({1, 5, 6, 7}), dst2, Seconds(8));
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->AddRoute(e), true, "new destination");
+    m_rcache->DeleteAllRoutesIncludeLink(Ipv4Address("10.0.0.6"),
+                                         Ipv4Address("10.0.0.7"),
+                                         Ipv4Address("10.0.0.1"));
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(dst2, rt), true, "truncated route");
+    NS_TEST_EXPECT_MSG_EQ((rt.GetVector() == path({1, 5, 6})), true, "truncated path");
+    NS_TEST_EXPECT_MSG_EQ(rt.GetExpireTime(), Seconds(8), "truncated route expire time");
+
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->UpdateRouteEntry(dst), true, "update route");
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(dst, rt), true, "route to dst");
+    NS_TEST_EXPECT_MSG_EQ(rt.GetExpireTime(), Seconds(100), "updated expire time");
+
+    Simulator::Schedule(Seconds(30), &DsrPathCacheTest::CheckPurge, this);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+DsrPathCacheTest::CheckPurge()
+{
+    dsr::DsrRouteCacheEntry rt;
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->LookupRoute(Ipv4Address("10.0.0.7"), rt),
+                          false,
+                          "expired route");
+    NS_TEST_ASSERT_MSG_EQ(m_rcache->LookupRoute(Ipv4Address("10.0.0.9"), rt),
+                          true,
+                          "updated route");
+    NS_TEST_EXPECT_MSG_EQ(rt.GetExpireTime(), Seconds(70), "updated route expire time");
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->DeleteRoute(Ipv4Address("10.0.0.9")), true, "delete route");
+    NS_TEST_EXPECT_MSG_EQ(m_rcache->LookupRoute(Ipv4Address("10.0.0.4"), rt),
+                          false,
+                          "no route left");
+}
+
 // -----------------------------------------------------------------------------
 /**
  * @ingroup dsr-test
@@ -625,10 +826,12 @@ class DsrTestSuite : public TestSuite
         AddTestCase(new DsrRreqHeaderTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrRrepHeaderTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrSRHeaderTest, TestCase::Duration::QUICK);
+        AddTestCase(new DsrSourceRouteViewTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrRerrHeaderTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrAckReqHeaderTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrAckHeaderTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrCacheEntryTest, TestCase::Duration::QUICK);
+        AddTestCase(new DsrPathCacheTest, TestCase::Duration::QUICK);
         AddTestCase(new DsrSendBuffTest, TestCase::Duration::QUICK);
     }
 } g_dsrTestSuite;
@@ -8,6 +8,7 @@
 
 #include "ns3/basic-energy-source-helper.h"
 #include "ns3/basic-energy-source.h"
+#include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/device-energy-model-container.h"
 #include "ns3/double.h"
@@ -21,6 +22,7 @@
 #include "ns3/yans-wifi-helper.h"
 
 #include <cmath>
+#include <iterator>
 
 using namespace ns3;
 using namespace ns3::energy;
@@ -409,6 +411,161 @@ BasicEnergyDepletionTest::DepletionTestCase(double simTimeS, double updateInterv
 
 // -------------------------------------------------------------------------- //
 
+/**
+ * Test case checking that the lazy update mode of WifiRadioEnergyModel drains
+ * a BasicEnergySource exactly as the default mode does.
+ */
+class LazyEnergyUpdateTest
+{
+  public:
+    LazyEnergyUpdateTest();
+    virtual ~LazyEnergyUpdateTest();
+
+    /**
+     * Runs an eager and a lazy radio through the same sequence of states until
+     * their energy is depleted.
+     * @return true is some error happened.
+     */
+    bool DoRun();
+
+  private:
+    /**
+     * @param lazy Whether the radio energy model is in lazy update mode.
+     * @return A new energy source, installed on a new node with a radio energy model.
+     */
+    Ptr<BasicEnergySource> CreateSource(bool lazy);
+
+    /**
+     * Switch both radios to the next state of the sequence and schedule the
+     * next state change.
+     */
+    void NextState();
+
+    /**
+     * Compare the energy remaining in the sources of both radios.
+     */
+    void CompareRemainingEnergy();
+
+    double m_initialEnergyJ;              //!< initial energy of the sources, in Joules
+    Time m_stateDuration;                 //!< duration of each state
+    Time m_simTime;                       //!< simulation time
+    double m_tolerance;                   //!< tolerance for energy comparisons, in Joules
+    uint32_t m_stateIndex;                //!< index of the next state of the sequence
+    bool m_error;                         //!< whether an error was found
+    Ptr<BasicEnergySource> m_eagerSource; //!< energy source of the eager radio
+    Ptr<BasicEnergySource> m_lazySource;  //!< energy source of the lazy radio
+    Ptr<WifiRadioEnergyModel> m_eager;    //!< radio energy model updating its source eagerly
+    Ptr<WifiRadioEnergyModel> m_lazy;     //!< radio energy model updating its source lazily
+};
+
+LazyEnergyUpdateTest::LazyEnergyUpdateTest()
+{
+    m_initialEnergyJ = 10;
+    m_stateDuration = MicroSeconds(700);
+    m_simTime = Seconds(15);
+    m_tolerance = 1.0e-6;
+    m_stateIndex = 0;
+    m_error = false;
+}
+
+LazyEnergyUpdateTest::~LazyEnergyUpdateTest()
+{
+}
+
+Ptr<BasicEnergySource>
+LazyEnergyUpdateTest::CreateSource(bool lazy)
+{
+    Ptr<Node> node = CreateObject<Node>();
+    Ptr<BasicEnergySource> source = CreateObject<BasicEnergySource>();
+    source->SetInitialEnergy(m_initialEnergyJ);
+    node->AggregateObject(source);
+    source->SetNode(node);
+
+    Ptr<WifiRadioEnergyModel> model = CreateObject<WifiRadioEnergyModel>();
+    model->SetAttribute("LazyUpdate", BooleanValue(lazy));
+    model->SetEnergySource(source);
+    source->AppendDeviceEnergyModel(model);
+    return source;
+}
+
+void
+LazyEnergyUpdateTest::NextState()
+{
+    static const WifiPhyState states[] = {WifiPhyState::RX,
+                                          WifiPhyState::IDLE,
+                                          WifiPhyState::TX,
+                                          WifiPhyState::CCA_BUSY,
+                                          WifiPhyState::SLEEP,
+                                          WifiPhyState::IDLE};
+    const auto state = states[m_stateIndex++ % std::size(states)];
+    m_eager->ChangeState(static_cast<int>(state));
+    m_lazy->ChangeState(static_cast<int>(state));
+    if (m_eager->GetCurrentState() != m_lazy->GetCurrentState())
+    {
+        std::cerr << "Radio states differ at " << Simulator::Now().As(Time::S) << std::endl;
+        m_error = true;
+    }
+    Simulator::Schedule(m_stateDuration, &LazyEnergyUpdateTest::NextState, this);
+}
+
+void
+LazyEnergyUpdateTest::CompareRemainingEnergy()
+{
+    const auto eagerEnergy = m_eagerSource->GetRemainingEnergy();
+    const auto lazyEnergy = m_lazySource->GetRemainingEnergy();
+    NS_LOG_DEBUG("Remaining energy at " << Simulator::Now().As(Time::S) << " is " << eagerEnergy
+                                        << " (eager) and " << lazyEnergy << " (lazy)");
+    if (std::abs(eagerEnergy - lazyEnergy) > m_tolerance)
+    {
+        std::cerr << "Incorrect lazy remaining energy!" << std::endl;
+        m_error = true;
+    }
+    Simulator::Schedule(Seconds(1), &LazyEnergyUpdateTest::CompareRemainingEnergy, this);
+}
+
+bool
+LazyEnergyUpdateTest::DoRun()
+{
+    m_eagerSource = CreateSource(false);
+    m_lazySource = CreateSource(true);
+    m_eager = DynamicCast<WifiRadioEnergyModel>(
+        m_eagerSource->FindDeviceEnergyModels("ns3::WifiRadioEnergyModel").Get(0));
+    m_lazy = DynamicCast<WifiRadioEnergyModel>(
+        m_lazySource->FindDeviceEnergyModels("ns3::WifiRadioEnergyModel").Get(0));
+
+    Simulator::Schedule(m_stateDuration, &LazyEnergyUpdateTest::NextState, this);
+    Simulator::Schedule(Seconds(1), &LazyEnergyUpdateTest::CompareRemainingEnergy, this);
+    Simulator::Stop(m_simTime);
+    Simulator::Run();
+
+    // both radios have been switched off at the same time, after draining all the energy
+    if (m_eager->GetCurrentState() != WifiPhyState::OFF ||
+        m_lazy->GetCurrentState() != WifiPhyState::OFF)
+    {
+        std::cerr << "Radios are not switched off!" << std::endl;
+        m_error = true;
+    }
+    const auto eagerConsumption = m_eager->GetTotalEnergyConsumption();
+    const auto lazyConsumption = m_lazy->GetTotalEnergyConsumption();
+    NS_LOG_DEBUG("Eager total energy consumption is " << eagerConsumption);
+    NS_LOG_DEBUG("Lazy total energy consumption is " << lazyConsumption);
+    if (std::abs(eagerConsumption - lazyConsumption) > m_tolerance ||
+        std::abs(lazyConsumption - m_initialEnergyJ) > m_tolerance)
+    {
+        std::cerr << "Incorrect lazy total energy consumption!" << std::endl;
+        m_error = true;
+    }
+
+    Simulator::Destroy();
+    m_eagerSource = nullptr;
+    m_lazySource = nullptr;
+    m_eager = nullptr;
+    m_lazy = nullptr;
+    return m_error;
+}
+
+// -------------------------------------------------------------------------- //
+
 int
 main(int argc, char** argv)
 {
@@ -424,5 +581,11 @@ main(int argc, char** argv)
         return 1;
     }
 
+    LazyEnergyUpdateTest testLazyEnergyUpdate;
+    if (testLazyEnergyUpdate.DoRun())
+    {
+        return 1;
+    }
+
     return 0;
 }
@@ -212,9 +212,9 @@ void
 BasicEnergySource::CalculateRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
-    double totalCurrentA = CalculateTotalCurrent();
     Time duration = Simulator::Now() - m_lastUpdateTime;
     NS_ASSERT(duration.IsPositive());
+    double totalCurrentA = CalculateTotalCurrent(duration);
     // energy = current * voltage * time
     double energyToDecreaseJ = (totalCurrentA * m_supplyVoltageV * duration).GetSeconds();
     NS_ASSERT(m_remainingEnergyJ >= energyToDecreaseJ);
@@ -45,6 +45,13 @@ DeviceEnergyModel::GetCurrentA() const
     return DoGetCurrentA();
 }
 
+double
+DeviceEnergyModel::CollectAverageCurrentA(Time duration)
+{
+    NS_LOG_FUNCTION(this << duration);
+    return DoCollectAverageCurrentA(duration);
+}
+
 /*
  * Private function starts here.
  */
@@ -56,5 +63,12 @@ DeviceEnergyModel::DoGetCurrentA() const
     return 0.0;
 }
 
+double
+DeviceEnergyModel::DoCollectAverageCurrentA(Time duration)
+{
+    NS_LOG_FUNCTION(this << duration);
+    return DoGetCurrentA();
+}
+
 } // namespace energy
 } // namespace ns3
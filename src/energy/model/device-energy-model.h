@@ -10,6 +10,7 @@
 #define DEVICE_ENERGY_MODEL_H
 
 #include "ns3/node.h"
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/type-id.h"
@@ -82,6 +83,18 @@ class DeviceEnergyModel : public Object
      */
     double GetCurrentA() const;
 
+    /**
+     * @param duration Length of the interval ending now.
+     * @returns Average current draw of the device over the interval, in Ampere.
+     *
+     * This function is called from the EnergySource when it integrates the
+     * current drawn since its previous update. Devices deferring the updates of
+     * the energy source account the returned charge as collected, hence this
+     * function must be called once per update. A duration of zero returns the
+     * current draw at the device in its current state.
+     */
+    double CollectAverageCurrentA(Time duration);
+
     /**
      * This function is called by the EnergySource object when energy stored in
      * the energy source is depleted. Should be implemented by child classes.
@@ -110,6 +123,18 @@ class DeviceEnergyModel : public Object
      * overwritten.
      */
     virtual double DoGetCurrentA() const;
+
+    /**
+     * @param duration Length of the interval ending now.
+     * @returns The current draw at the device in its current state, in Ampere.
+     *
+     * Devices notifying the energy source of each state change draw a constant
+     * current between two updates of the source, hence this default. Devices that
+     * defer the updates of the energy source must override this method, return
+     * the average of the current they drew over the given interval and reset the
+     * charge they accumulated.
+     */
+    virtual double DoCollectAverageCurrentA(Time duration);
 };
 
 } // namespace energy
@@ -151,14 +151,14 @@ EnergySource::DoDispose()
  */
 
 double
-EnergySource::CalculateTotalCurrent()
+EnergySource::CalculateTotalCurrent(Time duration)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << duration);
     double totalCurrentA = 0.0;
     DeviceEnergyModelContainer::Iterator i;
     for (i = m_models.Begin(); i != m_models.End(); i++)
     {
-        totalCurrentA += (*i)->GetCurrentA();
+        totalCurrentA += (*i)->CollectAverageCurrentA(duration);
     }
 
     if (!m_harvesters.empty())
@@ -209,9 +209,17 @@ class EnergySource : public Object
 
   protected:
     /**
-     * @returns Total current draw from all DeviceEnergyModels.
+     * @param duration Length of the interval, ending now, since the previous
+     *        update of the energy source.
+     * @returns Total current draw from all DeviceEnergyModels, averaged over
+     *          the interval, minus the current provided by the harvesters.
+     *
+     * Energy sources integrating the current drawn since their previous update
+     * must pass the length of that interval, so that device models deferring
+     * their updates (see DeviceEnergyModel::CollectAverageCurrentA) are accounted
+     * for correctly. A duration of zero returns the instantaneous current draw.
      */
-    double CalculateTotalCurrent();
+    double CalculateTotalCurrent(Time duration = Time());
 
     /**
      * This function notifies all DeviceEnergyModel of energy depletion event. It
@@ -256,12 +256,12 @@ GenericBatteryModel::CalculateRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
 
-    double totalCurrentA = CalculateTotalCurrent();
-
     m_energyUpdateLapseTime = Simulator::Now() - m_lastUpdateTime;
 
     NS_ASSERT(m_energyUpdateLapseTime.GetSeconds() >= 0);
 
+    double totalCurrentA = CalculateTotalCurrent(m_energyUpdateLapseTime);
+
     // Calculate i* (current step response)
     Time batteryResponseConstant = Seconds(30);
 
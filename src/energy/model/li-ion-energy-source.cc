@@ -258,9 +258,9 @@ void
 LiIonEnergySource::CalculateRemainingEnergy()
 {
     NS_LOG_FUNCTION(this);
-    double totalCurrentA = CalculateTotalCurrent();
     Time duration = Simulator::Now() - m_lastUpdateTime;
     NS_ASSERT(duration.GetSeconds() >= 0);
+    double totalCurrentA = CalculateTotalCurrent(duration);
     // energy = current * voltage * time
     double energyToDecreaseJ = totalCurrentA * m_supplyVoltageV * duration.GetSeconds();
 
@@ -0,0 +1,105 @@
+#
+# SPDX-License-Identifier: GPL-2.0-only
+#
+
+"""! Print the time-binned per-flow statistics written by FlowSeriesWriter.
+
+The file is memory-mapped, and only the chunks of the requested flow are read.
+
+Usage: python3 flowmon-parse-series.py FILE [FLOW_ID]
+"""
+
+import mmap
+import struct
+import sys
+
+## Layout of FlowSeriesWriter::FileHeader
+FILE_HEADER = struct.Struct("=8sIIqq")
+## Layout of FlowSeriesWriter::ChunkHeader
+CHUNK_HEADER = struct.Struct("=qII")
+## Layout of FlowSeriesWriter::IndexEntry
+INDEX_ENTRY = struct.Struct("=qQII")
+## Layout of FlowSeriesWriter::Footer
+FOOTER = struct.Struct("=QQq8s")
+## Magic number of the file
+MAGIC = b"ns3fser\0"
+## Names and types of the columns of a chunk
+COLUMNS = [
+    ("flowId", "I"),
+    ("txPackets", "I"),
+    ("rxPackets", "I"),
+    ("lostPackets", "I"),
+    ("txBytes", "Q"),
+    ("rxBytes", "Q"),
+    ("delaySum", "q"),
+    ("jitterSum", "q"),
+]
+
+
+def read_series(data):
+    """! Read the chunks of a flow series file.
+    @param data The memory-mapped file.
+    @return The bin width and the end of the last bin in nanoseconds, and a generator of
+    (bin start, rows) tuples, where rows is a dict of column arrays.
+    """
+    magic, version, n_columns, bin_width, start = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != 1 or n_columns != len(COLUMNS):
+        raise ValueError("not a flow series file")
+    index_offset, n_chunks, end, magic = FOOTER.unpack_from(data, len(data) - FOOTER.size)
+    if magic != MAGIC:
+        raise ValueError("incomplete flow series file (the simulation was not destroyed)")
+
+    def chunks():
+        for i in range(n_chunks):
+            bin_start, offset, n_rows, _ = INDEX_ENTRY.unpack_from(
+                data, index_offset + i * INDEX_ENTRY.size
+            )
+            position = offset + CHUNK_HEADER.size
+            rows = {}
+            for name, fmt in COLUMNS:
+                column = struct.Struct("=%d%s" % (n_rows, fmt))
+                rows[name] = column.unpack_from(data, position)
+                position += column.size
+            yield bin_start, rows
+
+    return bin_width, end, chunks()
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    flow = int(argv[2]) if len(argv) > 2 else None
+    with open(argv[1], "rb") as f:
+        data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        bin_width, end, chunks = read_series(data)
+        # flows which already received a packet in a previous bin
+        received = set()
+        print("time(s)  flow  throughput(Mbit/s)  delay(ms)  jitter(ms)  lost")
+        for bin_start, rows in chunks:
+            # the last bin ends with the simulation, and may be shorter than the others
+            width = min(bin_width, end - bin_start)
+            for i, flow_id in enumerate(rows["flowId"]):
+                rx = rows["rxPackets"][i]
+                # the first packet received by a flow has no jitter
+                jitter_samples = rx if flow_id in received else rx - 1
+                if rx > 0:
+                    received.add(flow_id)
+                if flow is not None and flow_id != flow:
+                    continue
+                throughput = rows["rxBytes"][i] * 8e3 / width
+                delay = rows["delaySum"][i] / rx / 1e6 if rx > 0 else float("nan")
+                jitter = (
+                    rows["jitterSum"][i] / jitter_samples / 1e6
+                    if jitter_samples > 0
+                    else float("nan")
+                )
+                print(
+                    "%7.3f  %4d  %18.3f  %9.3f  %10.3f  %4d"
+                    % (bin_start / 1e9, flow_id, throughput, delay, jitter, rows["lostPackets"][i])
+                )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
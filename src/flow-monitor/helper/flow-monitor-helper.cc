@@ -8,6 +8,7 @@
 
 #include "flow-monitor-helper.h"
 
+#include "ns3/abort.h"
 #include "ns3/flow-monitor.h"
 #include "ns3/ipv4-flow-classifier.h"
 #include "ns3/ipv4-flow-probe.h"
@@ -28,6 +29,11 @@ FlowMonitorHelper::FlowMonitorHelper()
 
 FlowMonitorHelper::~FlowMonitorHelper()
 {
+    if (m_seriesWriter)
+    {
+        m_seriesWriter->Close();
+        m_seriesWriter = nullptr;
+    }
     if (m_flowMonitor)
     {
         m_flowMonitor->Dispose();
@@ -160,4 +166,13 @@ FlowMonitorHelper::SerializeToXmlFile(std::string fileName,
     }
 }
 
+void
+FlowMonitorHelper::EnableTimeSeries(std::string fileName, Time binWidth)
+{
+    NS_ABORT_MSG_UNLESS(m_flowMonitor, "EnableTimeSeries() requires an installed FlowMonitor");
+    m_seriesWriter = CreateObject<FlowSeriesWriter>();
+    NS_ABORT_MSG_UNLESS(m_seriesWriter->Open(m_flowMonitor, fileName, binWidth),
+                        "Unable to create " << fileName);
+}
+
 } // namespace ns3
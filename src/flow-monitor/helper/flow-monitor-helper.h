@@ -10,6 +10,7 @@
 
 #include "ns3/flow-classifier.h"
 #include "ns3/flow-monitor.h"
+#include "ns3/flow-series-writer.h"
 #include "ns3/node-container.h"
 #include "ns3/object-factory.h"
 
@@ -108,11 +109,21 @@ class FlowMonitorHelper
      */
     void SerializeToXmlFile(std::string fileName, bool enableHistograms, bool enableProbes);
 
+    /**
+     * Write time-binned per-flow statistics to a columnar binary file while the
+     * simulation runs, with bins starting now (see FlowSeriesWriter).  The
+     * file is completed by Simulator::Destroy.
+     * @param fileName name or path of the output file that will be created
+     * @param binWidth the width of the bins
+     */
+    void EnableTimeSeries(std::string fileName, Time binWidth);
+
   private:
     ObjectFactory m_monitorFactory;        //!< Object factory
     Ptr<FlowMonitor> m_flowMonitor;        //!< the FlowMonitor object
     Ptr<FlowClassifier> m_flowClassifier4; //!< the FlowClassifier object for IPv4
     Ptr<FlowClassifier> m_flowClassifier6; //!< the FlowClassifier object for IPv6
+    Ptr<FlowSeriesWriter> m_seriesWriter;  //!< the writer of the time-binned statistics
 };
 
 } // namespace ns3
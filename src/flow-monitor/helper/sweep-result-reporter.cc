@@ -0,0 +1,122 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "sweep-result-reporter.h"
+
+#include "ns3/environment-variable.h"
+#include "ns3/ipv4-flow-classifier.h"
+#include "ns3/log.h"
+
+#include <cstring>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SweepResultReporter");
+
+SweepResultReporter::SweepResultReporter()
+{
+    NS_LOG_FUNCTION(this);
+    auto [found, path] = EnvironmentVariable::Get(RING_ENV_VAR);
+    if (found && !path.empty() && !m_ring.Open(path))
+    {
+        NS_LOG_WARN("Cannot attach to the sweep result ring " << path << ", reporting disabled");
+    }
+}
+
+SweepResultReporter::~SweepResultReporter()
+{
+    NS_LOG_FUNCTION(this);
+    Finish();
+}
+
+bool
+SweepResultReporter::IsEnabled() const
+{
+    return m_ring.IsOpen();
+}
+
+void
+SweepResultReporter::Push(const SweepRecord& record)
+{
+    if (!m_ring.Push(record))
+    {
+        m_ring.Close();
+    }
+}
+
+void
+SweepResultReporter::ReportFlowMonitor(Ptr<FlowMonitor> monitor, Ptr<FlowClassifier> classifier)
+{
+    NS_LOG_FUNCTION(this << monitor << classifier);
+    if (!IsEnabled())
+    {
+        return;
+    }
+    monitor->CheckForLostPackets();
+    Ptr<Ipv4FlowClassifier> ipv4Classifier = DynamicCast<Ipv4FlowClassifier>(classifier);
+    for (const auto& [flowId, stats] : monitor->GetFlowStats())
+    {
+        SweepRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.kind = SweepRecord::FLOW;
+        record.flowId = flowId;
+        std::ostringstream oss;
+        if (ipv4Classifier)
+        {
+            auto t = ipv4Classifier->FindFlow(flowId);
+            oss << t.sourceAddress << ":" << t.sourcePort << "->" << t.destinationAddress << ":"
+                << t.destinationPort << "/" << +t.protocol;
+        }
+        else
+        {
+            oss << "flow " << flowId;
+        }
+        record.SetName(oss.str());
+        record.txPackets = stats.txPackets;
+        record.rxPackets = stats.rxPackets;
+        record.lostPackets = stats.lostPackets;
+        record.txBytes = stats.txBytes;
+        record.rxBytes = stats.rxBytes;
+        record.delaySumNs = stats.delaySum.GetNanoSeconds();
+        record.jitterSumNs = stats.jitterSum.GetNanoSeconds();
+        record.timeFirstTxPacketNs = stats.timeFirstTxPacket.GetNanoSeconds();
+        record.timeLastRxPacketNs = stats.timeLastRxPacket.GetNanoSeconds();
+        Push(record);
+    }
+}
+
+void
+SweepResultReporter::ReportCounter(const std::string& name, double value)
+{
+    NS_LOG_FUNCTION(this << name << value);
+    if (!IsEnabled())
+    {
+        return;
+    }
+    SweepRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.kind = SweepRecord::COUNTER;
+    record.SetName(name);
+    record.value = value;
+    Push(record);
+}
+
+void
+SweepResultReporter::Finish()
+{
+    NS_LOG_FUNCTION(this);
+    if (!IsEnabled())
+    {
+        return;
+    }
+    SweepRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.kind = SweepRecord::END;
+    Push(record);
+    m_ring.Close();
+}
+
+} // namespace ns3
@@ -0,0 +1,92 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef SWEEP_RESULT_REPORTER_H
+#define SWEEP_RESULT_REPORTER_H
+
+#include "ns3/flow-classifier.h"
+#include "ns3/flow-monitor.h"
+#include "ns3/sweep-result-ring.h"
+
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * @ingroup flow-monitor
+ * @brief Helper used by a simulation program to report its results to the sweep driver
+ *
+ * When a program is launched by the sweep driver (utils/sweep-runner.cc), the
+ * NS3_SWEEP_RING environment variable holds the path of a SweepResultRing
+ * shared with the driver. The reporter attaches to it and pushes the per-flow
+ * statistics of a FlowMonitor and any named counter as fixed-layout records,
+ * which the driver aggregates while the runs are in progress.
+ *
+ * When the program is run standalone, the reporter is disabled and all the
+ * Report* methods do nothing, so scenarios can use it unconditionally.
+ *
+ * @code
+ *   SweepResultReporter reporter;
+ *   ...
+ *   Simulator::Run();
+ *   reporter.ReportFlowMonitor(flowmonHelper.GetMonitor(), flowmonHelper.GetClassifier());
+ *   reporter.ReportCounter("macTxDrops", macTxDrops);
+ *   reporter.Finish();
+ * @endcode
+ */
+class SweepResultReporter
+{
+  public:
+    /// Environment variable holding the path of the ring shared with the driver
+    static constexpr const char* RING_ENV_VAR = "NS3_SWEEP_RING";
+
+    SweepResultReporter();
+    ~SweepResultReporter();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SweepResultReporter(const SweepResultReporter&) = delete;
+    SweepResultReporter& operator=(const SweepResultReporter&) = delete;
+
+    /**
+     * @return true if the program has been launched by the sweep driver
+     */
+    bool IsEnabled() const;
+
+    /**
+     * Report the statistics of all the flows of a FlowMonitor
+     *
+     * CheckForLostPackets() is called on the monitor before the statistics are read.
+     *
+     * @param monitor the FlowMonitor
+     * @param classifier the classifier used to describe the flows (can be null)
+     */
+    void ReportFlowMonitor(Ptr<FlowMonitor> monitor, Ptr<FlowClassifier> classifier);
+
+    /**
+     * Report a named counter
+     * @param name the name of the counter (truncated to SweepRecord::NAME_SIZE - 1 characters)
+     * @param value the value of the counter
+     */
+    void ReportCounter(const std::string& name, double value);
+
+    /**
+     * Report the end of the run; further reports are ignored.
+     * Called by the destructor if not called explicitly.
+     */
+    void Finish();
+
+  private:
+    /**
+     * Push a record to the ring, disabling the reporter if the driver is gone
+     * @param record the record
+     */
+    void Push(const SweepRecord& record);
+
+    SweepResultRing m_ring; //!< ring shared with the sweep driver
+};
+
+} // namespace ns3
+
+#endif /* SWEEP_RESULT_REPORTER_H */
@@ -0,0 +1,197 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "flow-series-writer.h"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <cstring>
+#include <utility>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("FlowSeriesWriter");
+
+NS_OBJECT_ENSURE_REGISTERED(FlowSeriesWriter);
+
+/// Value of FlowSeriesWriter::FileHeader::magic and FlowSeriesWriter::Footer::magic
+static const char FLOW_SERIES_MAGIC[8] = {'n', 's', '3', 'f', 's', 'e', 'r', '\0'};
+
+TypeId
+FlowSeriesWriter::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::FlowSeriesWriter")
+                            .SetParent<Object>()
+                            .SetGroupName("FlowMonitor")
+                            .AddConstructor<FlowSeriesWriter>();
+    return tid;
+}
+
+FlowSeriesWriter::FlowSeriesWriter()
+    : m_offset(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+FlowSeriesWriter::~FlowSeriesWriter()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+FlowSeriesWriter::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+    Object::DoDispose();
+}
+
+bool
+FlowSeriesWriter::Open(Ptr<FlowMonitor> monitor, const std::string& fileName, Time binWidth)
+{
+    NS_LOG_FUNCTION(this << monitor << fileName << binWidth);
+    NS_ASSERT_MSG(binWidth.IsStrictlyPositive(), "The bins must have a positive width");
+    NS_ASSERT(!m_file.is_open());
+    m_file.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+    {
+        NS_LOG_ERROR("Cannot create " << fileName);
+        return false;
+    }
+    m_monitor = monitor;
+    m_binWidth = binWidth;
+    m_binStart = Simulator::Now();
+    m_last.clear();
+    m_index.clear();
+
+    FileHeader header;
+    std::memcpy(header.magic, FLOW_SERIES_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.nColumns = N_COLUMNS;
+    header.binWidth = binWidth.GetNanoSeconds();
+    header.start = m_binStart.GetNanoSeconds();
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_offset = sizeof(header);
+
+    m_binEvent = Simulator::Schedule(m_binWidth, &FlowSeriesWriter::EndBin, this);
+    Simulator::ScheduleDestroy(&FlowSeriesWriter::Close, Ptr<FlowSeriesWriter>(this));
+    return true;
+}
+
+void
+FlowSeriesWriter::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_file.is_open())
+    {
+        return;
+    }
+    m_binEvent.Cancel();
+    if (Simulator::Now() > m_binStart)
+    {
+        WriteChunk();
+    }
+
+    Footer footer;
+    footer.indexOffset = m_offset;
+    footer.nChunks = m_index.size();
+    footer.end = Simulator::Now().GetNanoSeconds();
+    std::memcpy(footer.magic, FLOW_SERIES_MAGIC, sizeof(footer.magic));
+    m_file.write(reinterpret_cast<const char*>(m_index.data()),
+                 m_index.size() * sizeof(IndexEntry));
+    m_file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    m_file.close();
+
+    m_monitor = nullptr;
+    m_last.clear();
+    m_index.clear();
+    m_chunk.clear();
+}
+
+void
+FlowSeriesWriter::EndBin()
+{
+    NS_LOG_FUNCTION(this);
+    WriteChunk();
+    m_binStart += m_binWidth;
+    m_binEvent = Simulator::Schedule(m_binWidth, &FlowSeriesWriter::EndBin, this);
+}
+
+void
+FlowSeriesWriter::WriteChunk()
+{
+    std::vector<std::pair<FlowId, Totals>> rows;
+    for (const auto& [flowId, stats] : m_monitor->GetFlowStats())
+    {
+        Totals current = {stats.txPackets,
+                          stats.rxPackets,
+                          stats.lostPackets,
+                          stats.txBytes,
+                          stats.rxBytes,
+                          stats.delaySum.GetNanoSeconds(),
+                          stats.jitterSum.GetNanoSeconds()};
+        Totals& last = m_last[flowId];
+        // the statistics start over after FlowMonitor::ResetAllStats
+        if (current.txPackets < last.txPackets || current.rxPackets < last.rxPackets ||
+            current.lostPackets < last.lostPackets)
+        {
+            last = Totals{};
+        }
+        Totals delta = {current.txPackets - last.txPackets,
+                        current.rxPackets - last.rxPackets,
+                        current.lostPackets - last.lostPackets,
+                        current.txBytes - last.txBytes,
+                        current.rxBytes - last.rxBytes,
+                        current.delaySum - last.delaySum,
+                        current.jitterSum - last.jitterSum};
+        last = current;
+        if (delta.txPackets != 0 || delta.rxPackets != 0 || delta.lostPackets != 0)
+        {
+            rows.emplace_back(flowId, delta);
+        }
+    }
+    if (rows.empty())
+    {
+        return;
+    }
+
+    ChunkHeader header;
+    header.binStart = m_binStart.GetNanoSeconds();
+    header.nRows = rows.size();
+    header.padding = 0;
+    m_chunk.resize(sizeof(header) + rows.size() * (4 * sizeof(uint32_t) + 4 * sizeof(uint64_t)));
+    char* p = m_chunk.data();
+    std::memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+    auto column = [&rows, &p](auto field) {
+        for (const auto& [flowId, delta] : rows)
+        {
+            auto value = field(flowId, delta);
+            std::memcpy(p, &value, sizeof(value));
+            p += sizeof(value);
+        }
+    };
+    column([](FlowId flowId, const Totals&) { return uint32_t{flowId}; });
+    column([](FlowId, const Totals& delta) { return delta.txPackets; });
+    column([](FlowId, const Totals& delta) { return delta.rxPackets; });
+    column([](FlowId, const Totals& delta) { return delta.lostPackets; });
+    column([](FlowId, const Totals& delta) { return delta.txBytes; });
+    column([](FlowId, const Totals& delta) { return delta.rxBytes; });
+    column([](FlowId, const Totals& delta) { return delta.delaySum; });
+    column([](FlowId, const Totals& delta) { return delta.jitterSum; });
+    m_file.write(m_chunk.data(), m_chunk.size());
+
+    IndexEntry entry;
+    entry.binStart = header.binStart;
+    entry.offset = m_offset;
+    entry.nRows = header.nRows;
+    entry.padding = 0;
+    m_index.push_back(entry);
+    m_offset += m_chunk.size();
+    NS_LOG_DEBUG("Bin starting at " << m_binStart.As(Time::S) << ": " << rows.size() << " flows");
+}
+
+} // namespace ns3
@@ -0,0 +1,157 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef FLOW_SERIES_WRITER_H
+#define FLOW_SERIES_WRITER_H
+
+#include "flow-classifier.h"
+#include "flow-monitor.h"
+
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <fstream>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup flow-monitor
+ * @brief Writes time-binned per-flow statistics of a FlowMonitor to a
+ * columnar binary file while the simulation runs.
+ *
+ * At the end of each bin, the writer appends to the file one chunk holding
+ * a row for each flow whose statistics changed during the bin, with the
+ * number of packets and bytes transmitted and received, the number of lost
+ * packets, and the sums of the delays and jitters of the received packets
+ * during the bin.  The throughput, mean delay, mean jitter and loss of a
+ * flow in a bin follow directly.  The chunks are not kept in memory: only
+ * the cumulative statistics of the flows at the end of the last bin and the
+ * index entries (24 bytes per written chunk) are.
+ *
+ * The file, in the host byte order, is laid out to be memory-mapped:
+ *
+ * - a FileHeader;
+ * - the chunks, each made of a ChunkHeader followed by the columns of its
+ *   rows, in this order: flow id, tx packets, rx packets, lost packets
+ *   (uint32_t), tx bytes, rx bytes (uint64_t), delay sum and jitter sum
+ *   (int64_t, in nanoseconds);
+ * - an index of the chunks, made of one IndexEntry per chunk;
+ * - a Footer, at the very end of the file, locating the index.
+ *
+ * The bins without any change are not written.  The index and the footer
+ * are written by Close, which is called by Simulator::Destroy.  The last
+ * bin then ends at the time of the close, recorded in the footer, and may
+ * be shorter than the others.
+ */
+class FlowSeriesWriter : public Object
+{
+  public:
+    /// Header at the start of the file
+    struct FileHeader
+    {
+        char magic[8];     //!< "ns3fser" followed by a null character
+        uint32_t version;  //!< version of the file layout
+        uint32_t nColumns; //!< number of columns of the chunks
+        int64_t binWidth;  //!< width of the bins, in nanoseconds
+        int64_t start;     //!< start time of the first bin, in nanoseconds
+    };
+
+    /// Header of a chunk, followed by its columns
+    struct ChunkHeader
+    {
+        int64_t binStart; //!< start time of the bin, in nanoseconds
+        uint32_t nRows;   //!< number of rows (flows) of the chunk
+        uint32_t padding; //!< unused
+    };
+
+    /// Entry of the index of the chunks
+    struct IndexEntry
+    {
+        int64_t binStart; //!< start time of the bin, in nanoseconds
+        uint64_t offset;  //!< offset of the chunk header in the file
+        uint32_t nRows;   //!< number of rows (flows) of the chunk
+        uint32_t padding; //!< unused
+    };
+
+    /// Footer at the end of the file
+    struct Footer
+    {
+        uint64_t indexOffset; //!< offset of the index in the file
+        uint64_t nChunks;     //!< number of entries of the index
+        int64_t end;          //!< end time of the last, possibly partial, bin, in nanoseconds
+        char magic[8];        //!< same as FileHeader::magic
+    };
+
+    /// Version of the file layout
+    static constexpr uint32_t VERSION = 1;
+    /// Number of columns of the chunks
+    static constexpr uint32_t N_COLUMNS = 8;
+
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    FlowSeriesWriter();
+    ~FlowSeriesWriter() override;
+
+    /**
+     * Create the file and start writing the statistics of a monitor, with
+     * bins starting now.
+     * @param monitor the FlowMonitor
+     * @param fileName name or path of the output file that will be created
+     * @param binWidth the width of the bins
+     * @return false if the file cannot be created
+     */
+    bool Open(Ptr<FlowMonitor> monitor, const std::string& fileName, Time binWidth);
+
+    /**
+     * Write the current, partial bin, the index and the footer, and close the file.
+     */
+    void Close();
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// Cumulative statistics of a flow at the end of the last bin
+    struct Totals
+    {
+        uint32_t txPackets;   //!< transmitted packets
+        uint32_t rxPackets;   //!< received packets
+        uint32_t lostPackets; //!< lost packets
+        uint64_t txBytes;     //!< transmitted bytes
+        uint64_t rxBytes;     //!< received bytes
+        int64_t delaySum;     //!< sum of the delays, in nanoseconds
+        int64_t jitterSum;    //!< sum of the jitters, in nanoseconds
+    };
+
+    /// Write the chunk of the bin ending now and schedule the end of the next bin
+    void EndBin();
+
+    /// Write the chunk of the bin ending now
+    void WriteChunk();
+
+    Ptr<FlowMonitor> m_monitor;      //!< monitor whose statistics are written
+    std::ofstream m_file;            //!< output file
+    Time m_binWidth;                 //!< width of the bins
+    Time m_binStart;                 //!< start time of the current bin
+    EventId m_binEvent;              //!< event ending the current bin
+    std::map<FlowId, Totals> m_last; //!< statistics of the flows at the end of the last bin
+    std::vector<IndexEntry> m_index; //!< index of the chunks written so far
+    std::vector<char> m_chunk;       //!< scratch buffer of a chunk
+    uint64_t m_offset;               //!< size of the file written so far
+};
+
+} // namespace ns3
+
+#endif /* FLOW_SERIES_WRITER_H */
@@ -0,0 +1,189 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "sweep-result-ring.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SweepResultRing");
+
+/// Value of SweepResultRing::Header::magic ("ns3R")
+static constexpr uint32_t SWEEP_RING_MAGIC = 0x6e733352;
+
+void
+SweepRecord::SetName(const std::string& name)
+{
+    std::memset(this->name, 0, NAME_SIZE);
+    std::memcpy(this->name, name.data(), std::min<std::size_t>(name.size(), NAME_SIZE - 1));
+}
+
+std::string
+SweepRecord::GetName() const
+{
+    return std::string(name, strnlen(name, NAME_SIZE));
+}
+
+SweepResultRing::SweepResultRing()
+    : m_header(nullptr),
+      m_records(nullptr),
+      m_size(0)
+{
+}
+
+SweepResultRing::~SweepResultRing()
+{
+    Close();
+}
+
+bool
+SweepResultRing::Map(int fd, std::size_t size)
+{
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        NS_LOG_ERROR("mmap failed: " << std::strerror(errno));
+        return false;
+    }
+    m_size = size;
+    m_header = static_cast<Header*>(addr);
+    m_records = reinterpret_cast<SweepRecord*>(static_cast<uint8_t*>(addr) + sizeof(Header));
+    return true;
+}
+
+bool
+SweepResultRing::Create(const std::string& path, uint32_t capacity)
+{
+    NS_LOG_FUNCTION(this << path << capacity);
+    NS_ASSERT(!IsOpen() && capacity > 0);
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        NS_LOG_ERROR("Cannot create " << path << ": " << std::strerror(errno));
+        return false;
+    }
+    std::size_t size = sizeof(Header) + std::size_t{capacity} * sizeof(SweepRecord);
+    if (ftruncate(fd, size) != 0)
+    {
+        NS_LOG_ERROR("Cannot resize " << path << ": " << std::strerror(errno));
+        close(fd);
+        return false;
+    }
+    if (!Map(fd, size))
+    {
+        return false;
+    }
+    m_header->recordSize = sizeof(SweepRecord);
+    m_header->capacity = capacity;
+    m_header->readerPid = getpid();
+    m_header->head.store(0, std::memory_order_relaxed);
+    m_header->tail.store(0, std::memory_order_relaxed);
+    // publish the magic last, so that a writer never sees a half-initialized header
+    std::atomic_thread_fence(std::memory_order_release);
+    m_header->magic = SWEEP_RING_MAGIC;
+    return true;
+}
+
+bool
+SweepResultRing::Open(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+    NS_ASSERT(!IsOpen());
+    int fd = open(path.c_str(), O_RDWR);
+    if (fd < 0)
+    {
+        NS_LOG_ERROR("Cannot open " << path << ": " << std::strerror(errno));
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header))
+    {
+        NS_LOG_ERROR(path << " is not a sweep result ring");
+        close(fd);
+        return false;
+    }
+    if (!Map(fd, st.st_size))
+    {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (m_header->magic != SWEEP_RING_MAGIC || m_header->recordSize != sizeof(SweepRecord) ||
+        sizeof(Header) + std::size_t{m_header->capacity} * sizeof(SweepRecord) > m_size)
+    {
+        NS_LOG_ERROR(path << " is not a compatible sweep result ring");
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void
+SweepResultRing::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_header != nullptr)
+    {
+        munmap(m_header, m_size);
+    }
+    m_header = nullptr;
+    m_records = nullptr;
+    m_size = 0;
+}
+
+bool
+SweepResultRing::IsOpen() const
+{
+    return m_header != nullptr;
+}
+
+bool
+SweepResultRing::Push(const SweepRecord& record)
+{
+    NS_ASSERT(IsOpen());
+    const uint64_t head = m_header->head.load(std::memory_order_relaxed);
+    while (head - m_header->tail.load(std::memory_order_acquire) >= m_header->capacity)
+    {
+        // the ring is full: back off until the reader catches up, unless it is gone
+        if (kill(m_header->readerPid, 0) != 0 && errno == ESRCH)
+        {
+            NS_LOG_WARN("Sweep result reader " << m_header->readerPid << " is gone");
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    m_records[head % m_header->capacity] = record;
+    m_header->head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool
+SweepResultRing::Pop(SweepRecord& record)
+{
+    NS_ASSERT(IsOpen());
+    const uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+    if (tail == m_header->head.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+    record = m_records[tail % m_header->capacity];
+    m_header->tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,153 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#ifndef SWEEP_RESULT_RING_H
+#define SWEEP_RESULT_RING_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace ns3
+{
+
+/**
+ * @ingroup flow-monitor
+ * @brief Fixed-layout result record written by a sweep run into a SweepResultRing
+ *
+ * The layout is shared between processes, so the record only holds plain
+ * integers, doubles and a fixed-size character array.
+ */
+struct SweepRecord
+{
+    /// Kind of record
+    enum Kind : uint32_t
+    {
+        FLOW = 1,    //!< per-flow statistics of a FlowMonitor
+        COUNTER = 2, //!< named scalar counter
+        END = 3,     //!< last record of a run
+    };
+
+    /// Maximum length of the name, including the terminating null character
+    static constexpr uint32_t NAME_SIZE = 64;
+
+    uint32_t kind;               //!< kind of record
+    uint32_t flowId;             //!< flow identifier (FLOW records only)
+    char name[NAME_SIZE];        //!< flow description or counter name
+    uint64_t txPackets;          //!< transmitted packets
+    uint64_t rxPackets;          //!< received packets
+    uint64_t lostPackets;        //!< lost packets
+    uint64_t txBytes;            //!< transmitted bytes
+    uint64_t rxBytes;            //!< received bytes
+    int64_t delaySumNs;          //!< sum of the end-to-end delays (ns)
+    int64_t jitterSumNs;         //!< sum of the jitters (ns)
+    int64_t timeFirstTxPacketNs; //!< time of the first transmitted packet (ns)
+    int64_t timeLastRxPacketNs;  //!< time of the last received packet (ns)
+    double value;                //!< counter value (COUNTER records only)
+
+    /**
+     * Set the name of the record, truncating it if needed
+     * @param name the name
+     */
+    void SetName(const std::string& name);
+
+    /**
+     * @return the name of the record
+     */
+    std::string GetName() const;
+};
+
+static_assert(std::is_trivially_copyable_v<SweepRecord>,
+              "SweepRecord is copied between processes and must be trivially copyable");
+
+/**
+ * @ingroup flow-monitor
+ * @brief Single-producer single-consumer ring of SweepRecord in a shared memory-mapped file
+ *
+ * The sweep driver creates one ring per child process with Create() and drains
+ * it with Pop(); the child attaches to it with Open() and appends records with
+ * Push(). When the ring is full, Push() blocks until the reader makes room, so
+ * no record is ever dropped while the reader is alive.
+ */
+class SweepResultRing
+{
+  public:
+    SweepResultRing();
+    ~SweepResultRing();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    SweepResultRing(const SweepResultRing&) = delete;
+    SweepResultRing& operator=(const SweepResultRing&) = delete;
+
+    /**
+     * Create the ring file and map it, as the reader
+     * @param path the path of the file backing the ring (e.g., in /dev/shm)
+     * @param capacity the number of records the ring can hold
+     * @return true on success
+     */
+    bool Create(const std::string& path, uint32_t capacity);
+
+    /**
+     * Map an existing ring file, as the writer
+     * @param path the path of the file backing the ring
+     * @return true on success
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * Unmap the ring; the backing file is left in place
+     */
+    void Close();
+
+    /**
+     * @return true if a ring is mapped
+     */
+    bool IsOpen() const;
+
+    /**
+     * Append a record, blocking while the ring is full
+     * @param record the record
+     * @return false if the reader went away before the record could be written
+     */
+    bool Push(const SweepRecord& record);
+
+    /**
+     * Remove the oldest record, if any
+     * @param record the removed record
+     * @return false if the ring is empty
+     */
+    bool Pop(SweepRecord& record);
+
+  private:
+    /// Header at the beginning of the shared file
+    struct Header
+    {
+        uint32_t magic;                         //!< identifies a valid ring
+        uint32_t recordSize;                    //!< sizeof(SweepRecord) when created
+        uint32_t capacity;                      //!< number of records
+        int32_t readerPid;                      //!< process id of the reader
+        alignas(64) std::atomic<uint64_t> head; //!< number of records written
+        alignas(64) std::atomic<uint64_t> tail; //!< number of records read
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                  "The ring indices must be lock-free to be shared between processes");
+
+    /**
+     * Map a ring file of the given size
+     * @param fd the file descriptor
+     * @param size the size of the file
+     * @return true on success
+     */
+    bool Map(int fd, std::size_t size);
+
+    Header* m_header;       //!< mapped header
+    SweepRecord* m_records; //!< mapped records
+    std::size_t m_size;     //!< size of the mapping
+};
+
+} // namespace ns3
+
+#endif /* SWEEP_RESULT_RING_H */
@@ -0,0 +1,215 @@
+//
+// SPDX-License-Identifier: GPL-2.0-only
+//
+
+#include "ns3/data-rate.h"
+#include "ns3/flow-monitor-helper.h"
+#include "ns3/flow-series-writer.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/packet.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/test.h"
+#include "ns3/udp-socket-factory.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @defgroup flow-monitor-test Flow monitor module tests
+ * @ingroup flow-monitor
+ * @ingroup tests
+ */
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief Run a UDP flow for two bins and a half, and check the headers, the
+ * index and the per-bin counters of the file written by FlowSeriesWriter.
+ */
+class FlowSeriesWriterTestCase : public TestCase
+{
+  public:
+    FlowSeriesWriterTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Send a packet and schedule the next one.
+     * @param socket the sending socket
+     * @param remaining the number of packets left to send
+     */
+    void Send(Ptr<Socket> socket, uint32_t remaining);
+
+    /// Columns of a chunk holding a single row
+    struct Row
+    {
+        uint32_t flowId;      //!< flow id
+        uint32_t txPackets;   //!< transmitted packets
+        uint32_t rxPackets;   //!< received packets
+        uint32_t lostPackets; //!< lost packets
+        uint64_t txBytes;     //!< transmitted bytes
+        uint64_t rxBytes;     //!< received bytes
+        int64_t delaySum;     //!< sum of the delays, in nanoseconds
+        int64_t jitterSum;    //!< sum of the jitters, in nanoseconds
+    };
+
+    static constexpr uint32_t PAYLOAD = 100; //!< UDP payload of the packets
+};
+
+FlowSeriesWriterTestCase::FlowSeriesWriterTestCase()
+    : TestCase("Write the statistics of a flow in bins and read them back")
+{
+}
+
+void
+FlowSeriesWriterTestCase::Send(Ptr<Socket> socket, uint32_t remaining)
+{
+    socket->Send(Create<Packet>(PAYLOAD));
+    if (remaining > 1)
+    {
+        Simulator::Schedule(MilliSeconds(100),
+                            &FlowSeriesWriterTestCase::Send,
+                            this,
+                            socket,
+                            remaining - 1);
+    }
+}
+
+void
+FlowSeriesWriterTestCase::DoRun()
+{
+    NodeContainer nodes(2);
+    SimpleNetDeviceHelper simple;
+    simple.SetChannelAttribute("Delay", TimeValue(MilliSeconds(1)));
+    simple.SetDeviceAttribute("DataRate", DataRateValue(DataRate("10Mbps")));
+    NetDeviceContainer devices = simple.Install(nodes);
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = ipv4.Assign(devices);
+
+    Ptr<Socket> receiver = Socket::CreateSocket(nodes.Get(1), UdpSocketFactory::GetTypeId());
+    receiver->Bind(InetSocketAddress(Ipv4Address::GetAny(), 9));
+    Ptr<Socket> sender = Socket::CreateSocket(nodes.Get(0), UdpSocketFactory::GetTypeId());
+    sender->Connect(InetSocketAddress(interfaces.GetAddress(1), 9));
+
+    FlowMonitorHelper flowmon;
+    Ptr<FlowMonitor> monitor = flowmon.InstallAll();
+    const std::string fileName = CreateTempDirFilename("flow-series-writer-test.bin");
+    flowmon.EnableTimeSeries(fileName, Seconds(1));
+
+    // 25 packets, one every 100 ms from 50 ms: 10 in each of the first two
+    // bins and 5 in the last, partial bin, which ends when the simulation stops
+    Simulator::Schedule(MilliSeconds(50), &FlowSeriesWriterTestCase::Send, this, sender, 25);
+    Simulator::Stop(MilliSeconds(2500));
+    Simulator::Run();
+    const auto stats = monitor->GetFlowStats();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(stats.size(), 1, "There should be a single flow");
+    const auto& [flowId, totals] = *stats.cbegin();
+    NS_TEST_ASSERT_MSG_EQ(totals.rxPackets, 25, "Not all the packets were received");
+
+    std::ifstream file(fileName, std::ios::binary);
+    NS_TEST_ASSERT_MSG_EQ(file.is_open(), true, "Cannot open " << fileName);
+    std::vector<char> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    NS_TEST_ASSERT_MSG_GT_OR_EQ(data.size(),
+                                sizeof(FlowSeriesWriter::FileHeader) +
+                                    sizeof(FlowSeriesWriter::Footer),
+                                "The file is truncated");
+
+    FlowSeriesWriter::FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    NS_TEST_ASSERT_MSG_EQ(std::string(header.magic), "ns3fser", "Wrong magic of the header");
+    NS_TEST_ASSERT_MSG_EQ(header.version, FlowSeriesWriter::VERSION, "Wrong version");
+    NS_TEST_ASSERT_MSG_EQ(header.nColumns, FlowSeriesWriter::N_COLUMNS, "Wrong number of columns");
+    NS_TEST_ASSERT_MSG_EQ(header.binWidth, Seconds(1).GetNanoSeconds(), "Wrong bin width");
+    NS_TEST_ASSERT_MSG_EQ(header.start, 0, "Wrong start of the first bin");
+
+    FlowSeriesWriter::Footer footer;
+    std::memcpy(&footer, data.data() + data.size() - sizeof(footer), sizeof(footer));
+    NS_TEST_ASSERT_MSG_EQ(std::string(footer.magic), "ns3fser", "Wrong magic of the footer");
+    NS_TEST_ASSERT_MSG_EQ(footer.end,
+                          MilliSeconds(2500).GetNanoSeconds(),
+                          "Wrong end of the last bin");
+    NS_TEST_ASSERT_MSG_EQ(footer.nChunks, 3, "Wrong number of chunks");
+    NS_TEST_ASSERT_MSG_EQ(footer.indexOffset +
+                              footer.nChunks * sizeof(FlowSeriesWriter::IndexEntry),
+                          data.size() - sizeof(footer),
+                          "The index should be followed by the footer");
+
+    const uint32_t expectedPackets[] = {10, 10, 5};
+    // the IPv4 and UDP headers are counted in the bytes
+    const uint64_t packetSize = PAYLOAD + 28;
+    int64_t delaySum = 0;
+    int64_t jitterSum = 0;
+    for (uint32_t i = 0; i < footer.nChunks; i++)
+    {
+        FlowSeriesWriter::IndexEntry entry;
+        std::memcpy(&entry,
+                    data.data() + footer.indexOffset + i * sizeof(entry),
+                    sizeof(entry));
+        NS_TEST_ASSERT_MSG_EQ(entry.binStart, Seconds(i).GetNanoSeconds(), "Wrong bin start");
+        NS_TEST_ASSERT_MSG_EQ(entry.nRows, 1, "Wrong number of rows");
+
+        FlowSeriesWriter::ChunkHeader chunk;
+        std::memcpy(&chunk, data.data() + entry.offset, sizeof(chunk));
+        NS_TEST_ASSERT_MSG_EQ(chunk.binStart, entry.binStart, "Chunk and index disagree");
+        NS_TEST_ASSERT_MSG_EQ(chunk.nRows, entry.nRows, "Chunk and index disagree");
+
+        // with a single row, the columns of the chunk are laid out as a Row
+        Row row;
+        std::memcpy(&row, data.data() + entry.offset + sizeof(chunk), sizeof(row));
+        NS_TEST_ASSERT_MSG_EQ(row.flowId, flowId, "Wrong flow id in bin " << i);
+        NS_TEST_ASSERT_MSG_EQ(row.txPackets, expectedPackets[i], "Wrong tx packets in bin " << i);
+        NS_TEST_ASSERT_MSG_EQ(row.rxPackets, expectedPackets[i], "Wrong rx packets in bin " << i);
+        NS_TEST_ASSERT_MSG_EQ(row.lostPackets, 0, "Wrong lost packets in bin " << i);
+        NS_TEST_ASSERT_MSG_EQ(row.txBytes,
+                              expectedPackets[i] * packetSize,
+                              "Wrong tx bytes in bin " << i);
+        NS_TEST_ASSERT_MSG_EQ(row.rxBytes,
+                              expectedPackets[i] * packetSize,
+                              "Wrong rx bytes in bin " << i);
+        delaySum += row.delaySum;
+        jitterSum += row.jitterSum;
+    }
+    NS_TEST_ASSERT_MSG_EQ(delaySum,
+                          totals.delaySum.GetNanoSeconds(),
+                          "The delays of the bins do not add up to the total");
+    NS_TEST_ASSERT_MSG_EQ(jitterSum,
+                          totals.jitterSum.GetNanoSeconds(),
+                          "The jitters of the bins do not add up to the total");
+    // only the first packet waits for the ARP resolution, hence the jitter
+    NS_TEST_ASSERT_MSG_GT(jitterSum, 0, "The jitter of the first packets is not accounted");
+}
+
+/**
+ * @ingroup flow-monitor-test
+ *
+ * @brief FlowSeriesWriter test suite
+ */
+class FlowSeriesWriterTestSuite : public TestSuite
+{
+  public:
+    FlowSeriesWriterTestSuite();
+};
+
+FlowSeriesWriterTestSuite::FlowSeriesWriterTestSuite()
+    : TestSuite("flow-series-writer", Type::UNIT)
+{
+    AddTestCase(new FlowSeriesWriterTestCase(), TestCase::Duration::QUICK);
+}
+
+/// Static variable for test initialization
+static FlowSeriesWriterTestSuite g_flowSeriesWriterTestSuite;
@@ -19,12 +19,15 @@
 #include "ns3/callback.h"
 #include "ns3/config.h"
 #include "ns3/global-router-interface.h"
+#include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv6-extension-demux.h"
 #include "ns3/ipv6-extension-header.h"
 #include "ns3/ipv6-extension.h"
+#include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
@@ -35,7 +38,9 @@
 #include "ns3/packet-socket-factory.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/tcp-l4-protocol.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/udp-l4-protocol.h"
 
 #include <limits>
 #include <map>
@@ -269,16 +274,15 @@ InternetStackHelper::InstallAll() const
 }
 
 void
-InternetStackHelper::CreateAndAggregateObjectFromTypeId(Ptr<Node> node, const std::string typeId)
+InternetStackHelper::CreateAndAggregateObjectFromTypeId(Ptr<Node> node, TypeId tid)
 {
-    TypeId tid = TypeId::LookupByName(typeId);
     if (node->GetObject<Object>(tid))
     {
         return;
     }
 
     ObjectFactory factory;
-    factory.SetTypeId(typeId);
+    factory.SetTypeId(tid);
     Ptr<Object> protocol = factory.Create<Object>();
     node->AggregateObject(protocol);
 }
@@ -289,9 +293,9 @@ InternetStackHelper::Install(Ptr<Node> node) const
     if (m_ipv4Enabled)
     {
         /* IPv4 stack */
-        CreateAndAggregateObjectFromTypeId(node, "ns3::ArpL3Protocol");
-        CreateAndAggregateObjectFromTypeId(node, "ns3::Ipv4L3Protocol");
-        CreateAndAggregateObjectFromTypeId(node, "ns3::Icmpv4L4Protocol");
+        CreateAndAggregateObjectFromTypeId(node, ArpL3Protocol::GetTypeId());
+        CreateAndAggregateObjectFromTypeId(node, Ipv4L3Protocol::GetTypeId());
+        CreateAndAggregateObjectFromTypeId(node, Icmpv4L4Protocol::GetTypeId());
         if (!m_ipv4ArpJitterEnabled)
         {
             Ptr<ArpL3Protocol> arp = node->GetObject<ArpL3Protocol>();
@@ -312,8 +316,8 @@ InternetStackHelper::Install(Ptr<Node> node) const
     if (m_ipv6Enabled)
     {
         /* IPv6 stack */
-        CreateAndAggregateObjectFromTypeId(node, "ns3::Ipv6L3Protocol");
-        CreateAndAggregateObjectFromTypeId(node, "ns3::Icmpv6L4Protocol");
+        CreateAndAggregateObjectFromTypeId(node, Ipv6L3Protocol::GetTypeId());
+        CreateAndAggregateObjectFromTypeId(node, Icmpv6L4Protocol::GetTypeId());
         if (!m_ipv6NsRsJitterEnabled)
         {
             Ptr<Icmpv6L4Protocol> icmpv6l4 = node->GetObject<Icmpv6L4Protocol>();
@@ -335,9 +339,9 @@ InternetStackHelper::Install(Ptr<Node> node) const
 
     if (m_ipv4Enabled || m_ipv6Enabled)
     {
-        CreateAndAggregateObjectFromTypeId(node, "ns3::TrafficControlLayer");
-        CreateAndAggregateObjectFromTypeId(node, "ns3::UdpL4Protocol");
-        CreateAndAggregateObjectFromTypeId(node, "ns3::TcpL4Protocol");
+        CreateAndAggregateObjectFromTypeId(node, TrafficControlLayer::GetTypeId());
+        CreateAndAggregateObjectFromTypeId(node, UdpL4Protocol::GetTypeId());
+        CreateAndAggregateObjectFromTypeId(node, TcpL4Protocol::GetTypeId());
         if (!node->GetObject<PacketSocketFactory>())
         {
             Ptr<PacketSocketFactory> factory = CreateObject<PacketSocketFactory>();
@@ -279,9 +279,9 @@ class InternetStackHelper : public PcapHelperForIpv4,
      * @brief create an object from its TypeId and aggregates it to the node. Does nothing if
      * an object of the same type is already aggregated to the node.
      * @param node the node
-     * @param typeId the object TypeId
+     * @param tid the object TypeId
      */
-    static void CreateAndAggregateObjectFromTypeId(Ptr<Node> node, const std::string typeId);
+    static void CreateAndAggregateObjectFromTypeId(Ptr<Node> node, TypeId tid);
 
     /**
      * @brief checks if there is an hook to a Pcap wrapper
@@ -11,7 +11,7 @@
 #include "ns3/log.h"
 #include "ns3/simulation-singleton.h"
 
-#include <list>
+#include <map>
 
 namespace ns3
 {
@@ -165,17 +165,11 @@ class Ipv4AddressGeneratorImpl
     NetworkState m_netTable[N_BITS]; //!< the available networks
 
     /**
-     * @brief This class holds the allocated addresses
+     * @brief The blocks of allocated addresses, indexed by their lowest
+     * address, holding their highest address
      */
-    class Entry
-    {
-      public:
-        uint32_t addrLow;  //!< the lowest allocated address
-        uint32_t addrHigh; //!< the highest allocated address
-    };
-
-    std::list<Entry> m_entries; //!< contained of allocated addresses
-    bool m_test;                //!< test mode (if true)
+    std::map<uint32_t, uint32_t> m_entries;
+    bool m_test; //!< test mode (if true)
 };
 
 Ipv4AddressGeneratorImpl::Ipv4AddressGeneratorImpl()
@@ -354,17 +348,18 @@ Ipv4AddressGeneratorImpl::AddAllocated(const Ipv4Address address)
         addr,
         "Ipv4AddressGeneratorImpl::Add(): Allocating the broadcast address is not a good idea");
 
-    std::list<Entry>::iterator i;
-
-    for (i = m_entries.begin(); i != m_entries.end(); ++i)
+    // The block following the address, and the block holding or preceding it
+    auto next = m_entries.upper_bound(addr);
+    if (next != m_entries.begin())
     {
-        NS_LOG_LOGIC("examine entry: " << Ipv4Address((*i).addrLow) << " to "
-                                       << Ipv4Address((*i).addrHigh));
+        auto i = std::prev(next);
+        NS_LOG_LOGIC("examine entry: " << Ipv4Address(i->first) << " to "
+                                       << Ipv4Address(i->second));
         //
         // First things first.  Is there an address collision -- that is, does the
         // new address fall in a previously allocated block of addresses.
         //
-        if (addr >= (*i).addrLow && addr <= (*i).addrHigh)
+        if (addr <= i->second)
         {
             NS_LOG_LOGIC(
                 "Ipv4AddressGeneratorImpl::Add(): Address Collision: " << Ipv4Address(addr));
@@ -376,64 +371,32 @@ Ipv4AddressGeneratorImpl::AddAllocated(const Ipv4Address address)
             return false;
         }
         //
-        // If the new address is less than the lowest address in the current block,
-        // and can't be merged into to the current block, then insert it as a new
-        // block before the current block.
-        //
-        if (addr < (*i).addrLow - 1)
-        {
-            break;
-        }
-        //
-        // If the new address fits at the end of the block, look ahead to the next
-        // block and make sure it's not a collision there.  If we won't overlap, then
-        // just extend the current block by one address.  We expect that completely
-        // filled network ranges will be a fairly rare occurrence, so we don't worry
-        // about collapsing address range blocks.
+        // If the new address fits at the end of the block, just extend the block
+        // by one address.  We expect that completely filled network ranges will be
+        // a fairly rare occurrence, so we don't worry about collapsing address
+        // range blocks.
         //
-        if (addr == (*i).addrHigh + 1)
+        if (addr == i->second + 1)
         {
-            auto j = i;
-            ++j;
-
-            if (j != m_entries.end())
-            {
-                if (addr == (*j).addrLow)
-                {
-                    NS_LOG_LOGIC("Ipv4AddressGeneratorImpl::Add(): "
-                                 "Address Collision: "
-                                 << Ipv4Address(addr));
-                    if (!m_test)
-                    {
-                        NS_FATAL_ERROR("Ipv4AddressGeneratorImpl::Add(): Address Collision: "
-                                       << Ipv4Address(addr));
-                    }
-                    return false;
-                }
-            }
-
             NS_LOG_LOGIC("New addrHigh = " << Ipv4Address(addr));
-            (*i).addrHigh = addr;
-            return true;
-        }
-        //
-        // If we get here, we know that the next lower block of addresses couldn't
-        // have been extended to include this new address since the code immediately
-        // above would have been executed and that next lower block extended upward.
-        // So we know it's safe to extend the current block down to include the new
-        // address.
-        //
-        if (addr == (*i).addrLow - 1)
-        {
-            NS_LOG_LOGIC("New addrLow = " << Ipv4Address(addr));
-            (*i).addrLow = addr;
+            i->second = addr;
             return true;
         }
     }
+    //
+    // If the new address fits at the start of the next block, extend this block
+    // down to include the new address.
+    //
+    if (next != m_entries.end() && addr == next->first - 1)
+    {
+        NS_LOG_LOGIC("New addrLow = " << Ipv4Address(addr));
+        auto node = m_entries.extract(next);
+        node.key() = addr;
+        m_entries.insert(std::move(node));
+        return true;
+    }
 
-    Entry entry;
-    entry.addrLow = entry.addrHigh = addr;
-    m_entries.insert(i, entry);
+    m_entries.emplace(addr, addr);
     return true;
 }
 
@@ -448,16 +411,12 @@ Ipv4AddressGeneratorImpl::IsAddressAllocated(const Ipv4Address address)
         addr,
         "Ipv4AddressGeneratorImpl::IsAddressAllocated(): Don't check for the broadcast address...");
 
-    for (auto i = m_entries.begin(); i != m_entries.end(); ++i)
+    auto i = m_entries.upper_bound(addr);
+    if (i != m_entries.begin() && addr <= (--i)->second)
     {
-        NS_LOG_LOGIC("examine entry: " << Ipv4Address((*i).addrLow) << " to "
-                                       << Ipv4Address((*i).addrHigh));
-        if (addr >= (*i).addrLow && addr <= (*i).addrHigh)
-        {
-            NS_LOG_LOGIC("Ipv4AddressGeneratorImpl::IsAddressAllocated(): Address Collision: "
-                         << Ipv4Address(addr));
-            return true;
-        }
+        NS_LOG_LOGIC("Ipv4AddressGeneratorImpl::IsAddressAllocated(): Address Collision: "
+                     << Ipv4Address(addr));
+        return true;
     }
     return false;
 }
@@ -472,20 +431,22 @@ Ipv4AddressGeneratorImpl::IsNetworkAllocated(const Ipv4Address address, const Ip
         "Ipv4AddressGeneratorImpl::IsNetworkAllocated(): network address and mask don't match "
             << address << " " << mask);
 
-    for (auto i = m_entries.begin(); i != m_entries.end(); ++i)
+    // The blocks are disjoint, so a block ending in the network either starts
+    // in the network or is the last block starting before it
+    auto i = m_entries.lower_bound(address.Get());
+    if (i != m_entries.end() && address == Ipv4Address(i->first).CombineMask(mask))
     {
-        NS_LOG_LOGIC("examine entry: " << Ipv4Address((*i).addrLow) << " to "
-                                       << Ipv4Address((*i).addrHigh));
-        Ipv4Address low((*i).addrLow);
-        Ipv4Address high((*i).addrHigh);
-
-        if (address == low.CombineMask(mask) || address == high.CombineMask(mask))
-        {
-            NS_LOG_LOGIC(
-                "Ipv4AddressGeneratorImpl::IsNetworkAllocated(): Network already allocated: "
-                << address << " " << low << "-" << high);
-            return false;
-        }
+        NS_LOG_LOGIC("Ipv4AddressGeneratorImpl::IsNetworkAllocated(): Network already allocated: "
+                     << address << " " << Ipv4Address(i->first) << "-"
+                     << Ipv4Address(i->second));
+        return false;
+    }
+    if (i != m_entries.begin() && address == Ipv4Address((--i)->second).CombineMask(mask))
+    {
+        NS_LOG_LOGIC("Ipv4AddressGeneratorImpl::IsNetworkAllocated(): Network already allocated: "
+                     << address << " " << Ipv4Address(i->first) << "-"
+                     << Ipv4Address(i->second));
+        return false;
     }
     return true;
 }
@@ -80,4 +80,10 @@ NetDeviceContainer::Add(std::string deviceName)
     m_devices.push_back(device);
 }
 
+void
+NetDeviceContainer::Reserve(uint32_t n)
+{
+    m_devices.reserve(n);
+}
+
 } // namespace ns3
@@ -185,6 +185,14 @@ class NetDeviceContainer
      */
     void Add(std::string deviceName);
 
+    /**
+     * @brief Reserve the storage of n devices, so that they can be appended
+     * to this container without reallocating it.
+     *
+     * @param n The number of devices the container can hold.
+     */
+    void Reserve(uint32_t n);
+
   private:
     std::vector<Ptr<NetDevice>> m_devices; //!< NetDevices smart pointers
 };
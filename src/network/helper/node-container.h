@@ -215,6 +215,14 @@ class NodeContainer
      */
     void Create(uint32_t n, uint32_t systemId);
 
+    /**
+     * @brief Reserve the storage of n nodes, so that they can be appended
+     * to this NodeContainer without reallocating it.
+     *
+     * @param n The number of Nodes the container can hold
+     */
+    void Reserve(uint32_t n);
+
     /**
      * @brief Append the contents of another NodeContainer to the end of
      * this container.
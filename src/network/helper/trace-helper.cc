@@ -14,6 +14,7 @@
 #include "ns3/node.h"
 #include "ns3/pcap-file-wrapper.h"
 #include "ns3/ptr.h"
+#include "ns3/simulator.h"
 
 #include <fstream>
 #include <stdint.h>
@@ -24,6 +25,8 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("TraceHelper");
 
+Ptr<PcapngFile> PcapHelper::m_pcapngFile = nullptr;
+
 PcapHelper::PcapHelper()
 {
     NS_LOG_FUNCTION_NOARGS();
@@ -44,7 +47,22 @@ PcapHelper::CreateFile(std::string filename,
     NS_LOG_FUNCTION(filename << filemode << dataLinkType << snapLen << tzCorrection);
 
     Ptr<PcapFileWrapper> file = CreateObject<PcapFileWrapper>();
-    file->Open(filename, filemode);
+    if (m_pcapngFile)
+    {
+        NS_ABORT_MSG_IF(filemode & (std::ios::in | std::ios::app | std::ios::ate),
+                        "Unsupported file mode " << filemode << " for the pcap trace " << filename
+                                                 << " written to a pcapng file");
+        std::string name = filename;
+        if (name.size() > 5 && name.compare(name.size() - 5, 5, ".pcap") == 0)
+        {
+            name.resize(name.size() - 5);
+        }
+        file->Open(m_pcapngFile, name);
+    }
+    else
+    {
+        file->Open(filename, filemode);
+    }
     NS_ABORT_MSG_IF(file->Fail(), "Unable to Open " << filename << " for mode " << filemode);
 
     file->Init(dataLinkType, snapLen, tzCorrection);
@@ -64,6 +82,28 @@ PcapHelper::CreateFile(std::string filename,
     return file;
 }
 
+void
+PcapHelper::EnablePcapng(std::string filename)
+{
+    NS_LOG_FUNCTION(filename);
+    DisablePcapng();
+    m_pcapngFile = Create<PcapngFile>();
+    m_pcapngFile->Open(filename);
+    NS_ABORT_MSG_IF(m_pcapngFile->Fail(), "Unable to Open " << filename);
+    Simulator::ScheduleDestroy(&PcapHelper::DisablePcapng);
+}
+
+void
+PcapHelper::DisablePcapng()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    if (m_pcapngFile)
+    {
+        m_pcapngFile->Flush();
+        m_pcapngFile = nullptr;
+    }
+}
+
 std::string
 PcapHelper::GetFilenameFromDevice(std::string prefix, Ptr<NetDevice> device, bool useObjectNames)
 {
@@ -105,6 +105,29 @@ class PcapHelper
                                     DataLinkType dataLinkType,
                                     uint32_t snapLen = std::numeric_limits<uint32_t>::max(),
                                     int32_t tzCorrection = 0);
+
+    /**
+     * @brief Write the pcap traces created from now on to a single pcapng file.
+     *
+     * Instead of creating a pcap file, CreateFile adds an interface to the
+     * pcapng file, named after the pcap file name without its ".pcap"
+     * extension (e.g., "prefix-3-1" for device 1 of node 3), and returns a
+     * wrapper writing the packets to this interface.  CreateFile aborts if
+     * it is asked to read or append to the pcap file.  The buffered packets
+     * are written to the file when pcapng traces are disabled, which
+     * Simulator::Destroy does, and the file is closed when the wrappers of
+     * its interfaces have been destroyed too.
+     *
+     * @param filename name of the pcapng file
+     */
+    static void EnablePcapng(std::string filename);
+
+    /**
+     * @brief Create separate pcap files for the pcap traces created from now on.
+     *
+     * The packets buffered by the pcapng file, if any, are written to it.
+     */
+    static void DisablePcapng();
     /**
      * @brief Hook a trace source to the default trace sink
      *
@@ -140,6 +163,8 @@ class PcapHelper
     static void SinkWithHeader(Ptr<PcapFileWrapper> file,
                                const Header& header,
                                Ptr<const Packet> p);
+
+    static Ptr<PcapngFile> m_pcapngFile; //!< pcapng file of all the traces, if enabled
 };
 
 template <typename T>
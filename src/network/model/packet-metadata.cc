@@ -25,6 +25,9 @@ NS_LOG_COMPONENT_DEFINE("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
+bool PacketMetadata::m_sampling = false;
+uint32_t PacketMetadata::m_samplingPeriod = 0;
+Callback<bool, const Header&> PacketMetadata::m_samplingPredicate;
 bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
 uint16_t PacketMetadata::m_chunkUid = 0;
@@ -62,6 +65,41 @@ PacketMetadata::EnableChecking()
     m_enableChecking = true;
 }
 
+void
+PacketMetadata::EnableSampling(uint32_t period, Callback<bool, const Header&> predicate)
+{
+    NS_LOG_FUNCTION(period << !predicate.IsNull());
+    Enable();
+    m_sampling = true;
+    m_samplingPeriod = period;
+    m_samplingPredicate = predicate;
+}
+
+void
+PacketMetadata::DisableSampling()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_sampling = false;
+    m_samplingPeriod = 0;
+    m_samplingPredicate = MakeNullCallback<bool, const Header&>();
+}
+
+void
+PacketMetadata::StartRecording(uint32_t size)
+{
+    NS_LOG_FUNCTION(this << size);
+    if (!m_enable || m_data != nullptr)
+    {
+        return;
+    }
+    m_data = PacketMetadata::Create(10);
+    memset(m_data->m_data, 0xff, 4);
+    if (size > 0)
+    {
+        DoAddHeader(0, size);
+    }
+}
+
 void
 PacketMetadata::ReserveCopy(uint32_t size)
 {
@@ -125,6 +163,10 @@ bool
 PacketMetadata::IsStateOk() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_data == nullptr)
+    {
+        return m_head == 0xffff && m_tail == 0xffff && m_used == 0;
+    }
     bool ok = m_used <= m_data->m_size;
     ok &= IsPointerOk(m_head);
     ok &= IsPointerOk(m_tail);
@@ -493,6 +535,7 @@ PacketMetadata::ReplaceTail(PacketMetadata::SmallItem* item,
 
     // create a copy of the packet without its tail.
     PacketMetadata h(m_packetUid, 0);
+    h.StartRecording(0);
     uint16_t current = m_head;
     while (current != 0xffff && current != m_tail)
     {
@@ -639,6 +682,11 @@ void
 PacketMetadata::AddHeader(const Header& header, uint32_t size)
 {
     NS_LOG_FUNCTION(this << &header << size);
+    if (m_enable && m_data == nullptr)
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
     uint32_t uid = header.GetInstanceTypeId().GetUid() << 1;
     DoAddHeader(uid, size);
     NS_ASSERT(IsStateOk());
@@ -653,6 +701,11 @@ PacketMetadata::DoAddHeader(uint32_t uid, uint32_t size)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
 
     PacketMetadata::SmallItem item;
     item.next = m_head;
@@ -668,13 +721,18 @@ PacketMetadata::DoAddHeader(uint32_t uid, uint32_t size)
 void
 PacketMetadata::RemoveHeader(const Header& header, uint32_t size)
 {
-    uint32_t uid = header.GetInstanceTypeId().GetUid() << 1;
     NS_LOG_FUNCTION(this << &header << size);
     if (!m_enable)
     {
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
+    uint32_t uid = header.GetInstanceTypeId().GetUid() << 1;
     PacketMetadata::SmallItem item;
     PacketMetadata::ExtraItem extraItem;
     uint32_t read = ReadItems(m_head, &item, &extraItem);
@@ -713,13 +771,18 @@ PacketMetadata::RemoveHeader(const Header& header, uint32_t size)
 void
 PacketMetadata::AddTrailer(const Trailer& trailer, uint32_t size)
 {
-    uint32_t uid = trailer.GetInstanceTypeId().GetUid() << 1;
     NS_LOG_FUNCTION(this << &trailer << size);
     if (!m_enable)
     {
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
+    uint32_t uid = trailer.GetInstanceTypeId().GetUid() << 1;
     PacketMetadata::SmallItem item;
     item.next = 0xffff;
     item.prev = m_tail;
@@ -735,13 +798,18 @@ PacketMetadata::AddTrailer(const Trailer& trailer, uint32_t size)
 void
 PacketMetadata::RemoveTrailer(const Trailer& trailer, uint32_t size)
 {
-    uint32_t uid = trailer.GetInstanceTypeId().GetUid() << 1;
     NS_LOG_FUNCTION(this << &trailer << size);
     if (!m_enable)
     {
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
+    uint32_t uid = trailer.GetInstanceTypeId().GetUid() << 1;
     PacketMetadata::SmallItem item;
     PacketMetadata::ExtraItem extraItem;
     uint32_t read = ReadItems(m_tail, &item, &extraItem);
@@ -786,6 +854,10 @@ PacketMetadata::AddAtEnd(const PacketMetadata& o)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        return;
+    }
     if (m_tail == 0xffff)
     {
         // We have no items so 'AddAtEnd' is
@@ -873,6 +945,10 @@ PacketMetadata::RemoveAtStart(uint32_t start)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        return;
+    }
     NS_ASSERT(m_data != nullptr);
     uint32_t leftToRemove = start;
     uint16_t current = m_head;
@@ -900,6 +976,7 @@ PacketMetadata::RemoveAtStart(uint32_t start)
         {
             // fragment the list item.
             PacketMetadata fragment(m_packetUid, 0);
+            fragment.StartRecording(0);
             extraItem.fragmentStart += leftToRemove;
             leftToRemove = 0;
             uint16_t written = fragment.AddBig(0xffff, fragment.m_tail, &item, &extraItem);
@@ -934,6 +1011,10 @@ PacketMetadata::RemoveAtEnd(uint32_t end)
         m_metadataSkipped = true;
         return;
     }
+    if (m_data == nullptr)
+    {
+        return;
+    }
     NS_ASSERT(m_data != nullptr);
 
     uint32_t leftToRemove = end;
@@ -962,6 +1043,7 @@ PacketMetadata::RemoveAtEnd(uint32_t end)
         {
             // fragment the list item.
             PacketMetadata fragment(m_packetUid, 0);
+            fragment.StartRecording(0);
             NS_ASSERT(extraItem.fragmentEnd > leftToRemove);
             extraItem.fragmentEnd -= leftToRemove;
             leftToRemove = 0;
@@ -1262,6 +1344,11 @@ PacketMetadata::Deserialize(const uint8_t* buffer, uint32_t size)
     buffer = ReadFromRawU64(m_packetUid, start, buffer, size);
     desSize -= 8;
 
+    if (desSize > 0 && m_data == nullptr)
+    {
+        // the sender recorded the metadata of this packet
+        StartRecording(0);
+    }
     PacketMetadata::SmallItem item = {0};
     PacketMetadata::ExtraItem extraItem = {0};
     while (desSize > 0)
@@ -158,6 +158,28 @@ class PacketMetadata
      * @brief Enable the packet metadata checking
      */
     static void EnableChecking();
+    /**
+     * @brief Enable the packet metadata for a sample of the packets
+     *
+     * The metadata of a packet are recorded if its uid is a multiple of
+     * \p period, or from the first header added to the packet for which
+     * \p predicate returns true, the bytes already in the packet being
+     * recorded as payload. The other packets record no metadata, hence
+     * they print as empty and pay no per-header cost. The sampling is kept
+     * by subsequent calls to Enable.
+     *
+     * @param period the sampling period of the packet uids (0 to sample no uid)
+     * @param predicate the selector of the headers starting the recording (can be null)
+     */
+    static void EnableSampling(
+        uint32_t period,
+        Callback<bool, const Header&> predicate = MakeNullCallback<bool, const Header&>());
+    /**
+     * @brief Disable the sampling enabled by EnableSampling
+     *
+     * The metadata of all the packets created afterwards are recorded.
+     */
+    static void DisableSampling();
 
     /**
      * @brief Constructor
@@ -181,6 +203,24 @@ class PacketMetadata
     // Delete default constructor to avoid misuse
     PacketMetadata() = delete;
 
+    /**
+     * @brief Check if the metadata of the packet are recorded
+     * @returns true if the metadata of the packet are recorded
+     */
+    inline bool IsRecording() const;
+    /**
+     * @brief Start recording the metadata of a packet which was not sampled
+     * @param size the size of the packet, recorded as payload
+     */
+    void StartRecording(uint32_t size);
+    /**
+     * @brief Start recording the metadata of a packet which was not sampled,
+     * if the sampling predicate selects a header about to be added to it
+     * @param header header about to be added
+     * @param size the size of the packet before the header is added
+     */
+    inline void SampleHeader(const Header& header, uint32_t size);
+
     /**
      * @brief Add an header
      * @param header header to add
@@ -668,6 +708,11 @@ class PacketMetadata
     static bool m_enable;           //!< Enable the packet metadata
     static bool m_enableChecking;   //!< Enable the packet metadata checking
 
+    static bool m_sampling;           //!< Enable the packet metadata for a sample only
+    static uint32_t m_samplingPeriod; //!< Sampling period of the packet uids
+    /// Selector of the headers starting the recording of the packets which are not sampled
+    static Callback<bool, const Header&> m_samplingPredicate;
+
     /**
      * Set to true when adding metadata to a packet is skipped because
      * m_enable is false; used to detect enabling of metadata in the
@@ -678,7 +723,10 @@ class PacketMetadata
     static uint32_t m_maxSize;  //!< maximum metadata size
     static uint16_t m_chunkUid; //!< Chunk Uid
 
-    Data* m_data; //!< Metadata storage
+    /**
+     * Metadata storage, null if the metadata of the packet are not sampled.
+     */
+    Data* m_data;
     /*
        head -(next)-> tail
          ^             |
@@ -696,12 +744,18 @@ namespace ns3
 {
 
 PacketMetadata::PacketMetadata(uint64_t uid, uint32_t size)
-    : m_data(PacketMetadata::Create(10)),
+    : m_data(nullptr),
       m_head(0xffff),
       m_tail(0xffff),
       m_used(0),
       m_packetUid(uid)
 {
+    if (m_sampling && (m_samplingPeriod == 0 || uid % m_samplingPeriod != 0))
+    {
+        // the metadata of this packet are not sampled
+        return;
+    }
+    m_data = PacketMetadata::Create(10);
     memset(m_data->m_data, 0xff, 4);
     if (size > 0)
     {
@@ -716,9 +770,11 @@ PacketMetadata::PacketMetadata(const PacketMetadata& o)
       m_used(o.m_used),
       m_packetUid(o.m_packetUid)
 {
-    NS_ASSERT(m_data != nullptr);
-    NS_ASSERT(m_data->m_count < std::numeric_limits<uint32_t>::max());
-    m_data->m_count++;
+    if (m_data != nullptr)
+    {
+        NS_ASSERT(m_data->m_count < std::numeric_limits<uint32_t>::max());
+        m_data->m_count++;
+    }
 }
 
 PacketMetadata&
@@ -727,15 +783,19 @@ PacketMetadata::operator=(const PacketMetadata& o)
     if (m_data != o.m_data)
     {
         // not self assignment
-        NS_ASSERT(m_data != nullptr);
-        m_data->m_count--;
-        if (m_data->m_count == 0)
+        if (m_data != nullptr)
         {
-            PacketMetadata::Recycle(m_data);
+            m_data->m_count--;
+            if (m_data->m_count == 0)
+            {
+                PacketMetadata::Recycle(m_data);
+            }
         }
         m_data = o.m_data;
-        NS_ASSERT(m_data != nullptr);
-        m_data->m_count++;
+        if (m_data != nullptr)
+        {
+            m_data->m_count++;
+        }
     }
     m_head = o.m_head;
     m_tail = o.m_tail;
@@ -746,7 +806,10 @@ PacketMetadata::operator=(const PacketMetadata& o)
 
 PacketMetadata::~PacketMetadata()
 {
-    NS_ASSERT(m_data != nullptr);
+    if (m_data == nullptr)
+    {
+        return;
+    }
     m_data->m_count--;
     if (m_data->m_count == 0)
     {
@@ -754,6 +817,21 @@ PacketMetadata::~PacketMetadata()
     }
 }
 
+bool
+PacketMetadata::IsRecording() const
+{
+    return m_enable && m_data != nullptr;
+}
+
+void
+PacketMetadata::SampleHeader(const Header& header, uint32_t size)
+{
+    if (m_data == nullptr && !m_samplingPredicate.IsNull() && m_samplingPredicate(header))
+    {
+        StartRecording(size);
+    }
+}
+
 } // namespace ns3
 
 #endif /* PACKET_METADATA_H */
@@ -258,6 +258,7 @@ Packet::AddHeader(const Header& header)
 {
     uint32_t size = header.GetSerializedSize();
     NS_LOG_FUNCTION(this << header.GetInstanceTypeId().GetName() << size);
+    m_metadata.SampleHeader(header, GetSize());
     m_buffer.AddAtStart(size);
     m_byteTagList.Adjust(size);
     m_byteTagList.AddAtStart(size);
@@ -349,7 +350,17 @@ Packet::AddAtEnd(Ptr<const Packet> packet)
     copy.Adjust(GetSize());
     m_byteTagList.Add(copy);
     m_buffer.AddAtEnd(packet->m_buffer);
-    m_metadata.AddAtEnd(packet->m_metadata);
+    if (m_metadata.IsRecording() && !packet->m_metadata.IsRecording())
+    {
+        // the appended packet is not sampled, record its bytes as payload
+        PacketMetadata metadata = packet->m_metadata;
+        metadata.StartRecording(packet->GetSize());
+        m_metadata.AddAtEnd(metadata);
+    }
+    else
+    {
+        m_metadata.AddAtEnd(packet->m_metadata);
+    }
 }
 
 void
@@ -588,6 +599,13 @@ Packet::EnablePrinting()
     PacketMetadata::Enable();
 }
 
+void
+Packet::EnableSampledPrinting(uint32_t period, Callback<bool, const Header&> predicate)
+{
+    NS_LOG_FUNCTION(period << !predicate.IsNull());
+    PacketMetadata::EnableSampling(period, predicate);
+}
+
 void
 Packet::EnableChecking()
 {
@@ -514,6 +514,23 @@ class Packet : public SimpleRefCount<Packet>
      * simulation setup and before any packet is created.
      */
     static void EnablePrinting();
+    /**
+     * @brief Enable printing the metadata of a sample of the packets.
+     *
+     * Like EnablePrinting, but the metadata are kept only for the packets
+     * whose uid is a multiple of \p period, and for the packets from the
+     * first header added to them for which \p predicate returns true, e.g.,
+     * the headers of the flows of interest. The other packets print as
+     * empty and do not pay the cost of the metadata. This method must be
+     * invoked before any packet is created, and calls to EnablePrinting,
+     * e.g., by the ASCII trace helpers, keep the sampling.
+     *
+     * @param period the sampling period of the packet uids (0 to sample no uid)
+     * @param predicate the selector of the headers starting the recording (can be null)
+     */
+    static void EnableSampledPrinting(
+        uint32_t period,
+        Callback<bool, const Header&> predicate = MakeNullCallback<bool, const Header&>());
     /**
      * @brief Enable packets metadata checking.
      *
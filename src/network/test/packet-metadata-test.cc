@@ -14,6 +14,7 @@
 #include <cstdarg>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 using namespace ns3;
 
@@ -870,6 +871,111 @@ PacketMetadataTest::DoRun()
                           "Could not find original data in received packet");
 }
 
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * Sampled packet metadata unit tests.
+ */
+class PacketMetadataSamplingTest : public TestCase
+{
+  public:
+    PacketMetadataSamplingTest();
+    ~PacketMetadataSamplingTest() override;
+    void DoRun() override;
+
+  private:
+    /**
+     * Get the sizes of the metadata items of a packet
+     * @param p The packet
+     * @return The sizes of the items, from the first header to the last trailer
+     */
+    static std::vector<uint32_t> GetItemSizes(Ptr<const Packet> p);
+    /**
+     * Sampling predicate selecting the headers of type HistoryHeader<7>
+     * @param header The header about to be added to a packet
+     * @return true if the header is a HistoryHeader<7>
+     */
+    static bool IsSampledHeader(const Header& header);
+};
+
+PacketMetadataSamplingTest::PacketMetadataSamplingTest()
+    : TestCase("Sampled packet metadata")
+{
+}
+
+PacketMetadataSamplingTest::~PacketMetadataSamplingTest()
+{
+}
+
+std::vector<uint32_t>
+PacketMetadataSamplingTest::GetItemSizes(Ptr<const Packet> p)
+{
+    std::vector<uint32_t> sizes;
+    PacketMetadata::ItemIterator i = p->BeginItem();
+    while (i.HasNext())
+    {
+        sizes.push_back(i.Next().currentSize);
+    }
+    return sizes;
+}
+
+bool
+PacketMetadataSamplingTest::IsSampledHeader(const Header& header)
+{
+    return dynamic_cast<const HistoryHeader<7>*>(&header) != nullptr;
+}
+
+void
+PacketMetadataSamplingTest::DoRun()
+{
+    using Sizes = std::vector<uint32_t>;
+
+    // no uid is sampled, only the packets with a HistoryHeader<7> are recorded
+    PacketMetadata::EnableSampling(0, MakeCallback(&PacketMetadataSamplingTest::IsSampledHeader));
+    Ptr<Packet> p = Create<Packet>(100);
+    ADD_HEADER(p, 10);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(p) == Sizes{}), true, "packet unexpectedly sampled");
+    ADD_HEADER(p, 7);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(p) == Sizes{7, 110}), true, "sampled header not recorded");
+    ADD_HEADER(p, 3);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(p) == Sizes{3, 7, 110}), true, "header not recorded");
+    REM_HEADER(p, 3);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(p) == Sizes{7, 110}), true, "header not removed");
+
+    Ptr<Packet> fragment = p->CreateFragment(0, 50);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(fragment) == Sizes{7, 43}), true, "bad fragment");
+    uint32_t size = p->GetSerializedSize();
+    std::vector<uint8_t> buffer(size);
+    p->Serialize(buffer.data(), size);
+    Ptr<Packet> deserialized = Create<Packet>(buffer.data(), size, true);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(deserialized) == Sizes{7, 110}), true, "bad copy");
+
+    // the bytes of a packet which is not sampled are recorded as payload
+    Ptr<Packet> unsampled = Create<Packet>(20);
+    p->AddAtEnd(unsampled);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(p) == Sizes{7, 110, 20}), true, "bad concatenation");
+    unsampled->AddAtEnd(p);
+    NS_TEST_EXPECT_MSG_EQ((GetItemSizes(unsampled) == Sizes{}), true, "packet became sampled");
+    NS_TEST_EXPECT_MSG_EQ(unsampled->GetSize(), 157, "bad concatenation size");
+
+    // one packet in four is sampled
+    PacketMetadata::EnableSampling(4);
+    uint32_t sampled = 0;
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        p = Create<Packet>(10);
+        ADD_HEADER(p, 7);
+        auto sizes = GetItemSizes(p);
+        NS_TEST_EXPECT_MSG_EQ((sizes.empty() || sizes == Sizes{7, 10}), true, "bad sample");
+        sampled += sizes.empty() ? 0 : 1;
+    }
+    NS_TEST_EXPECT_MSG_EQ(sampled, 2, "unexpected number of sampled packets");
+
+    // record the metadata of all the packets for the other tests
+    PacketMetadata::DisableSampling();
+}
+
 /**
  * @ingroup network-test
  * @ingroup tests
@@ -886,6 +992,7 @@ PacketMetadataTestSuite::PacketMetadataTestSuite()
     : TestSuite("packet-metadata", Type::UNIT)
 {
     AddTestCase(new PacketMetadataTest, TestCase::Duration::QUICK);
+    AddTestCase(new PacketMetadataSamplingTest, TestCase::Duration::QUICK);
 }
 
 static PacketMetadataTestSuite g_packetMetadataTest; //!< Static variable for test initialization
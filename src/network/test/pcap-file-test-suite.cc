@@ -4,15 +4,21 @@
  * Author:  Craig Dowell (craigdo@ee.washington.edu)
  */
 
+#include "ns3/async-file-stream.h"
 #include "ns3/log.h"
+#include "ns3/output-stream-wrapper.h"
 #include "ns3/pcap-file.h"
+#include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/trace-helper.h"
 
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 using namespace ns3;
 
@@ -1364,6 +1370,224 @@ DiffTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(usec, 3696, "Files are different from 2.3696 seconds");
 }
 
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief Test case to make sure that the files written asynchronously hold
+ * the same records, in the same order, as the files written synchronously.
+ */
+class AsyncWriteTestCase : public TestCase
+{
+  public:
+    AsyncWriteTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+AsyncWriteTestCase::AsyncWriteTestCase()
+    : TestCase("Check that pcap and ASCII traces can be written asynchronously")
+{
+}
+
+void
+AsyncWriteTestCase::DoRun()
+{
+    //
+    // A ring much smaller than the records written makes the producer block
+    // on the writer thread over and over.
+    //
+    AsyncFileStream::Enable(64);
+    std::string pcapFilename = CreateTempDirFilename("async.pcap");
+    PcapFile f;
+    f.Open(pcapFilename, std::ios::out);
+    NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Open (" << pcapFilename << ") returns error");
+    f.Init(1, 1000);
+    uint8_t data[200];
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        memset(data, i & 0xff, sizeof(data));
+        f.Write(i, 0, data, i % 200);
+        NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Asynchronous Write () returns error");
+    }
+    f.Close();
+
+    std::string asciiFilename = CreateTempDirFilename("async.tr");
+    auto stream = Create<OutputStreamWrapper>(asciiFilename, std::ios::out);
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        *stream->GetStream() << "record " << i << std::endl;
+    }
+    stream = nullptr;
+    AsyncFileStream::Disable();
+
+    f.Open(pcapFilename, std::ios::in);
+    NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Open (" << pcapFilename << ") returns error");
+    uint32_t tsSec;
+    uint32_t tsUsec;
+    uint32_t inclLen;
+    uint32_t origLen;
+    uint32_t readLen;
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        f.Read(data, sizeof(data), tsSec, tsUsec, inclLen, origLen, readLen);
+        NS_TEST_ASSERT_MSG_EQ(f.Fail(), false, "Read () of record " << i << " returns error");
+        NS_TEST_ASSERT_MSG_EQ(tsSec, i, "Records are out of order");
+        NS_TEST_ASSERT_MSG_EQ(inclLen, i % 200, "Incorrect length of record " << i);
+        for (uint32_t j = 0; j < readLen; ++j)
+        {
+            NS_TEST_ASSERT_MSG_EQ(+data[j], (i & 0xff), "Incorrect data in record " << i);
+        }
+    }
+    f.Read(data, sizeof(data), tsSec, tsUsec, inclLen, origLen, readLen);
+    NS_TEST_ASSERT_MSG_EQ(f.Eof(), true, "Unexpected record at the end of the file");
+    f.Close();
+
+    std::ifstream ascii(asciiFilename);
+    std::string line;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        std::getline(ascii, line);
+        NS_TEST_ASSERT_MSG_EQ(line, "record " + std::to_string(i), "Lines are out of order");
+    }
+    NS_TEST_ASSERT_MSG_EQ(bool(std::getline(ascii, line)), false, "Unexpected trailing line");
+
+    //
+    // In drop mode, a record that does not fit in the ring is dropped as a
+    // whole, while the following ones are still written.
+    //
+    AsyncFileStream::Enable(64, true);
+    AsyncFileStream dropping(asciiFilename, std::ios::out);
+    dropping << "first" << std::endl;
+    dropping << std::string(100, 'x') << std::endl;
+    dropping << "last" << std::endl;
+    dropping.Close();
+    AsyncFileStream::Disable();
+    NS_TEST_ASSERT_MSG_EQ(dropping.fail(), false, "Close () returns error");
+    NS_TEST_ASSERT_MSG_EQ(dropping.GetDroppedRecords(), 1, "Wrong number of dropped records");
+    std::ifstream dropped(asciiFilename);
+    std::string contents((std::istreambuf_iterator<char>(dropped)),
+                         std::istreambuf_iterator<char>());
+    NS_TEST_ASSERT_MSG_EQ(contents, "first\nlast\n", "Wrong records written in drop mode");
+
+    remove(pcapFilename.c_str());
+    remove(asciiFilename.c_str());
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief Test case to make sure that the pcap traces of several devices can
+ * be written to a single pcapng file.
+ */
+class PcapngWriteTestCase : public TestCase
+{
+  public:
+    PcapngWriteTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PcapngWriteTestCase::PcapngWriteTestCase()
+    : TestCase("Check that PcapHelper can write the traces of several devices to a pcapng file")
+{
+}
+
+/**
+ * Read a 32-bit value written in the host byte order.
+ * @param p where to read the value
+ * @return the value
+ */
+static uint32_t
+Get32(const uint8_t* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void
+PcapngWriteTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("traces.pcapng");
+    PcapHelper::EnablePcapng(filename);
+    {
+        PcapHelper pcapHelper;
+        Ptr<PcapFileWrapper> first =
+            pcapHelper.CreateFile("prefix-0-1.pcap", std::ios::out, PcapHelper::DLT_EN10MB, 64);
+        Ptr<PcapFileWrapper> second =
+            pcapHelper.CreateFile("prefix-1-1.pcap", std::ios::out, PcapHelper::DLT_RAW);
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            Ptr<PcapFileWrapper> file = (i % 2 == 0) ? first : second;
+            file->Write(NanoSeconds(1000000007ULL * i), Create<Packet>(100 + i));
+            NS_TEST_ASSERT_MSG_EQ(file->Fail(), false, "Write () returns error");
+        }
+        // the packets written to a closed wrapper are dropped
+        first->Close();
+        first->Write(NanoSeconds(10000000070ULL), Create<Packet>(110));
+        NS_TEST_ASSERT_MSG_EQ(first->Fail(), false, "Write () after Close () returns error");
+    }
+    // the file is written by Simulator::Destroy, and closed when the wrappers release it
+    Simulator::Destroy();
+
+    std::ifstream in(filename, std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+    std::vector<std::vector<uint8_t>> blocks;
+    for (std::size_t offset = 0; offset + 12 <= data.size();)
+    {
+        uint32_t length = Get32(&data[offset + 4]);
+        NS_TEST_ASSERT_MSG_EQ((length % 4 == 0 && offset + length <= data.size()),
+                              true,
+                              "Invalid block length " << length);
+        NS_TEST_ASSERT_MSG_EQ(Get32(&data[offset + length - 4]),
+                              length,
+                              "Mismatched trailing block length");
+        blocks.emplace_back(data.begin() + offset, data.begin() + offset + length);
+        offset += length;
+    }
+    NS_TEST_ASSERT_MSG_EQ(blocks.size(), 13, "Expected 1 section, 2 interfaces and 10 packets");
+
+    NS_TEST_EXPECT_MSG_EQ(Get32(&blocks[0][0]), 0x0a0d0d0a, "Missing section header block");
+    NS_TEST_EXPECT_MSG_EQ(Get32(&blocks[0][8]), 0x1a2b3c4d, "Wrong byte-order magic");
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        const auto& idb = blocks[1 + i];
+        NS_TEST_EXPECT_MSG_EQ(Get32(&idb[0]), 1, "Missing interface description block");
+        uint16_t linkType;
+        uint16_t nameLength;
+        memcpy(&linkType, &idb[8], sizeof(linkType));
+        memcpy(&nameLength, &idb[18], sizeof(nameLength));
+        NS_TEST_EXPECT_MSG_EQ(linkType,
+                              (i == 0 ? PcapHelper::DLT_EN10MB : PcapHelper::DLT_RAW),
+                              "Wrong data link type of interface " << i);
+        NS_TEST_EXPECT_MSG_EQ(Get32(&idb[12]),
+                              (i == 0 ? 64 : PcapFile::SNAPLEN_DEFAULT),
+                              "Wrong snapshot length of interface " << i);
+        std::string name(reinterpret_cast<const char*>(&idb[20]), nameLength);
+        NS_TEST_EXPECT_MSG_EQ(name,
+                              (i == 0 ? "prefix-0-1" : "prefix-1-1"),
+                              "Wrong name of interface " << i);
+    }
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        const auto& epb = blocks[3 + i];
+        uint64_t timestamp = (uint64_t{Get32(&epb[12])} << 32) | Get32(&epb[16]);
+        NS_TEST_EXPECT_MSG_EQ(Get32(&epb[0]), 6, "Missing enhanced packet block");
+        NS_TEST_EXPECT_MSG_EQ(Get32(&epb[8]), i % 2, "Wrong interface of packet " << i);
+        NS_TEST_EXPECT_MSG_EQ(timestamp, 1000000007ULL * i, "Wrong timestamp of packet " << i);
+        NS_TEST_EXPECT_MSG_EQ(Get32(&epb[20]),
+                              (i % 2 == 0 ? 64 : 100 + i),
+                              "Wrong captured length of packet " << i);
+        NS_TEST_EXPECT_MSG_EQ(Get32(&epb[24]), 100 + i, "Wrong length of packet " << i);
+    }
+    remove(filename.c_str());
+}
+
 /**
  * @ingroup network-test
  * @ingroup tests
@@ -1387,6 +1611,8 @@ PcapFileTestSuite::PcapFileTestSuite()
     AddTestCase(new RecordHeaderTestCase, TestCase::Duration::QUICK);
     AddTestCase(new ReadFileTestCase, TestCase::Duration::QUICK);
     AddTestCase(new DiffTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new AsyncWriteTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new PcapngWriteTestCase, TestCase::Duration::QUICK);
 }
 
 static PcapFileTestSuite pcapFileTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,490 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "async-file-stream.h"
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fcntl.h>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("AsyncFileStream");
+
+/**
+ * @ingroup network
+ *
+ * @brief The writer thread shared by all the open AsyncFileBuf objects.
+ *
+ * The thread holds the lock while it writes the published bytes of the
+ * buffers to their files, and sleeps between two rounds until a buffer has
+ * published enough bytes or a short timeout expires.  A producer that finds
+ * its ring full takes the lock, which waits for the current round to end, and
+ * drains its own ring.
+ *
+ * The writer is never destroyed.  Like with a std::ofstream that is never
+ * destroyed, the records of a stream that is never closed may be lost at
+ * exit.  No logging is done from the writer thread, since the log prefixes
+ * query the simulator.
+ */
+class AsyncFileWriter
+{
+  public:
+    /**
+     * @return the writer
+     */
+    static AsyncFileWriter& Get();
+
+    /**
+     * Add a buffer to the ones the thread drains, starting the thread if needed.
+     * @param buf the buffer
+     */
+    void Register(AsyncFileBuf* buf);
+    /**
+     * Drain a buffer for the last time and remove it from the ones the thread
+     * drains, stopping the thread if it was the last one.
+     * @param buf the buffer
+     */
+    void Unregister(AsyncFileBuf* buf);
+    /**
+     * Wait for the current round of the thread to end and drain a buffer.
+     * @param buf the buffer
+     */
+    void Drain(AsyncFileBuf* buf);
+    /**
+     * Wake the thread up.
+     */
+    void Wake();
+
+  private:
+    AsyncFileWriter();
+
+    /**
+     * Body of the thread.
+     */
+    void Run();
+
+    std::mutex m_mutex;              //!< lock protecting the list and the draining
+    std::condition_variable m_wake;  //!< signaled to wake the thread up
+    std::list<AsyncFileBuf*> m_bufs; //!< buffers drained by the thread
+    std::thread m_thread;            //!< the thread
+    bool m_stop;                     //!< whether the thread must stop
+};
+
+AsyncFileWriter&
+AsyncFileWriter::Get()
+{
+    // never destroyed, so that the streams closed by static destructors can still use it
+    static auto writer = new AsyncFileWriter();
+    return *writer;
+}
+
+AsyncFileWriter::AsyncFileWriter()
+    : m_stop(false)
+{
+}
+
+void
+AsyncFileWriter::Register(AsyncFileBuf* buf)
+{
+    std::unique_lock lock(m_mutex);
+    m_bufs.push_back(buf);
+    if (!m_thread.joinable())
+    {
+        m_stop = false;
+        m_thread = std::thread(&AsyncFileWriter::Run, this);
+    }
+}
+
+void
+AsyncFileWriter::Unregister(AsyncFileBuf* buf)
+{
+    std::thread thread;
+    {
+        std::unique_lock lock(m_mutex);
+        buf->Drain();
+        m_bufs.remove(buf);
+        if (m_bufs.empty())
+        {
+            m_stop = true;
+            thread = std::move(m_thread);
+        }
+    }
+    if (thread.joinable())
+    {
+        m_wake.notify_one();
+        thread.join();
+    }
+}
+
+void
+AsyncFileWriter::Drain(AsyncFileBuf* buf)
+{
+    std::unique_lock lock(m_mutex);
+    buf->Drain();
+}
+
+void
+AsyncFileWriter::Wake()
+{
+    m_wake.notify_one();
+}
+
+void
+AsyncFileWriter::Run()
+{
+    std::unique_lock lock(m_mutex);
+    while (!m_stop)
+    {
+        bool written = false;
+        for (auto buf : m_bufs)
+        {
+            written |= buf->Drain();
+        }
+        if (!written)
+        {
+            m_wake.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+}
+
+AsyncFileBuf::AsyncFileBuf()
+    : m_fd(-1),
+      m_dropOnFull(false),
+      m_dropping(false),
+      m_putBase(0),
+      m_record(0),
+      m_fileBase(0),
+      m_dropped(0),
+      m_head(0),
+      m_tail(0),
+      m_error(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AsyncFileBuf::~AsyncFileBuf()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+AsyncFileBuf::Open(const std::string& filename,
+                   std::ios::openmode mode,
+                   uint32_t capacity,
+                   bool dropOnFull)
+{
+    NS_LOG_FUNCTION(this << filename << mode << capacity << dropOnFull);
+    NS_ASSERT_MSG((mode & std::ios::in) == 0, "Asynchronous files are write-only");
+    NS_ASSERT(capacity > 0);
+    if (IsOpen())
+    {
+        return false;
+    }
+    int flags = O_WRONLY | O_CREAT | ((mode & std::ios::app) ? O_APPEND : O_TRUNC);
+    m_fd = open(filename.c_str(), flags, 0644);
+    if (m_fd < 0)
+    {
+        NS_LOG_ERROR("Cannot open " << filename << ": " << std::strerror(errno));
+        return false;
+    }
+    off_t end = lseek(m_fd, 0, SEEK_END);
+    m_fileBase = end > 0 ? end : 0;
+    m_ring.assign(capacity, 0);
+    m_dropOnFull = dropOnFull;
+    m_dropping = false;
+    m_record = 0;
+    m_dropped = 0;
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    m_error.store(false, std::memory_order_relaxed);
+    SetPutArea(0);
+    AsyncFileWriter::Get().Register(this);
+    return true;
+}
+
+bool
+AsyncFileBuf::IsOpen() const
+{
+    return m_fd >= 0;
+}
+
+bool
+AsyncFileBuf::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (!IsOpen())
+    {
+        return true;
+    }
+    // a record dropped when the ring was full is not terminated by a flush
+    if (m_dropping)
+    {
+        m_dropping = false;
+        m_dropped++;
+    }
+    else
+    {
+        Publish();
+    }
+    AsyncFileWriter::Get().Unregister(this);
+    setp(nullptr, nullptr);
+    bool ok = !m_error.load(std::memory_order_relaxed);
+    if (close(m_fd) != 0)
+    {
+        ok = false;
+    }
+    m_fd = -1;
+    m_ring.clear();
+    m_ring.shrink_to_fit();
+    if (m_dropped > 0)
+    {
+        NS_LOG_WARN(m_dropped << " records dropped because the buffer was full");
+    }
+    return ok;
+}
+
+uint64_t
+AsyncFileBuf::GetDroppedRecords() const
+{
+    return m_dropped;
+}
+
+uint64_t
+AsyncFileBuf::GetPutPosition() const
+{
+    return m_putBase + (pptr() - pbase());
+}
+
+void
+AsyncFileBuf::SetPutArea(uint64_t position)
+{
+    const uint64_t capacity = m_ring.size();
+    const uint64_t used = position - m_tail.load(std::memory_order_acquire);
+    const uint64_t start = position % capacity;
+    const uint64_t size = std::min(capacity - start, capacity - used);
+    setp(m_ring.data() + start, m_ring.data() + start + size);
+    m_putBase = position;
+}
+
+void
+AsyncFileBuf::Publish()
+{
+    const uint64_t position = GetPutPosition();
+    m_head.store(position, std::memory_order_release);
+    m_record = position;
+    // wake the writer up early rather than letting the ring fill up
+    if (position - m_tail.load(std::memory_order_relaxed) >= m_ring.size() / 4)
+    {
+        AsyncFileWriter::Get().Wake();
+    }
+}
+
+bool
+AsyncFileBuf::Drain()
+{
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    if (tail == head)
+    {
+        return false;
+    }
+    const uint64_t capacity = m_ring.size();
+    while (tail < head)
+    {
+        const uint64_t start = tail % capacity;
+        const uint64_t size = std::min(head - tail, capacity - start);
+        ssize_t written = write(m_fd, m_ring.data() + start, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // release the space anyway, so that the producer never waits forever
+            m_error.store(true, std::memory_order_relaxed);
+            tail = head;
+            break;
+        }
+        tail += written;
+    }
+    m_tail.store(tail, std::memory_order_release);
+    return true;
+}
+
+AsyncFileBuf::int_type
+AsyncFileBuf::overflow(int_type c)
+{
+    if (!IsOpen() || m_error.load(std::memory_order_relaxed))
+    {
+        return traits_type::eof();
+    }
+    if (m_dropping)
+    {
+        return traits_type::not_eof(c);
+    }
+    const uint64_t position = GetPutPosition();
+    if (position - m_tail.load(std::memory_order_acquire) == m_ring.size())
+    {
+        if (m_dropOnFull)
+        {
+            // discard the bytes of the current record, including the ones already in the ring
+            m_dropping = true;
+            m_putBase = m_record;
+            setp(nullptr, nullptr);
+            return traits_type::not_eof(c);
+        }
+        Publish();
+        AsyncFileWriter::Get().Drain(this);
+        if (m_error.load(std::memory_order_relaxed))
+        {
+            return traits_type::eof();
+        }
+    }
+    SetPutArea(position);
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+int
+AsyncFileBuf::sync()
+{
+    if (!IsOpen())
+    {
+        return 0;
+    }
+    if (m_dropping)
+    {
+        m_dropping = false;
+        m_dropped++;
+        SetPutArea(m_record);
+    }
+    else
+    {
+        Publish();
+    }
+    return m_error.load(std::memory_order_relaxed) ? -1 : 0;
+}
+
+AsyncFileBuf::pos_type
+AsyncFileBuf::seekoff(off_type off, std::ios::seekdir dir, std::ios::openmode which)
+{
+    if (dir == std::ios::cur)
+    {
+        return seekpos(pos_type(m_fileBase + GetPutPosition() + off), which);
+    }
+    if (dir == std::ios::beg)
+    {
+        return seekpos(pos_type(off), which);
+    }
+    return pos_type(off_type(-1));
+}
+
+AsyncFileBuf::pos_type
+AsyncFileBuf::seekpos(pos_type pos, std::ios::openmode which)
+{
+    // the file is written sequentially: only the current position can be sought
+    const uint64_t current = m_fileBase + GetPutPosition();
+    if (!IsOpen() || (which & std::ios::out) == 0 || off_type(pos) != off_type(current))
+    {
+        return pos_type(off_type(-1));
+    }
+    return pos;
+}
+
+bool AsyncFileStream::m_enabled = false;
+uint32_t AsyncFileStream::m_bufferSize = AsyncFileStream::DEFAULT_BUFFER_SIZE;
+bool AsyncFileStream::m_dropOnFull = false;
+
+void
+AsyncFileStream::Enable(uint32_t bufferSize, bool dropOnFull)
+{
+    NS_LOG_FUNCTION(bufferSize << dropOnFull);
+    NS_ASSERT_MSG(bufferSize > 0, "The buffer of asynchronous files cannot be empty");
+    m_enabled = true;
+    m_bufferSize = bufferSize;
+    m_dropOnFull = dropOnFull;
+}
+
+void
+AsyncFileStream::Disable()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_enabled = false;
+}
+
+bool
+AsyncFileStream::IsEnabled()
+{
+    return m_enabled;
+}
+
+AsyncFileStream::AsyncFileStream()
+    : std::ostream(nullptr)
+{
+    NS_LOG_FUNCTION(this);
+    rdbuf(&m_buf);
+}
+
+AsyncFileStream::AsyncFileStream(const std::string& filename, std::ios::openmode mode)
+    : std::ostream(nullptr)
+{
+    NS_LOG_FUNCTION(this << filename << mode);
+    rdbuf(&m_buf);
+    Open(filename, mode);
+}
+
+void
+AsyncFileStream::Open(const std::string& filename, std::ios::openmode mode)
+{
+    NS_LOG_FUNCTION(this << filename << mode);
+    if (m_buf.Open(filename, mode, m_bufferSize, m_dropOnFull))
+    {
+        clear();
+    }
+    else
+    {
+        setstate(std::ios::failbit);
+    }
+}
+
+bool
+AsyncFileStream::IsOpen() const
+{
+    return m_buf.IsOpen();
+}
+
+void
+AsyncFileStream::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_buf.Close())
+    {
+        setstate(std::ios::failbit);
+    }
+}
+
+uint64_t
+AsyncFileStream::GetDroppedRecords() const
+{
+    return m_buf.GetDroppedRecords();
+}
+
+} // namespace ns3
@@ -0,0 +1,201 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ASYNC_FILE_STREAM_H
+#define ASYNC_FILE_STREAM_H
+
+#include <atomic>
+#include <ios>
+#include <ostream>
+#include <stdint.h>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class AsyncFileWriter;
+
+/**
+ * @ingroup network
+ *
+ * @brief Stream buffer handing the bytes written into it over to the
+ * asynchronous trace writer thread.
+ *
+ * The buffer is a lock-free single-producer single-consumer ring.  The thread
+ * writing into the stream fills the ring directly through the put area of the
+ * std::streambuf and publishes the bytes written so far each time the stream
+ * is flushed; the writer thread writes the published bytes to the file in
+ * large sequential writes and releases their space in the ring.  A trace
+ * record is therefore the sequence of bytes written between two flushes,
+ * which matches both the ASCII trace sinks (one line terminated by std::endl)
+ * and the pcap records written by PcapFile.
+ *
+ * When the ring is full, the producer either blocks until the writer thread
+ * has released some space (the default), or drops the record being written
+ * and counts it (see AsyncFileStream::Enable).  In both cases, the records
+ * that are written keep their original order.
+ */
+class AsyncFileBuf : public std::streambuf
+{
+  public:
+    AsyncFileBuf();
+    ~AsyncFileBuf() override;
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    AsyncFileBuf(const AsyncFileBuf&) = delete;
+    AsyncFileBuf& operator=(const AsyncFileBuf&) = delete;
+
+    /**
+     * Open a file for writing.
+     *
+     * @param filename the name of the file
+     * @param mode the open mode, which must not include std::ios::in
+     * @param capacity the size of the ring, in bytes
+     * @param dropOnFull whether to drop records when the ring is full,
+     *        rather than waiting for the writer thread
+     * @return true if the file could be opened
+     */
+    bool Open(const std::string& filename,
+              std::ios::openmode mode,
+              uint32_t capacity,
+              bool dropOnFull);
+    /**
+     * @return true if a file is open
+     */
+    bool IsOpen() const;
+    /**
+     * Write all the bytes still in the ring to the file and close it.
+     * @return false if some bytes could not be written to the file
+     */
+    bool Close();
+    /**
+     * @return the number of records dropped because the ring was full
+     */
+    uint64_t GetDroppedRecords() const;
+
+  protected:
+    int_type overflow(int_type c) override;
+    int sync() override;
+    pos_type seekoff(off_type off,
+                     std::ios::seekdir dir,
+                     std::ios::openmode which = std::ios::out) override;
+    pos_type seekpos(pos_type pos, std::ios::openmode which = std::ios::out) override;
+
+  private:
+    friend class AsyncFileWriter;
+
+    /**
+     * @return the position in the stream of the next byte to write
+     */
+    uint64_t GetPutPosition() const;
+    /**
+     * Map the put area onto the free space of the ring following a position.
+     * @param position the position in the stream of the start of the put area
+     */
+    void SetPutArea(uint64_t position);
+    /**
+     * Make the bytes written so far available to the writer thread.
+     */
+    void Publish();
+    /**
+     * Write the published bytes to the file.  Called with the writer lock held.
+     * @return true if some bytes were written
+     */
+    bool Drain();
+
+    std::vector<char> m_ring; //!< ring of bytes not written to the file yet
+    int m_fd;                 //!< file descriptor, -1 when closed
+    bool m_dropOnFull;        //!< drop records rather than blocking when the ring is full
+    bool m_dropping;          //!< whether the record being written is dropped
+    uint64_t m_putBase;       //!< position in the stream of the start of the put area
+    uint64_t m_record;        //!< position in the stream of the start of the current record
+    uint64_t m_fileBase;      //!< offset in the file of the start of the stream
+    uint64_t m_dropped;       //!< number of dropped records
+
+    std::atomic<uint64_t> m_head; //!< position of the end of the published bytes
+    std::atomic<uint64_t> m_tail; //!< position of the end of the bytes written to the file
+    std::atomic<bool> m_error;    //!< whether writing to the file failed
+};
+
+/**
+ * @ingroup network
+ *
+ * @brief Output file stream whose writes to the file are done by a dedicated
+ * writer thread.
+ *
+ * Trace files written through PcapFile and through the OutputStreamWrapper
+ * objects created for a file name use this stream instead of a std::fstream
+ * when asynchronous writes are enabled with AsyncFileStream::Enable, so that
+ * the simulation thread only copies the records into memory.  All the
+ * asynchronous streams share a single writer thread, which runs while at
+ * least one of them is open.
+ *
+ * The records are flushed to the file when the stream is closed or destroyed.
+ * Records still in memory are lost if the program is aborted.
+ */
+class AsyncFileStream : public std::ostream
+{
+  public:
+    /// Default size of the ring of each stream, in bytes
+    static constexpr uint32_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+    /**
+     * Make the trace files opened from now on be written asynchronously.
+     *
+     * @param bufferSize the size of the ring of each file, in bytes
+     * @param dropOnFull whether to drop records when a ring is full, rather
+     *        than blocking until the writer thread has made some room
+     */
+    static void Enable(uint32_t bufferSize = DEFAULT_BUFFER_SIZE, bool dropOnFull = false);
+    /**
+     * Make the trace files opened from now on be written synchronously.
+     */
+    static void Disable();
+    /**
+     * @return true if the trace files opened now are written asynchronously
+     */
+    static bool IsEnabled();
+
+    AsyncFileStream();
+    /**
+     * Construct and open a file.
+     * @param filename the name of the file
+     * @param mode the open mode, which must not include std::ios::in
+     */
+    AsyncFileStream(const std::string& filename, std::ios::openmode mode);
+
+    /**
+     * Open a file, with the buffer size and the policy configured by Enable().
+     * The fail bit is set if the file cannot be opened.
+     * @param filename the name of the file
+     * @param mode the open mode, which must not include std::ios::in
+     */
+    void Open(const std::string& filename, std::ios::openmode mode);
+    /**
+     * @return true if a file is open
+     */
+    bool IsOpen() const;
+    /**
+     * Write all the pending records to the file and close it.  The fail bit
+     * is set if some records could not be written.
+     */
+    void Close();
+    /**
+     * @return the number of records dropped because the ring was full
+     */
+    uint64_t GetDroppedRecords() const;
+
+  private:
+    AsyncFileBuf m_buf; //!< stream buffer
+
+    static bool m_enabled;        //!< whether asynchronous writes are enabled
+    static uint32_t m_bufferSize; //!< size of the ring of each stream
+    static bool m_dropOnFull;     //!< whether records are dropped when a ring is full
+};
+
+} // namespace ns3
+
+#endif /* ASYNC_FILE_STREAM_H */
@@ -62,6 +62,11 @@ class OutputStreamWrapper : public SimpleRefCount<OutputStreamWrapper>
   public:
     /**
      * Constructor
+     *
+     * The file is written by the asynchronous trace writer thread if
+     * asynchronous writes are enabled (see AsyncFileStream::Enable) and
+     * @p filemode does not include std::ios::in.
+     *
      * @param filename file name
      * @param filemode std::ios::openmode flags
      */
@@ -6,6 +6,7 @@
 
 #include "pcap-file-wrapper.h"
 
+#include "ns3/assert.h"
 #include "ns3/boolean.h"
 #include "ns3/buffer.h"
 #include "ns3/header.h"
@@ -42,6 +43,8 @@ PcapFileWrapper::GetTypeId()
 }
 
 PcapFileWrapper::PcapFileWrapper()
+    : m_usesPcapng(false),
+      m_interface(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -56,6 +59,10 @@ bool
 PcapFileWrapper::Fail() const
 {
     NS_LOG_FUNCTION(this);
+    if (m_usesPcapng)
+    {
+        return m_pcapng && m_pcapng->Fail();
+    }
     return m_file.Fail();
 }
 
@@ -77,6 +84,8 @@ void
 PcapFileWrapper::Close()
 {
     NS_LOG_FUNCTION(this);
+    // the pcapng file is closed when the last of its interfaces is
+    m_pcapng = nullptr;
     m_file.Close();
 }
 
@@ -84,9 +93,19 @@ void
 PcapFileWrapper::Open(const std::string& filename, std::ios::openmode mode)
 {
     NS_LOG_FUNCTION(this << filename << mode);
+    m_usesPcapng = false;
     m_file.Open(filename, mode);
 }
 
+void
+PcapFileWrapper::Open(Ptr<PcapngFile> file, const std::string& interfaceName)
+{
+    NS_LOG_FUNCTION(this << file << interfaceName);
+    m_usesPcapng = true;
+    m_pcapng = file;
+    m_interfaceName = interfaceName;
+}
+
 void
 PcapFileWrapper::Init(uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrection)
 {
@@ -96,6 +115,13 @@ PcapFileWrapper::Init(uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrect
     // a snaplen, we use the one provided.
     //
     NS_LOG_FUNCTION(this << dataLinkType << snapLen << tzCorrection);
+    if (m_usesPcapng)
+    {
+        NS_ASSERT_MSG(m_pcapng, "The pcapng file is closed");
+        snapLen = snapLen != std::numeric_limits<uint32_t>::max() ? snapLen : m_snapLen;
+        m_interface = m_pcapng->AddInterface(dataLinkType, snapLen, m_interfaceName);
+        return;
+    }
     if (snapLen != std::numeric_limits<uint32_t>::max())
     {
         m_file.Init(dataLinkType, snapLen, tzCorrection, false, m_nanosecMode);
@@ -110,6 +136,15 @@ void
 PcapFileWrapper::Write(Time t, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << p);
+    if (m_usesPcapng)
+    {
+        // the packets written after Close are dropped, as by a closed pcap file
+        if (m_pcapng)
+        {
+            m_pcapng->Write(m_interface, t.GetNanoSeconds(), p);
+        }
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
@@ -130,6 +165,14 @@ void
 PcapFileWrapper::Write(Time t, const Header& header, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << t << &header << p);
+    if (m_usesPcapng)
+    {
+        if (m_pcapng)
+        {
+            m_pcapng->Write(m_interface, t.GetNanoSeconds(), header, p);
+        }
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
@@ -150,6 +193,14 @@ void
 PcapFileWrapper::Write(Time t, const uint8_t* buffer, uint32_t length)
 {
     NS_LOG_FUNCTION(this << t << &buffer << length);
+    if (m_usesPcapng)
+    {
+        if (m_pcapng)
+        {
+            m_pcapng->Write(m_interface, t.GetNanoSeconds(), buffer, length);
+        }
+        return;
+    }
     if (m_file.IsNanoSecMode())
     {
         uint64_t current = t.GetNanoSeconds();
@@ -177,6 +228,7 @@ PcapFileWrapper::Read(Time& t)
 
     uint8_t datbuf[65536];
 
+    NS_ASSERT_MSG(!m_usesPcapng, "Packets cannot be read from a pcapng file");
     m_file.Read(datbuf, 65536, tsSec, tsUsec, inclLen, origLen, readLen);
 
     if (m_file.Fail())
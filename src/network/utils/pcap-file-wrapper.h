@@ -8,6 +8,7 @@
 #define PCAP_FILE_WRAPPER_H
 
 #include "pcap-file.h"
+#include "pcapng-file.h"
 
 #include "ns3/nstime.h"
 #include "ns3/object.h"
@@ -67,6 +68,17 @@ class PcapFileWrapper : public Object
      */
     void Open(const std::string& filename, std::ios::openmode mode);
 
+    /**
+     * Write the packets to an interface of a pcapng file, possibly shared with
+     * other PcapFileWrapper objects, instead of to a pcap file.  The interface
+     * is added to the file by Init, and the packets are written with
+     * nanosecond timestamps.  This wrapper cannot be used to read packets.
+     *
+     * @param file the pcapng file, which must be open.
+     * @param interfaceName the name of the interface.
+     */
+    void Open(Ptr<PcapngFile> file, const std::string& interfaceName);
+
     /**
      * Close the underlying pcap file.
      */
@@ -214,6 +226,11 @@ class PcapFileWrapper : public Object
     PcapFile m_file;    //!< Pcap file
     uint32_t m_snapLen; //!< max length of saved packets
     bool m_nanosecMode; //!< Timestamps in nanosecond mode
+
+    bool m_usesPcapng;           //!< whether the packets are written to a pcapng file
+    Ptr<PcapngFile> m_pcapng;    //!< pcapng file the packets are written to, null once closed
+    std::string m_interfaceName; //!< name of the interface of the pcapng file
+    uint32_t m_interface;        //!< identifier of the interface of the pcapng file
 };
 
 } // namespace ns3
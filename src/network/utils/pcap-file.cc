@@ -42,17 +42,20 @@ const uint16_t VERSION_MINOR = 4; /**< Minor version of supported pcap file form
 
 PcapFile::PcapFile()
     : m_file(),
+      m_ostream(&m_file),
       m_swapMode(false),
       m_nanosecMode(false)
 {
     NS_LOG_FUNCTION(this);
     FatalImpl::RegisterStream(&m_file);
+    FatalImpl::RegisterStream(&m_asyncFile);
 }
 
 PcapFile::~PcapFile()
 {
     NS_LOG_FUNCTION(this);
     FatalImpl::UnregisterStream(&m_file);
+    FatalImpl::UnregisterStream(&m_asyncFile);
     Close();
 }
 
@@ -60,7 +63,7 @@ bool
 PcapFile::Fail() const
 {
     NS_LOG_FUNCTION(this);
-    return m_file.fail();
+    return m_ostream->fail();
 }
 
 bool
@@ -74,13 +77,18 @@ void
 PcapFile::Clear()
 {
     NS_LOG_FUNCTION(this);
-    m_file.clear();
+    m_ostream->clear();
 }
 
 void
 PcapFile::Close()
 {
     NS_LOG_FUNCTION(this);
+    if (m_ostream == &m_asyncFile)
+    {
+        m_asyncFile.Close();
+        return;
+    }
     m_file.close();
 }
 
@@ -200,7 +208,7 @@ PcapFile::WriteFileHeader()
     // If we're initializing the file, we need to write the pcap file header
     // at the start of the file.
     //
-    m_file.seekp(0, std::ios::beg);
+    m_ostream->seekp(0, std::ios::beg);
 
     //
     // We have the ability to write out the pcap file header in a foreign endian
@@ -228,13 +236,13 @@ PcapFile::WriteFileHeader()
     // Watch out for memory alignment differences between machines, so write
     // them all individually.
     //
-    m_file.write((const char*)&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
-    m_file.write((const char*)&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
-    m_file.write((const char*)&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
-    m_file.write((const char*)&headerOut->m_zone, sizeof(headerOut->m_zone));
-    m_file.write((const char*)&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
-    m_file.write((const char*)&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
-    m_file.write((const char*)&headerOut->m_type, sizeof(headerOut->m_type));
+    m_ostream->write((const char*)&headerOut->m_magicNumber, sizeof(headerOut->m_magicNumber));
+    m_ostream->write((const char*)&headerOut->m_versionMajor, sizeof(headerOut->m_versionMajor));
+    m_ostream->write((const char*)&headerOut->m_versionMinor, sizeof(headerOut->m_versionMinor));
+    m_ostream->write((const char*)&headerOut->m_zone, sizeof(headerOut->m_zone));
+    m_ostream->write((const char*)&headerOut->m_sigFigs, sizeof(headerOut->m_sigFigs));
+    m_ostream->write((const char*)&headerOut->m_snapLen, sizeof(headerOut->m_snapLen));
+    m_ostream->write((const char*)&headerOut->m_type, sizeof(headerOut->m_type));
 }
 
 void
@@ -321,14 +329,21 @@ PcapFile::Open(const std::string& filename, std::ios::openmode mode)
 {
     NS_LOG_FUNCTION(this << filename << mode);
     NS_ASSERT((mode & std::ios::app) == 0);
-    NS_ASSERT(!m_file.fail());
+    NS_ASSERT(!Fail());
     //
     // All pcap files are binary files, so we just do this automatically.
     //
     mode |= std::ios::binary;
 
     m_filename = filename;
+    if ((mode & std::ios::in) == 0 && AsyncFileStream::IsEnabled())
+    {
+        m_asyncFile.Open(filename, mode);
+        m_ostream = &m_asyncFile;
+        return;
+    }
     m_file.open(filename, mode);
+    m_ostream = &m_file;
     if (mode & std::ios::in)
     {
         // will set the fail bit if file header is invalid.
@@ -396,13 +411,14 @@ PcapFile::Init(uint32_t dataLinkType,
     m_swapMode = swapMode || bigEndian;
 
     WriteFileHeader();
+    EndRecord();
 }
 
 uint32_t
 PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << totalLen);
-    NS_ASSERT(m_file.good());
+    NS_ASSERT(m_ostream->good());
 
     uint32_t inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
 
@@ -421,11 +437,10 @@ PcapFile::WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
     // Watch out for memory alignment differences between machines, so write
     // them all individually.
     //
-    m_file.write((const char*)&header.m_tsSec, sizeof(header.m_tsSec));
-    m_file.write((const char*)&header.m_tsUsec, sizeof(header.m_tsUsec));
-    m_file.write((const char*)&header.m_inclLen, sizeof(header.m_inclLen));
-    m_file.write((const char*)&header.m_origLen, sizeof(header.m_origLen));
-    NS_BUILD_DEBUG(m_file.flush());
+    m_ostream->write((const char*)&header.m_tsSec, sizeof(header.m_tsSec));
+    m_ostream->write((const char*)&header.m_tsUsec, sizeof(header.m_tsUsec));
+    m_ostream->write((const char*)&header.m_inclLen, sizeof(header.m_inclLen));
+    m_ostream->write((const char*)&header.m_origLen, sizeof(header.m_origLen));
     return inclLen;
 }
 
@@ -434,8 +449,8 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const uint8_t* const data, uint
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << &data << totalLen);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, totalLen);
-    m_file.write((const char*)data, inclLen);
-    NS_BUILD_DEBUG(m_file.flush());
+    m_ostream->write((const char*)data, inclLen);
+    EndRecord();
 }
 
 void
@@ -443,8 +458,8 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
 {
     NS_LOG_FUNCTION(this << tsSec << tsUsec << p);
     uint32_t inclLen = WritePacketHeader(tsSec, tsUsec, p->GetSize());
-    p->CopyData(&m_file, inclLen);
-    NS_BUILD_DEBUG(m_file.flush());
+    p->CopyData(m_ostream, inclLen);
+    EndRecord();
 }
 
 void
@@ -459,9 +474,22 @@ PcapFile::Write(uint32_t tsSec, uint32_t tsUsec, const Header& header, Ptr<const
     headerBuffer.AddAtStart(headerSize);
     header.Serialize(headerBuffer.Begin());
     uint32_t toCopy = std::min(headerSize, inclLen);
-    headerBuffer.CopyData(&m_file, toCopy);
+    headerBuffer.CopyData(m_ostream, toCopy);
     inclLen -= toCopy;
-    p->CopyData(&m_file, inclLen);
+    p->CopyData(m_ostream, inclLen);
+    EndRecord();
+}
+
+void
+PcapFile::EndRecord()
+{
+    if (m_ostream == &m_asyncFile)
+    {
+        // the asynchronous stream hands each record over to its writer thread when flushed
+        m_asyncFile.flush();
+        return;
+    }
+    NS_BUILD_DEBUG(m_file.flush());
 }
 
 void
@@ -9,6 +9,8 @@
 #ifndef PCAP_FILE_H
 #define PCAP_FILE_H
 
+#include "async-file-stream.h"
+
 #include "ns3/ptr.h"
 
 #include <fstream>
@@ -64,6 +66,10 @@ class PcapFile
      * selected as a binary file (fstream::binary is automatically ored with the mode
      * field).
      *
+     * If asynchronous writes are enabled (see AsyncFileStream::Enable) and the
+     * file is opened for writing only, the records are written to the file by
+     * the asynchronous trace writer thread.
+     *
      * @param filename String containing the name of the file.
      *
      * @param mode the access mode for the file.
@@ -357,6 +363,11 @@ class PcapFile
      */
     uint32_t WritePacketHeader(uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen);
 
+    /**
+     * @brief Mark the end of a record written to the file
+     */
+    void EndRecord();
+
     /**
      * @brief Read and verify a Pcap file header
      */
@@ -364,6 +375,8 @@ class PcapFile
 
     std::string m_filename;      //!< file name
     std::fstream m_file;         //!< file stream
+    AsyncFileStream m_asyncFile; //!< file stream used for asynchronous writes
+    std::ostream* m_ostream;     //!< stream the records are written to
     PcapFileHeader m_fileHeader; //!< file header
     bool m_swapMode;             //!< swap mode
     bool m_nanosecMode;          //!< nanosecond timestamp mode
@@ -0,0 +1,250 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "pcapng-file.h"
+
+#include "ns3/assert.h"
+#include "ns3/buffer.h"
+#include "ns3/header.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PcapngFile");
+
+const uint32_t SECTION_HEADER_BLOCK = 0x0a0d0d0a; /**< Type of the section header block */
+const uint32_t INTERFACE_DESCRIPTION_BLOCK = 1;   /**< Type of the interface description block */
+const uint32_t ENHANCED_PACKET_BLOCK = 6;         /**< Type of the enhanced packet block */
+const uint32_t BYTE_ORDER_MAGIC = 0x1a2b3c4d;     /**< Identifies the byte order of a section */
+const uint16_t VERSION_MAJOR = 1;                 /**< Major version of the pcapng format */
+const uint16_t VERSION_MINOR = 0;                 /**< Minor version of the pcapng format */
+const uint16_t OPT_ENDOFOPT = 0;                  /**< Code of the end of options option */
+const uint16_t IF_NAME = 2;                       /**< Code of the interface name option */
+const uint16_t IF_TSRESOL = 9;                    /**< Code of the timestamp resolution option */
+const uint8_t TSRESOL_NANOSECONDS = 9;            /**< Timestamps in units of 10^-9 seconds */
+
+/**
+ * @param length a length, in bytes
+ * @return the length padded to a multiple of 32 bits
+ */
+static uint32_t
+Pad(uint32_t length)
+{
+    return (length + 3) & ~3U;
+}
+
+/**
+ * Store a 16-bit value in the host byte order.
+ * @param p where to store the value
+ * @param value the value
+ */
+static void
+Put16(uint8_t* p, uint16_t value)
+{
+    std::memcpy(p, &value, sizeof(value));
+}
+
+/**
+ * Store a 32-bit value in the host byte order.
+ * @param p where to store the value
+ * @param value the value
+ */
+static void
+Put32(uint8_t* p, uint32_t value)
+{
+    std::memcpy(p, &value, sizeof(value));
+}
+
+/**
+ * Append a zero-filled block to a buffer, and store its type and length.
+ * @param buffer the buffer
+ * @param type the type of the block
+ * @param length the total length of the block, including its type and lengths
+ * @return a pointer to the block
+ */
+static uint8_t*
+AppendBlock(std::vector<uint8_t>& buffer, uint32_t type, uint32_t length)
+{
+    std::size_t offset = buffer.size();
+    buffer.resize(offset + length);
+    uint8_t* block = buffer.data() + offset;
+    Put32(block, type);
+    Put32(block + 4, length);
+    Put32(block + length - 4, length);
+    return block;
+}
+
+PcapngFile::PcapngFile()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+PcapngFile::~PcapngFile()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+PcapngFile::Fail() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_file.fail();
+}
+
+void
+PcapngFile::Open(const std::string& filename)
+{
+    NS_LOG_FUNCTION(this << filename);
+    NS_ASSERT(!m_file.is_open());
+    m_filename = filename;
+    m_file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    m_buffer.clear();
+    m_buffer.reserve(2 * BUFFER_SIZE);
+    m_snapLen.clear();
+
+    uint8_t* block = AppendBlock(m_buffer, SECTION_HEADER_BLOCK, 28);
+    Put32(block + 8, BYTE_ORDER_MAGIC);
+    Put16(block + 12, VERSION_MAJOR);
+    Put16(block + 14, VERSION_MINOR);
+    // the section length is not specified
+    std::memset(block + 16, 0xff, 8);
+    EndBlock();
+}
+
+void
+PcapngFile::Close()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_file.is_open())
+    {
+        Flush();
+        m_file.close();
+    }
+}
+
+void
+PcapngFile::Flush()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_buffer.empty())
+    {
+        m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+        m_buffer.clear();
+    }
+    m_file.flush();
+}
+
+uint32_t
+PcapngFile::AddInterface(uint32_t dataLinkType, uint32_t snapLen, const std::string& name)
+{
+    NS_LOG_FUNCTION(this << dataLinkType << snapLen << name);
+    NS_ASSERT(m_file.is_open());
+    NS_ASSERT_MSG(name.size() < 0xffff, "Interface name too long: " << name);
+
+    // if_name (optional), if_tsresol and opt_endofopt options
+    uint32_t optionsLength = 8 + 4;
+    if (!name.empty())
+    {
+        optionsLength += 4 + Pad(name.size());
+    }
+    uint8_t* block = AppendBlock(m_buffer, INTERFACE_DESCRIPTION_BLOCK, 20 + optionsLength);
+    Put16(block + 8, dataLinkType);
+    Put32(block + 12, snapLen);
+    uint8_t* option = block + 16;
+    if (!name.empty())
+    {
+        Put16(option, IF_NAME);
+        Put16(option + 2, name.size());
+        std::memcpy(option + 4, name.data(), name.size());
+        option += 4 + Pad(name.size());
+    }
+    Put16(option, IF_TSRESOL);
+    Put16(option + 2, 1);
+    option[4] = TSRESOL_NANOSECONDS;
+    Put16(option + 8, OPT_ENDOFOPT);
+    EndBlock();
+
+    m_snapLen.push_back(snapLen);
+    return m_snapLen.size() - 1;
+}
+
+uint32_t
+PcapngFile::GetNInterfaces() const
+{
+    return m_snapLen.size();
+}
+
+uint8_t*
+PcapngFile::AppendPacketBlock(uint32_t interface,
+                              uint64_t timestamp,
+                              uint32_t totalLen,
+                              uint32_t& inclLen)
+{
+    NS_ASSERT_MSG(interface < m_snapLen.size(), "Unknown interface " << interface);
+    uint32_t snapLen = m_snapLen[interface];
+    inclLen = (snapLen != 0 && totalLen > snapLen) ? snapLen : totalLen;
+
+    uint8_t* block = AppendBlock(m_buffer, ENHANCED_PACKET_BLOCK, 32 + Pad(inclLen));
+    Put32(block + 8, interface);
+    Put32(block + 12, timestamp >> 32);
+    Put32(block + 16, timestamp & 0xffffffff);
+    Put32(block + 20, inclLen);
+    Put32(block + 24, totalLen);
+    return block + 28;
+}
+
+void
+PcapngFile::EndBlock()
+{
+    if (m_buffer.size() >= BUFFER_SIZE)
+    {
+        Flush();
+    }
+}
+
+void
+PcapngFile::Write(uint32_t interface, uint64_t timestamp, const uint8_t* data, uint32_t totalLen)
+{
+    NS_LOG_FUNCTION(this << interface << timestamp << &data << totalLen);
+    uint32_t inclLen;
+    uint8_t* packetData = AppendPacketBlock(interface, timestamp, totalLen, inclLen);
+    std::memcpy(packetData, data, inclLen);
+    EndBlock();
+}
+
+void
+PcapngFile::Write(uint32_t interface, uint64_t timestamp, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interface << timestamp << p);
+    uint32_t inclLen;
+    uint8_t* packetData = AppendPacketBlock(interface, timestamp, p->GetSize(), inclLen);
+    p->CopyData(packetData, inclLen);
+    EndBlock();
+}
+
+void
+PcapngFile::Write(uint32_t interface, uint64_t timestamp, const Header& header, Ptr<const Packet> p)
+{
+    NS_LOG_FUNCTION(this << interface << timestamp << &header << p);
+    uint32_t headerSize = header.GetSerializedSize();
+    uint32_t inclLen;
+    uint8_t* packetData =
+        AppendPacketBlock(interface, timestamp, headerSize + p->GetSize(), inclLen);
+
+    Buffer headerBuffer;
+    headerBuffer.AddAtStart(headerSize);
+    header.Serialize(headerBuffer.Begin());
+    uint32_t toCopy = std::min(headerSize, inclLen);
+    headerBuffer.CopyData(packetData, toCopy);
+    p->CopyData(packetData + toCopy, inclLen - toCopy);
+    EndBlock();
+}
+
+} // namespace ns3
@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PCAPNG_FILE_H
+#define PCAPNG_FILE_H
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+
+#include <fstream>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class Packet;
+class Header;
+
+/**
+ * @brief A class representing a pcapng file holding the captures of several
+ * interfaces.
+ *
+ * The file is made of a single section.  Each interface added to the file is
+ * described by an Interface Description Block, written when the interface is
+ * added, which holds the data link type, the snapshot length and the name of
+ * the interface, and declares nanosecond timestamps.  The packets are written
+ * as Enhanced Packet Blocks referring to their interface.
+ *
+ * The blocks are accumulated in memory and written to the file by chunks of
+ * BUFFER_SIZE bytes, so that a capture of many devices costs a single file
+ * and a few large writes.  The blocks are written in the host byte order,
+ * which readers detect with the byte-order magic of the section header.
+ *
+ * This class uses a basic ns-3 reference counting base class, so that the
+ * PcapFileWrapper objects of the interfaces can share the file.
+ */
+class PcapngFile : public SimpleRefCount<PcapngFile>
+{
+  public:
+    static const uint32_t BUFFER_SIZE = 64 * 1024; //!< Size of the chunks written to the file
+
+    PcapngFile();
+    ~PcapngFile();
+
+    /**
+     * @return true if the 'fail' bit is set in the underlying iostream, false otherwise.
+     */
+    bool Fail() const;
+
+    /**
+     * Create a new pcapng file, and write its section header.
+     *
+     * @param filename String containing the name of the file.
+     */
+    void Open(const std::string& filename);
+
+    /**
+     * Write the pending blocks and close the underlying file.
+     */
+    void Close();
+
+    /**
+     * Write the pending blocks to the underlying file, and flush it.
+     */
+    void Flush();
+
+    /**
+     * Add an interface to the file, and write its interface description block.
+     *
+     * @param dataLinkType Data link type of the packet data of the interface
+     * @param snapLen Maximum number of octets of the packets saved in records,
+     *        or 0 for no limit
+     * @param name Name of the interface, not written if empty
+     * @return the identifier of the interface
+     */
+    uint32_t AddInterface(uint32_t dataLinkType, uint32_t snapLen, const std::string& name);
+
+    /**
+     * @return the number of interfaces of the file
+     */
+    uint32_t GetNInterfaces() const;
+
+    /**
+     * @brief Write the next packet of an interface to the file
+     *
+     * @param interface the identifier of the interface
+     * @param timestamp Packet timestamp, in nanoseconds
+     * @param data Data buffer
+     * @param totalLen Total packet length
+     */
+    void Write(uint32_t interface, uint64_t timestamp, const uint8_t* data, uint32_t totalLen);
+
+    /**
+     * @brief Write the next packet of an interface to the file
+     *
+     * @param interface the identifier of the interface
+     * @param timestamp Packet timestamp, in nanoseconds
+     * @param p Packet to write
+     */
+    void Write(uint32_t interface, uint64_t timestamp, Ptr<const Packet> p);
+
+    /**
+     * @brief Write the provided header along with the packet to the file
+     *
+     * @param interface the identifier of the interface
+     * @param timestamp Packet timestamp, in nanoseconds
+     * @param header Header to write, in front of the packet
+     * @param p Packet to write
+     */
+    void Write(uint32_t interface, uint64_t timestamp, const Header& header, Ptr<const Packet> p);
+
+  private:
+    /**
+     * @brief Append an enhanced packet block to the pending blocks, without its data
+     *
+     * @param interface the identifier of the interface
+     * @param timestamp Packet timestamp, in nanoseconds
+     * @param totalLen Total packet length
+     * @param inclLen [out] Number of octets of the packet to save
+     * @return a pointer to the packet data of the block, to be filled by the caller
+     */
+    uint8_t* AppendPacketBlock(uint32_t interface,
+                               uint64_t timestamp,
+                               uint32_t totalLen,
+                               uint32_t& inclLen);
+    /**
+     * @brief Flush the pending blocks if they fill a chunk
+     */
+    void EndBlock();
+
+    std::string m_filename;          //!< file name
+    std::ofstream m_file;            //!< file stream
+    std::vector<uint8_t> m_buffer;   //!< blocks not written to the file yet
+    std::vector<uint32_t> m_snapLen; //!< snapshot length of each interface
+};
+
+} // namespace ns3
+
+#endif /* PCAPNG_FILE_H */
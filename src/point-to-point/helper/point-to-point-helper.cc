@@ -227,7 +227,26 @@ NetDeviceContainer
 PointToPointHelper::Install(Ptr<Node> a, Ptr<Node> b)
 {
     NetDeviceContainer container;
+    InstallLink(a, b, container);
+    return container;
+}
+
+NetDeviceContainer
+PointToPointHelper::InstallLinks(const NodeContainer& from, const NodeContainer& to)
+{
+    NS_ASSERT_MSG(from.GetN() == to.GetN(), "The links need as many first and second nodes");
+    NetDeviceContainer container;
+    container.Reserve(2 * from.GetN());
+    for (uint32_t i = 0; i < from.GetN(); i++)
+    {
+        InstallLink(from.Get(i), to.Get(i), container);
+    }
+    return container;
+}
 
+void
+PointToPointHelper::InstallLink(Ptr<Node> a, Ptr<Node> b, NetDeviceContainer& container)
+{
     Ptr<PointToPointNetDevice> devA = m_deviceFactory.Create<PointToPointNetDevice>();
     devA->SetAddress(Mac48Address::Allocate());
     a->AddDevice(devA);
@@ -290,8 +309,6 @@ PointToPointHelper::Install(Ptr<Node> a, Ptr<Node> b)
     devB->Attach(channel);
     container.Add(devA);
     container.Add(devB);
-
-    return container;
 }
 
 NetDeviceContainer
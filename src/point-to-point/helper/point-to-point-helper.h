@@ -142,7 +142,29 @@ class PointToPointHelper : public PcapHelperForDevice, public AsciiTraceHelperFo
      */
     NetDeviceContainer Install(std::string aNode, std::string bNode);
 
+    /**
+     * @param from first nodes of the links
+     * @param to second nodes of the links
+     * @return a NetDeviceContainer with the devices of from.Get(i) and
+     *         to.Get(i) at the indices 2 * i and 2 * i + 1
+     *
+     * Install a link between from.Get(i) and to.Get(i) for each index i,
+     * as Install(from.Get(i), to.Get(i)) does, and return the devices of
+     * all the links in a single container.  This is the way to install the
+     * links of a large topology, e.g. read by a TopologyReader.
+     */
+    NetDeviceContainer InstallLinks(const NodeContainer& from, const NodeContainer& to);
+
   private:
+    /**
+     * @brief Install a link between two nodes.
+     *
+     * @param a first node
+     * @param b second node
+     * @param container the container the devices of a and b are appended to
+     */
+    void InstallLink(Ptr<Node> a, Ptr<Node> b, NetDeviceContainer& container);
+
     /**
      * @brief Enable pcap output the indicated net device.
      *
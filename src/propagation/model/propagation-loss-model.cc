@@ -18,7 +18,9 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace ns3
 {
@@ -71,6 +73,54 @@ PropagationLossModel::CalcRxPower(double txPowerDbm,
     return self;
 }
 
+void
+PropagationLossModel::CalcRxPowerBatch(double txPowerDbm,
+                                       Ptr<MobilityModel> a,
+                                       std::span<const Ptr<MobilityModel>> receivers,
+                                       std::span<double> rxPowersDbm) const
+{
+    NS_LOG_FUNCTION(this << txPowerDbm << a << receivers.size());
+    NS_ASSERT_MSG(receivers.size() == rxPowersDbm.size(),
+                  "One output power is required per receiver");
+    std::fill(rxPowersDbm.begin(), rxPowersDbm.end(), txPowerDbm);
+    for (const PropagationLossModel* model = this; model != nullptr;
+         model = PeekPointer(model->m_next))
+    {
+        model->DoCalcRxPowerBatch(rxPowersDbm, a, receivers);
+    }
+}
+
+void
+PropagationLossModel::DoCalcRxPowerBatch(std::span<double> powersDbm,
+                                         Ptr<MobilityModel> a,
+                                         std::span<const Ptr<MobilityModel>> receivers) const
+{
+    for (std::size_t i = 0; i < receivers.size(); ++i)
+    {
+        powersDbm[i] = DoCalcRxPower(powersDbm[i], a, receivers[i]);
+    }
+}
+
+void
+PropagationLossModel::GetDistancesFrom(Ptr<MobilityModel> a,
+                                       std::span<const Ptr<MobilityModel>> receivers,
+                                       std::span<double> distances)
+{
+    NS_ASSERT(receivers.size() == distances.size());
+    // Fetching the positions requires a virtual call per receiver, so it is kept
+    // apart from the square root loop, which the compiler can then vectorize.
+    const Vector position = a->GetPosition();
+    for (std::size_t i = 0; i < receivers.size(); ++i)
+    {
+        const Vector d = receivers[i]->GetPosition() - position;
+        distances[i] = d.x * d.x + d.y * d.y + d.z * d.z;
+    }
+    for (auto& distance : distances)
+    {
+        distance = std::sqrt(distance);
+    }
+}
+
 int64_t
 PropagationLossModel::AssignStreams(int64_t stream)
 {
@@ -272,6 +322,33 @@ FriisPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm - std::max(lossDb, m_minLoss);
 }
 
+void
+FriisPropagationLossModel::DoCalcRxPowerBatch(std::span<double> powersDbm,
+                                              Ptr<MobilityModel> a,
+                                              std::span<const Ptr<MobilityModel>> receivers) const
+{
+    std::vector<double> distances(receivers.size());
+    GetDistancesFrom(a, receivers, distances);
+    for (const auto distance : distances)
+    {
+        if (distance < 3 * m_lambda)
+        {
+            NS_LOG_WARN(
+                "distance not within the far field region => inaccurate propagation loss value");
+        }
+    }
+    // Same arithmetic as DoCalcRxPower, written without branches
+    const double numerator = m_lambda * m_lambda;
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        const double distance = distances[i];
+        const double denominator = 16 * M_PI * M_PI * distance * distance * m_systemLoss;
+        const double lossDb = -10 * log10(numerator / denominator);
+        powersDbm[i] = (distance <= 0) ? powersDbm[i] - m_minLoss
+                                       : powersDbm[i] - std::max(lossDb, m_minLoss);
+    }
+}
+
 int64_t
 FriisPropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -455,6 +532,46 @@ TwoRayGroundPropagationLossModel::DoCalcRxPower(double txPowerDbm,
     }
 }
 
+void
+TwoRayGroundPropagationLossModel::DoCalcRxPowerBatch(
+    std::span<double> powersDbm,
+    Ptr<MobilityModel> a,
+    std::span<const Ptr<MobilityModel>> receivers) const
+{
+    const std::size_t n = receivers.size();
+    std::vector<double> distances(n);
+    std::vector<double> rxAntHeights(n);
+    const Vector position = a->GetPosition();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const Vector rxPosition = receivers[i]->GetPosition();
+        const Vector d = rxPosition - position;
+        distances[i] = d.x * d.x + d.y * d.y + d.z * d.z;
+        rxAntHeights[i] = rxPosition.z + m_heightAboveZ;
+    }
+    // Same arithmetic as DoCalcRxPower, written without branches
+    const double txAntHeight = position.z + m_heightAboveZ;
+    const double numerator = m_lambda * m_lambda;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double distance = std::sqrt(distances[i]);
+        const double dCross = (4 * M_PI * txAntHeight * rxAntHeights[i]) / m_lambda;
+
+        const double friisTmp = M_PI * distance;
+        const double friisDenominator = 16 * friisTmp * friisTmp * m_systemLoss;
+        const double friisPr = 10 * std::log10(numerator / friisDenominator);
+
+        const double rayTmp = txAntHeight * rxAntHeights[i];
+        const double rayNumerator = rayTmp * rayTmp;
+        const double distanceSquared = distance * distance;
+        const double rayDenominator = distanceSquared * distanceSquared * m_systemLoss;
+        const double rayPr = 10 * std::log10(rayNumerator / rayDenominator);
+
+        const double pr = (distance <= dCross) ? friisPr : rayPr;
+        powersDbm[i] = (distance <= m_minDistance) ? powersDbm[i] : powersDbm[i] + pr;
+    }
+}
+
 int64_t
 TwoRayGroundPropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -549,6 +666,25 @@ LogDistancePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     return txPowerDbm + rxc;
 }
 
+void
+LogDistancePropagationLossModel::DoCalcRxPowerBatch(
+    std::span<double> powersDbm,
+    Ptr<MobilityModel> a,
+    std::span<const Ptr<MobilityModel>> receivers) const
+{
+    std::vector<double> distances(receivers.size());
+    GetDistancesFrom(a, receivers, distances);
+    // Same arithmetic as DoCalcRxPower, written without branches
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        const double distance = distances[i];
+        const double pathLossDb = 10 * m_exponent * std::log10(distance / m_referenceDistance);
+        const double rxc = -m_referenceLoss - pathLossDb;
+        powersDbm[i] = (distance <= m_referenceDistance) ? powersDbm[i] - m_referenceLoss
+                                                         : powersDbm[i] + rxc;
+    }
+}
+
 int64_t
 LogDistancePropagationLossModel::DoAssignStreams(int64_t stream)
 {
@@ -943,6 +1079,19 @@ RangePropagationLossModel::DoCalcRxPower(double txPowerDbm,
     }
 }
 
+void
+RangePropagationLossModel::DoCalcRxPowerBatch(std::span<double> powersDbm,
+                                              Ptr<MobilityModel> a,
+                                              std::span<const Ptr<MobilityModel>> receivers) const
+{
+    std::vector<double> distances(receivers.size());
+    GetDistancesFrom(a, receivers, distances);
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        powersDbm[i] = (distances[i] <= m_range) ? powersDbm[i] : -1000;
+    }
+}
+
 int64_t
 RangePropagationLossModel::DoAssignStreams(int64_t stream)
 {
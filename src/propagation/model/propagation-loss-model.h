@@ -16,6 +16,7 @@
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
 
+#include <span>
 #include <unordered_map>
 
 namespace ns3
@@ -90,6 +91,24 @@ class PropagationLossModel : public Object
      */
     double CalcRxPower(double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
 
+    /**
+     * Returns the Rx Power from a single source to a set of destinations, taking
+     * into account all the PropagationLossModel(s) chained to the current one.
+     *
+     * The result for each destination is identical to what CalcRxPower would
+     * return for the same (a, receivers[i]) pair, but models that support it
+     * evaluate the whole set in a single pass over contiguous buffers.
+     *
+     * @param txPowerDbm current transmission power (in dBm)
+     * @param a the mobility model of the source
+     * @param receivers the mobility models of the destinations
+     * @param rxPowersDbm the reception powers (in dBm), one per destination
+     */
+    void CalcRxPowerBatch(double txPowerDbm,
+                          Ptr<MobilityModel> a,
+                          std::span<const Ptr<MobilityModel>> receivers,
+                          std::span<double> rxPowersDbm) const;
+
     /**
      * If this loss model uses objects of type RandomVariableStream,
      * set the stream numbers to the integers starting with the offset
@@ -115,6 +134,17 @@ class PropagationLossModel : public Object
      */
     virtual int64_t DoAssignStreams(int64_t stream) = 0;
 
+    /**
+     * Compute the distances between a source and a set of destinations.
+     *
+     * @param a the mobility model of the source
+     * @param receivers the mobility models of the destinations
+     * @param distances the distances (m), one per destination
+     */
+    static void GetDistancesFrom(Ptr<MobilityModel> a,
+                                 std::span<const Ptr<MobilityModel>> receivers,
+                                 std::span<double> distances);
+
   private:
     /**
      * PropagationLossModel.
@@ -128,6 +158,21 @@ class PropagationLossModel : public Object
                                  Ptr<MobilityModel> a,
                                  Ptr<MobilityModel> b) const = 0;
 
+    /**
+     * Batch variant of DoCalcRxPower.
+     *
+     * On input, powersDbm holds the transmission power reaching this model for
+     * each destination; on output, it holds the corresponding reception power.
+     * The default implementation calls DoCalcRxPower for each destination.
+     *
+     * @param powersDbm the per-destination powers (in dBm), updated in place
+     * @param a the mobility model of the source
+     * @param receivers the mobility models of the destinations
+     */
+    virtual void DoCalcRxPowerBatch(std::span<double> powersDbm,
+                                    Ptr<MobilityModel> a,
+                                    std::span<const Ptr<MobilityModel>> receivers) const;
+
     Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
 };
 
@@ -294,6 +339,9 @@ class FriisPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(std::span<double> powersDbm,
+                            Ptr<MobilityModel> a,
+                            std::span<const Ptr<MobilityModel>> receivers) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -406,6 +454,9 @@ class TwoRayGroundPropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(std::span<double> powersDbm,
+                            Ptr<MobilityModel> a,
+                            std::span<const Ptr<MobilityModel>> receivers) const override;
     int64_t DoAssignStreams(int64_t stream) override;
 
     /**
@@ -484,6 +535,9 @@ class LogDistancePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(std::span<double> powersDbm,
+                            Ptr<MobilityModel> a,
+                            std::span<const Ptr<MobilityModel>> receivers) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
@@ -789,6 +843,9 @@ class RangePropagationLossModel : public PropagationLossModel
     double DoCalcRxPower(double txPowerDbm,
                          Ptr<MobilityModel> a,
                          Ptr<MobilityModel> b) const override;
+    void DoCalcRxPowerBatch(std::span<double> powersDbm,
+                            Ptr<MobilityModel> a,
+                            std::span<const Ptr<MobilityModel>> receivers) const override;
 
     int64_t DoAssignStreams(int64_t stream) override;
 
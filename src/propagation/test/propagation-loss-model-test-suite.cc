@@ -13,6 +13,8 @@
 #include "ns3/simulator.h"
 #include "ns3/test.h"
 
+#include <vector>
+
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE("PropagationLossModelsTest");
@@ -478,6 +480,112 @@ RangePropagationLossModelTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup propagation-tests
+ *
+ * @brief PropagationLossModel::CalcRxPowerBatch Test
+ *
+ * Checks that the batch API returns exactly the values returned by
+ * CalcRxPower, both for models with a dedicated batch implementation and
+ * for models relying on the scalar fallback, alone or chained.
+ */
+class PropagationLossModelBatchTestCase : public TestCase
+{
+  public:
+    PropagationLossModelBatchTestCase();
+    ~PropagationLossModelBatchTestCase() override;
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the batch results against the scalar ones
+     * @param lossModel the (possibly chained) loss model to check
+     * @param name the name of the model, used in messages
+     */
+    void CheckModel(Ptr<PropagationLossModel> lossModel, const std::string& name);
+
+    Ptr<MobilityModel> m_sender;                 //!< the sender
+    std::vector<Ptr<MobilityModel>> m_receivers; //!< the receivers
+};
+
+PropagationLossModelBatchTestCase::PropagationLossModelBatchTestCase()
+    : TestCase("Check that the batch rx power computation matches the per-receiver one")
+{
+}
+
+PropagationLossModelBatchTestCase::~PropagationLossModelBatchTestCase()
+{
+}
+
+void
+PropagationLossModelBatchTestCase::CheckModel(Ptr<PropagationLossModel> lossModel,
+                                              const std::string& name)
+{
+    const double txPowerDbm = 16.0206;
+    std::vector<double> rxPowersDbm(m_receivers.size());
+    lossModel->CalcRxPowerBatch(txPowerDbm, m_sender, m_receivers, rxPowersDbm);
+    for (std::size_t i = 0; i < m_receivers.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(rxPowersDbm[i],
+                              lossModel->CalcRxPower(txPowerDbm, m_sender, m_receivers[i]),
+                              name << ": unexpected batch rx power for receiver " << i);
+    }
+}
+
+void
+PropagationLossModelBatchTestCase::DoRun()
+{
+    m_sender = CreateObject<ConstantPositionMobilityModel>();
+    m_sender->SetPosition(Vector(10, 20, 1));
+    // co-located, within reference/crossover/range distances, and beyond them
+    for (const auto& position : {Vector(10, 20, 1),
+                                 Vector(10.3, 20, 1),
+                                 Vector(15, 25, 0),
+                                 Vector(110, 20, 1),
+                                 Vector(137.1, 20, 1),
+                                 Vector(-400, 300, 4),
+                                 Vector(2010, 20, 10)})
+    {
+        Ptr<MobilityModel> receiver = CreateObject<ConstantPositionMobilityModel>();
+        receiver->SetPosition(position);
+        m_receivers.push_back(receiver);
+    }
+
+    CheckModel(CreateObject<FriisPropagationLossModel>(), "Friis");
+    Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel>();
+    friis->SetMinLoss(20);
+    CheckModel(friis, "Friis with MinLoss");
+
+    Ptr<TwoRayGroundPropagationLossModel> twoRay =
+        CreateObject<TwoRayGroundPropagationLossModel>();
+    twoRay->SetHeightAboveZ(1.5);
+    CheckModel(twoRay, "TwoRayGround");
+
+    CheckModel(CreateObject<LogDistancePropagationLossModel>(), "LogDistance");
+
+    Ptr<RangePropagationLossModel> range = CreateObject<RangePropagationLossModel>();
+    range->SetAttribute("MaxRange", DoubleValue(127.2));
+    CheckModel(range, "Range");
+
+    // scalar fallback, alone and chained after models with a batch implementation
+    Ptr<MatrixPropagationLossModel> matrix = CreateObject<MatrixPropagationLossModel>();
+    matrix->SetDefaultLoss(3);
+    matrix->SetLoss(m_sender, m_receivers[2], 10);
+    CheckModel(matrix, "Matrix");
+
+    Ptr<LogDistancePropagationLossModel> chain = CreateObject<LogDistancePropagationLossModel>();
+    Ptr<RangePropagationLossModel> chainedRange = CreateObject<RangePropagationLossModel>();
+    chainedRange->SetAttribute("MaxRange", DoubleValue(500));
+    chain->SetNext(chainedRange);
+    chainedRange->SetNext(matrix);
+    CheckModel(chain, "LogDistance+Range+Matrix");
+
+    m_sender = nullptr;
+    m_receivers.clear();
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup propagation-tests
  *
@@ -489,6 +597,7 @@ RangePropagationLossModelTestCase::DoRun()
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - the batch rx power computation
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -504,6 +613,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite()
     AddTestCase(new LogDistancePropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MatrixPropagationLossModelTestCase, TestCase::Duration::QUICK);
     AddTestCase(new RangePropagationLossModelTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new PropagationLossModelBatchTestCase, TestCase::Duration::QUICK);
 }
 
 /// Static variable for test initialization
@@ -9,13 +9,14 @@
 
 #include "inet-topology-reader.h"
 
+#include "topology-file.h"
+
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/node-container.h"
 
-#include <cstdlib>
-#include <fstream>
-#include <sstream>
+#include <string_view>
+#include <unordered_map>
 
 /**
  * @file
@@ -52,20 +53,20 @@ InetTopologyReader::~InetTopologyReader()
 NodeContainer
 InetTopologyReader::Read()
 {
-    std::ifstream topgen;
-    topgen.open(GetFileName());
-    std::map<std::string, Ptr<Node>> nodeMap;
+    TopologyFile topgen;
+    std::unordered_map<std::string_view, Ptr<Node>> nodeMap;
     NodeContainer nodes;
 
-    if (!topgen.is_open())
+    if (!topgen.Open(GetFileName()))
     {
         NS_LOG_WARN("Inet topology file object is not open, check file name and permissions");
         return nodes;
     }
 
-    std::string from;
-    std::string to;
-    std::string linkAttr;
+    std::string_view line;
+    std::string_view from;
+    std::string_view to;
+    std::string_view linkAttr;
 
     int linksNumber = 0;
     int nodesNumber = 0;
@@ -73,72 +74,71 @@ InetTopologyReader::Read()
     int totnode = 0;
     int totlink = 0;
 
-    std::istringstream lineBuffer;
-    std::string line;
-
-    getline(topgen, line);
-    lineBuffer.str(line);
-
-    lineBuffer >> totnode;
-    lineBuffer >> totlink;
+    if (topgen.GetLine(line) && TopologyFile::GetToken(line, from) &&
+        TopologyFile::GetToken(line, to))
+    {
+        TopologyFile::ToInteger(from, totnode);
+        TopologyFile::ToInteger(to, totlink);
+    }
     NS_LOG_INFO("Inet topology should have " << totnode << " nodes and " << totlink << " links");
 
-    for (int i = 0; i < totnode && !topgen.eof(); i++)
+    // the coordinates of the nodes are not used
+    int nodeLines = 0;
+    while (nodeLines < totnode && topgen.GetLine(line))
     {
-        getline(topgen, line);
+        nodeLines++;
     }
+    nodes.Reserve(nodeLines);
+    nodeMap.reserve(nodeLines);
 
-    for (int i = 0; i < totlink && !topgen.eof(); i++)
+    for (int i = 0; i < totlink && topgen.GetLine(line); i++)
     {
-        getline(topgen, line);
-        lineBuffer.clear();
-        lineBuffer.str(line);
+        if (!TopologyFile::GetToken(line, from) || !TopologyFile::GetToken(line, to))
+        {
+            continue;
+        }
+        if (!TopologyFile::GetToken(line, linkAttr))
+        {
+            linkAttr = std::string_view();
+        }
+
+        NS_LOG_INFO("Link " << linksNumber << " from: " << from << " to: " << to);
+
+        Ptr<Node>& fromNode = nodeMap[from];
+        if (!fromNode)
+        {
+            NS_LOG_INFO("Node " << nodesNumber << " name: " << from);
+            fromNode = CreateObject<Node>();
+            Names::Add(std::string(from), fromNode);
+            nodes.Add(fromNode);
+            nodesNumber++;
+        }
 
-        lineBuffer >> from;
-        lineBuffer >> to;
-        lineBuffer >> linkAttr;
+        Ptr<Node>& toNode = nodeMap[to];
+        if (!toNode)
+        {
+            NS_LOG_INFO("Node " << nodesNumber << " name: " << to);
+            toNode = CreateObject<Node>();
+            std::string nodename = "InetTopology/NodeName/";
+            nodename += to;
+            Names::Add(nodename, toNode);
+            nodes.Add(toNode);
+            nodesNumber++;
+        }
 
-        if ((!from.empty()) && (!to.empty()))
+        Link link(fromNode, std::string(from), toNode, std::string(to));
+        if (!linkAttr.empty())
         {
-            NS_LOG_INFO("Link " << linksNumber << " from: " << from << " to: " << to);
-
-            if (!nodeMap[from])
-            {
-                NS_LOG_INFO("Node " << nodesNumber << " name: " << from);
-                Ptr<Node> tmpNode = CreateObject<Node>();
-                std::string nodeName = "InetTopology/NodeName/" + from;
-                Names::Add(from, tmpNode);
-                nodeMap[from] = tmpNode;
-                nodes.Add(tmpNode);
-                nodesNumber++;
-            }
-
-            if (!nodeMap[to])
-            {
-                NS_LOG_INFO("Node " << nodesNumber << " name: " << to);
-                Ptr<Node> tmpNode = CreateObject<Node>();
-                std::string nodename = "InetTopology/NodeName/" + to;
-                Names::Add(nodename, tmpNode);
-                nodeMap[to] = tmpNode;
-                nodes.Add(tmpNode);
-                nodesNumber++;
-            }
-
-            Link link(nodeMap[from], from, nodeMap[to], to);
-            if (!linkAttr.empty())
-            {
-                NS_LOG_INFO("Link " << linksNumber << " weight: " << linkAttr);
-                link.SetAttribute("Weight", linkAttr);
-            }
-            AddLink(link);
-
-            linksNumber++;
+            NS_LOG_INFO("Link " << linksNumber << " weight: " << linkAttr);
+            link.SetAttribute("Weight", std::string(linkAttr));
         }
+        AddLink(std::move(link));
+
+        linksNumber++;
     }
 
     NS_LOG_INFO("Inet topology created with " << nodesNumber << " nodes and " << linksNumber
                                               << " links");
-    topgen.close();
 
     return nodes;
 }
@@ -9,13 +9,14 @@
 
 #include "orbis-topology-reader.h"
 
+#include "topology-file.h"
+
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/node-container.h"
 
-#include <cstdlib>
-#include <fstream>
-#include <sstream>
+#include <string_view>
+#include <unordered_map>
 
 /**
  * @file
@@ -53,68 +54,51 @@ OrbisTopologyReader::~OrbisTopologyReader()
 NodeContainer
 OrbisTopologyReader::Read()
 {
-    std::ifstream topgen;
-    topgen.open(GetFileName());
-    std::map<std::string, Ptr<Node>> nodeMap;
+    TopologyFile topgen;
+    std::unordered_map<std::string_view, Ptr<Node>> nodeMap;
     NodeContainer nodes;
 
-    if (!topgen.is_open())
+    if (!topgen.Open(GetFileName()))
     {
         return nodes;
     }
 
-    std::string from;
-    std::string to;
-    std::istringstream lineBuffer;
-    std::string line;
+    std::string_view line;
+    std::string_view from;
+    std::string_view to;
 
     int linksNumber = 0;
     int nodesNumber = 0;
 
-    while (!topgen.eof())
+    while (topgen.GetLine(line))
     {
-        line.clear();
-        lineBuffer.clear();
-        from.clear();
-        to.clear();
-
-        getline(topgen, line);
-        lineBuffer.str(line);
-        lineBuffer >> from;
-        lineBuffer >> to;
-
-        if ((!from.empty()) && (!to.empty()))
+        if (!TopologyFile::GetToken(line, from) || !TopologyFile::GetToken(line, to))
         {
-            NS_LOG_INFO(linksNumber << " From: " << from << " to: " << to);
-            if (!nodeMap[from])
-            {
-                Ptr<Node> tmpNode = CreateObject<Node>();
-                std::string nodename = "OrbisTopology/NodeName/" + from;
-                Names::Add(nodename, tmpNode);
-                nodeMap[from] = tmpNode;
-                nodes.Add(tmpNode);
-                nodesNumber++;
-            }
+            continue;
+        }
 
-            if (!nodeMap[to])
+        NS_LOG_INFO(linksNumber << " From: " << from << " to: " << to);
+        for (auto name : {from, to})
+        {
+            Ptr<Node>& node = nodeMap[name];
+            if (!node)
             {
-                Ptr<Node> tmpNode = CreateObject<Node>();
-                std::string nodename = "OrbisTopology/NodeName/" + to;
-                Names::Add(nodename, tmpNode);
-                nodeMap[to] = tmpNode;
-                nodes.Add(tmpNode);
+                node = CreateObject<Node>();
+                std::string nodename = "OrbisTopology/NodeName/";
+                nodename += name;
+                Names::Add(nodename, node);
+                nodes.Add(node);
                 nodesNumber++;
             }
+        }
 
-            Link link(nodeMap[from], from, nodeMap[to], to);
-            AddLink(link);
+        Link link(nodeMap[from], std::string(from), nodeMap[to], std::string(to));
+        AddLink(std::move(link));
 
-            linksNumber++;
-        }
+        linksNumber++;
     }
     NS_LOG_INFO("Orbis topology created with " << nodesNumber << " nodes and " << linksNumber
                                                << " links");
-    topgen.close();
 
     return nodes;
 }
@@ -8,15 +8,16 @@
 
 #include "rocketfuel-topology-reader.h"
 
+#include "topology-file.h"
+
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/node-container.h"
 
 #include <cstdlib>
-#include <fstream>
-#include <iostream>
 #include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @file
@@ -157,18 +158,26 @@ RocketfuelTopologyReader::GenerateFromMapsFile(const std::vector<std::string>& a
         // Each line contains a list <.*>[ |\t]<.*>[ |\t]<.*>[ |\t]
         // First remove < and >
         std::string temp;
-        std::regex replace_regex("[<|>]");
-        std::regex_replace(std::back_inserter(temp),
-                           argv[6].begin(),
-                           argv[6].end(),
-                           replace_regex,
-                           "");
-
-        // Then split list
-        std::regex split_regex("[ |\t]");
-        std::sregex_token_iterator first{temp.begin(), temp.end(), split_regex, -1};
-        std::sregex_token_iterator last;
-        neigh_list = std::vector<std::string>{first, last};
+        for (char c : argv[6])
+        {
+            if (c != '<' && c != '|' && c != '>')
+            {
+                temp += c;
+            }
+        }
+
+        // Then split list, keeping the empty neighbors between consecutive separators
+        std::string::size_type start = 0;
+        while (start < temp.size())
+        {
+            std::string::size_type end = temp.find_first_of(" |\t", start);
+            if (end == std::string::npos)
+            {
+                end = temp.size();
+            }
+            neigh_list.emplace_back(temp, start, end - start);
+            start = end + 1;
+        }
     }
     if (num_neigh != neigh_list.size())
     {
@@ -227,8 +236,9 @@ RocketfuelTopologyReader::GenerateFromMapsFile(const std::vector<std::string>& a
             }
             NS_LOG_INFO(m_linksNumber << ":" << m_nodesNumber << " From: " << uid
                                       << " to: " << nuid);
+            m_linkEnds.emplace(m_nodeMap[uid], m_nodeMap[nuid]);
             Link link(m_nodeMap[uid], uid, m_nodeMap[nuid], nuid);
-            AddLink(link);
+            AddLink(std::move(link));
             m_linksNumber++;
         }
     }
@@ -282,22 +292,12 @@ RocketfuelTopologyReader::GenerateFromWeightsFile(const std::vector<std::string>
         }
         NS_LOG_INFO(m_linksNumber << ":" << m_nodesNumber << " From: " << sname
                                   << " to: " << tname);
-        TopologyReader::ConstLinksIterator iter;
-        bool found = false;
-        for (iter = LinksBegin(); iter != LinksEnd(); iter++)
-        {
-            if ((iter->GetFromNode() == m_nodeMap[tname]) &&
-                (iter->GetToNode() == m_nodeMap[sname]))
-            {
-                found = true;
-                break;
-            }
-        }
-
-        if (!found)
+        // the weights files list the links in both directions
+        if (m_linkEnds.find({m_nodeMap[tname], m_nodeMap[sname]}) == m_linkEnds.end())
         {
+            m_linkEnds.emplace(m_nodeMap[sname], m_nodeMap[tname]);
             Link link(m_nodeMap[sname], sname, m_nodeMap[tname], tname);
-            AddLink(link);
+            AddLink(std::move(link));
             m_linksNumber++;
         }
     }
@@ -309,17 +309,16 @@ RocketfuelTopologyReader::GenerateFromWeightsFile(const std::vector<std::string>
 }
 
 RocketfuelTopologyReader::RF_FileType
-RocketfuelTopologyReader::GetFileType(const std::string& line)
+RocketfuelTopologyReader::GetFileType(std::string_view line)
 {
     // Check whether Maps file or not
-    std::smatch matches;
-    if (std::regex_match(line, matches, rocketfuel_maps_regex))
+    if (std::regex_match(line.data(), line.data() + line.size(), rocketfuel_maps_regex))
     {
         return RF_MAPS;
     }
 
     // Check whether Weights file or not
-    if (std::regex_match(line, matches, rocketfuel_weights_regex))
+    if (std::regex_match(line.data(), line.data() + line.size(), rocketfuel_weights_regex))
     {
         return RF_WEIGHTS;
     }
@@ -330,30 +329,24 @@ RocketfuelTopologyReader::GetFileType(const std::string& line)
 NodeContainer
 RocketfuelTopologyReader::Read()
 {
-    std::ifstream topgen;
-    topgen.open(GetFileName());
+    TopologyFile topgen;
     NodeContainer nodes;
 
-    std::istringstream lineBuffer;
-    std::string line;
+    std::string_view line;
     int lineNumber = 0;
     RF_FileType ftype = RF_UNKNOWN;
 
-    if (!topgen.is_open())
+    if (!topgen.Open(GetFileName()))
     {
         NS_LOG_WARN("Couldn't open the file " << GetFileName());
         return nodes;
     }
 
-    while (!topgen.eof())
+    std::vector<std::string> argv;
+    while (topgen.GetLine(line))
     {
-        std::vector<std::string> argv;
-
+        argv.clear();
         lineNumber++;
-        line.clear();
-        lineBuffer.clear();
-
-        getline(topgen, line);
 
         if (lineNumber == 1)
         {
@@ -365,11 +358,12 @@ RocketfuelTopologyReader::Read()
             }
         }
 
-        std::smatch matches;
+        std::cmatch matches;
+        const char* lineEnd = line.data() + line.size();
 
         if (ftype == RF_MAPS)
         {
-            bool ret = std::regex_match(line, matches, rocketfuel_maps_regex);
+            bool ret = std::regex_match(line.data(), lineEnd, matches, rocketfuel_maps_regex);
             if (!ret || matches.empty())
             {
                 NS_LOG_WARN("match failed (maps file): %s" << line);
@@ -378,7 +372,7 @@ RocketfuelTopologyReader::Read()
         }
         else if (ftype == RF_WEIGHTS)
         {
-            bool ret = std::regex_match(line, matches, rocketfuel_weights_regex);
+            bool ret = std::regex_match(line.data(), lineEnd, matches, rocketfuel_weights_regex);
             if (!ret || matches.empty())
             {
                 NS_LOG_WARN("match failed (weights file): %s" << line);
@@ -386,19 +380,9 @@ RocketfuelTopologyReader::Read()
             }
         }
 
-        std::string matched_string;
-
         for (auto it = matches.begin() + 1; it != matches.end(); it++)
         {
-            if (it->matched)
-            {
-                matched_string = it->str();
-            }
-            else
-            {
-                matched_string = "";
-            }
-            argv.push_back(matched_string);
+            argv.emplace_back(it->matched ? it->str() : "");
         }
 
         if (ftype == RF_MAPS)
@@ -415,8 +399,6 @@ RocketfuelTopologyReader::Read()
         }
     }
 
-    topgen.close();
-
     return nodes;
 }
 
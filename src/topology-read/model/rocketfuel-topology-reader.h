@@ -11,6 +11,9 @@
 
 #include "topology-reader.h"
 
+#include <set>
+#include <string_view>
+
 /**
  * @file
  * @ingroup topology
@@ -100,11 +103,12 @@ class RocketfuelTopologyReader : public TopologyReader
      * @param buf the first line of the file being read
      * @return The file type (RF_MAPS, RF_WEIGHTS, or RF_UNKNOWN)
      */
-    RF_FileType GetFileType(const std::string& buf);
+    RF_FileType GetFileType(std::string_view buf);
 
-    int m_linksNumber;                          //!< Number of links.
-    int m_nodesNumber;                          //!< Number of nodes.
-    std::map<std::string, Ptr<Node>> m_nodeMap; //!< Map of the nodes (name, node).
+    int m_linksNumber;                                    //!< Number of links.
+    int m_nodesNumber;                                    //!< Number of nodes.
+    std::map<std::string, Ptr<Node>> m_nodeMap;           //!< Map of the nodes (name, node).
+    std::set<std::pair<Ptr<Node>, Ptr<Node>>> m_linkEnds; //!< Nodes of the links (from, to).
 
     // end class RocketfuelTopologyReader
 };
@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "topology-file.h"
+
+#include "ns3/log.h"
+
+#include <fstream>
+#include <sstream>
+
+#ifndef __WIN32__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @ingroup topology
+ * ns3::TopologyFile implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TopologyFile");
+
+/// The characters separating the tokens of a line
+static constexpr std::string_view SPACES = " \t\r\f\v";
+
+TopologyFile::TopologyFile()
+    : m_data(nullptr),
+      m_size(0),
+      m_position(0),
+      m_mapped(false)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TopologyFile::~TopologyFile()
+{
+    NS_LOG_FUNCTION(this);
+    Close();
+}
+
+bool
+TopologyFile::Open(const std::string& fileName)
+{
+    NS_LOG_FUNCTION(this << fileName);
+    Close();
+
+#ifndef __WIN32__
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        NS_LOG_WARN("Cannot open " << fileName);
+        return false;
+    }
+    struct stat st;
+    const bool hasSize = fstat(fd, &st) == 0;
+    if (hasSize && st.st_size > 0)
+    {
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED)
+        {
+            madvise(addr, st.st_size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(addr);
+            m_size = st.st_size;
+            m_mapped = true;
+        }
+    }
+    close(fd);
+    if (m_mapped || (hasSize && st.st_size == 0))
+    {
+        return true;
+    }
+    NS_LOG_LOGIC("Cannot map " << fileName << ", reading it");
+#endif
+
+    // read the whole file where it cannot be mapped
+    std::ifstream is(fileName, std::ios::binary);
+    if (!is.is_open())
+    {
+        NS_LOG_WARN("Cannot open " << fileName);
+        return false;
+    }
+    std::ostringstream contents;
+    contents << is.rdbuf();
+    m_buffer = contents.str();
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+    return true;
+}
+
+void
+TopologyFile::Close()
+{
+    NS_LOG_FUNCTION(this);
+#ifndef __WIN32__
+    if (m_mapped)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_position = 0;
+    m_mapped = false;
+    m_buffer.clear();
+}
+
+bool
+TopologyFile::GetLine(std::string_view& line)
+{
+    if (m_position >= m_size)
+    {
+        return false;
+    }
+    const std::string_view rest(m_data + m_position, m_size - m_position);
+    std::size_t end = rest.find('\n');
+    if (end == std::string_view::npos)
+    {
+        end = rest.size();
+        m_position = m_size;
+    }
+    else
+    {
+        m_position += end + 1;
+    }
+    line = rest.substr(0, end);
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.remove_suffix(1);
+    }
+    return true;
+}
+
+bool
+TopologyFile::GetToken(std::string_view& line, std::string_view& token)
+{
+    const std::size_t start = line.find_first_not_of(SPACES);
+    if (start == std::string_view::npos)
+    {
+        line = std::string_view();
+        return false;
+    }
+    const std::size_t end = line.find_first_of(SPACES, start);
+    token = line.substr(start, end - start);
+    line = end == std::string_view::npos ? std::string_view() : line.substr(end);
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef TOPOLOGY_FILE_H
+#define TOPOLOGY_FILE_H
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @file
+ * @ingroup topology
+ * ns3::TopologyFile declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup topology
+ *
+ * @brief Read-only view of a topology file, with a tokenizer for its lines.
+ *
+ * The file is mapped in memory where the platform supports it, and read
+ * in one block otherwise.  The lines and tokens are views into the
+ * contents of the file, so that the topology readers can parse large
+ * files without copying each line and field into a string.  The views
+ * are valid until the file is closed.
+ */
+class TopologyFile
+{
+  public:
+    TopologyFile();
+    ~TopologyFile();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    TopologyFile(const TopologyFile&) = delete;
+    TopologyFile& operator=(const TopologyFile&) = delete;
+
+    /**
+     * @brief Open a file, closing the file previously opened.
+     * @param fileName The name of the file.
+     * @return True if the file could be opened.
+     */
+    bool Open(const std::string& fileName);
+
+    /**
+     * @brief Close the file, invalidating the views into its contents.
+     */
+    void Close();
+
+    /**
+     * @brief Get the next line of the file.
+     *
+     * The line is returned without its terminator ("\n" or "\r\n").
+     *
+     * @param [out] line The line.
+     * @return False if the end of the file was reached.
+     */
+    bool GetLine(std::string_view& line);
+
+    /**
+     * @brief Remove the first token separated by whitespace from a line.
+     * @param [in,out] line The line, which is left after the token.
+     * @param [out] token The token.
+     * @return False if the line had no more tokens.
+     */
+    static bool GetToken(std::string_view& line, std::string_view& token);
+
+    /**
+     * @brief Convert a token to an integer.
+     * @tparam T \deduced The integer type.
+     * @param [in] token The token.
+     * @param [out] value The integer, unchanged if the conversion failed.
+     * @return True if the whole token is a valid integer of the type.
+     */
+    template <typename T>
+    static bool ToInteger(std::string_view token, T& value);
+
+  private:
+    const char* m_data;     //!< The contents of the file.
+    std::size_t m_size;     //!< The size of the contents.
+    std::size_t m_position; //!< The position of the next line.
+    bool m_mapped;          //!< Whether the contents are mapped in memory.
+    std::string m_buffer;   //!< The contents, when they are not mapped.
+};
+
+template <typename T>
+bool
+TopologyFile::ToInteger(std::string_view token, T& value)
+{
+    T result;
+    auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), result);
+    if (error != std::errc() || end != token.data() + token.size())
+    {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+} // namespace ns3
+
+#endif /* TOPOLOGY_FILE_H */
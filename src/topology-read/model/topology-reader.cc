@@ -83,7 +83,7 @@ TopologyReader::LinksEmpty() const
 void
 TopologyReader::AddLink(Link link)
 {
-    m_linksList.push_back(link);
+    m_linksList.push_back(std::move(link));
 }
 
 TopologyReader::Link::Link(Ptr<Node> fromPtr,
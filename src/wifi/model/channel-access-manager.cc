@@ -735,13 +735,26 @@ ChannelAccessManager::UpdateBackoff()
 {
     NS_LOG_FUNCTION(this);
     uint32_t k = 0;
+    const auto now = Simulator::Now();
     const auto accessGrantStart = GetAccessGrantStart();
-    for (auto txop : m_txops)
+    for (const auto& txop : m_txops)
     {
         Time backoffStart = GetBackoffStartFor(txop, accessGrantStart);
-        if (backoffStart <= Simulator::Now())
+        if (backoffStart <= now && txop->GetBackoffSlots(m_linkId) == 0)
+        {
+            /*
+             * Fast-forward the Txops that have no backoff slots left, which is the
+             * case of all the Txops of a node with nothing to transmit: there are
+             * no slots to count down, only the backoff start time is moved forward.
+             */
+            if (backoffStart != txop->GetBackoffStart(m_linkId))
+            {
+                txop->UpdateBackoffSlotsNow(0, backoffStart, m_linkId);
+            }
+        }
+        else if (backoffStart <= now)
         {
-            uint32_t nIntSlots = ((Simulator::Now() - backoffStart) / GetSlot()).GetHigh();
+            uint32_t nIntSlots = ((now - backoffStart) / GetSlot()).GetHigh();
             /*
              * EDCA behaves slightly different to DCA. For EDCA we
              * decrement once at the slot boundary at the end of AIFS as
@@ -381,7 +381,9 @@ class ChannelAccessManager : public Object
      */
     void ResizeLastBusyStructs();
     /**
-     * Update backoff slots for all Txops.
+     * Update backoff slots for all Txops. The Txops with no backoff slots left, such
+     * as those of a node with nothing to transmit, only have their backoff start time
+     * moved forward.
      */
     void UpdateBackoff();
 
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "error-rate-lookup-table.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ErrorRateLookupTable");
+
+/// Error rate stored for the SNRs where it is zero, so that its logarithm is finite
+static constexpr double MIN_BER = 1e-300;
+
+ErrorRateLookupTable::ErrorRateLookupTable(const BitErrorRate& ber)
+{
+    NS_LOG_FUNCTION(this);
+    const std::size_t size = std::lround((MAX_SNR_DB - MIN_SNR_DB) / STEP_DB) + 1;
+    m_logBer.reserve(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const double snr = std::pow(10.0, (MIN_SNR_DB + i * STEP_DB) / 10.0);
+        m_logBer.push_back(std::log(std::max(ber(snr), MIN_BER)));
+    }
+}
+
+Ptr<const ErrorRateLookupTable>
+ErrorRateLookupTable::Get(TypeId tid, uint64_t key, const BitErrorRate& ber)
+{
+    static std::map<std::pair<uint16_t, uint64_t>, Ptr<const ErrorRateLookupTable>> tables;
+    auto& table = tables[{tid.GetUid(), key}];
+    if (!table)
+    {
+        NS_LOG_DEBUG("Build the table " << key << " of " << tid.GetName());
+        table = Create<ErrorRateLookupTable>(ber);
+    }
+    return table;
+}
+
+double
+ErrorRateLookupTable::GetChunkSuccessRate(double snr, uint64_t nbits) const
+{
+    if (nbits == 0)
+    {
+        return 1.0;
+    }
+    // the SNRs out of the table have the error rate of the closest SNR of the table,
+    // which is capped to 1 below the table, and smaller than MIN_BER above it
+    double x = (10.0 * std::log10(snr) - MIN_SNR_DB) / STEP_DB;
+    x = std::clamp(x, 0.0, static_cast<double>(m_logBer.size() - 1));
+    auto i = std::min(static_cast<std::size_t>(x), m_logBer.size() - 2);
+    const double logBer = m_logBer[i] + (x - i) * (m_logBer[i + 1] - m_logBer[i]);
+    const double ber = std::min(std::exp(logBer), 1.0);
+    return std::exp(nbits * std::log1p(-ber));
+}
+
+} // namespace ns3
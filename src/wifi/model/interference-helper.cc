@@ -38,10 +38,23 @@ Event::Event(Ptr<const WifiPpdu> ppdu, Time duration, RxPowerWattPerChannelBand&
     : m_ppdu(ppdu),
       m_startTime(Simulator::Now()),
       m_endTime(m_startTime + duration),
+      m_rxPower(0),
       m_rxPowerW(std::move(rxPower))
 {
 }
 
+Event::Event(Ptr<const WifiPpdu> ppdu,
+             Time duration,
+             std::shared_ptr<const WifiSpectrumBandInfo> band,
+             Watt_u rxPower)
+    : m_ppdu(ppdu),
+      m_startTime(Simulator::Now()),
+      m_endTime(m_startTime + duration),
+      m_band(std::move(band)),
+      m_rxPower(rxPower)
+{
+}
+
 Ptr<const WifiPpdu>
 Event::GetPpdu() const
 {
@@ -69,6 +82,10 @@ Event::GetDuration() const
 Watt_u
 Event::GetRxPower() const
 {
+    if (m_band)
+    {
+        return m_rxPower;
+    }
     NS_ASSERT(!m_rxPowerW.empty());
     // The total RX power corresponds to the maximum over all the bands
     auto it =
@@ -81,6 +98,11 @@ Event::GetRxPower() const
 Watt_u
 Event::GetRxPower(const WifiSpectrumBandInfo& band) const
 {
+    if (m_band)
+    {
+        NS_ASSERT(!(band < *m_band) && !(*m_band < band));
+        return m_rxPower;
+    }
     const auto it = m_rxPowerW.find(band);
     NS_ASSERT(it != m_rxPowerW.cend());
     return it->second;
@@ -89,12 +111,32 @@ Event::GetRxPower(const WifiSpectrumBandInfo& band) const
 const RxPowerWattPerChannelBand&
 Event::GetRxPowerPerBand() const
 {
+    if (m_band && m_rxPowerW.empty())
+    {
+        m_rxPowerW.insert({*m_band, m_rxPower});
+    }
     return m_rxPowerW;
 }
 
+const WifiSpectrumBandInfo*
+Event::GetSingleBand() const
+{
+    return m_band.get();
+}
+
 void
 Event::UpdateRxPowerW(const RxPowerWattPerChannelBand& rxPower)
 {
+    if (m_band)
+    {
+        NS_ASSERT(rxPower.size() == 1);
+        if (auto it = rxPower.find(*m_band); it != rxPower.end())
+        {
+            m_rxPower += it->second;
+            m_rxPowerW.clear();
+        }
+        return;
+    }
     NS_ASSERT(rxPower.size() == m_rxPowerW.size());
     // Update power band per band
     for (auto& currentRxPowerW : m_rxPowerW)
@@ -114,6 +156,43 @@ Event::UpdatePpdu(Ptr<const WifiPpdu> ppdu)
     m_ppdu = ppdu;
 }
 
+Event::FreeList Event::g_freeList;
+bool Event::g_freeListDestroyed = false;
+
+Event::FreeList::~FreeList()
+{
+    for (auto ptr : blocks)
+    {
+        ::operator delete(ptr);
+    }
+    blocks.clear();
+    g_freeListDestroyed = true;
+}
+
+void*
+Event::operator new(std::size_t size)
+{
+    NS_ASSERT(size == sizeof(Event));
+    if (!g_freeListDestroyed && !g_freeList.blocks.empty())
+    {
+        auto ptr = g_freeList.blocks.back();
+        g_freeList.blocks.pop_back();
+        return ptr;
+    }
+    return ::operator new(size);
+}
+
+void
+Event::operator delete(void* ptr)
+{
+    if (g_freeListDestroyed)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    g_freeList.blocks.push_back(ptr);
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Event& event)
 {
@@ -193,6 +272,8 @@ InterferenceHelper::DoDispose()
     }
     m_niChanges.clear();
     m_firstPowers.clear();
+    m_sharedBands.clear();
+    m_unusedNiChanges.clear();
     m_errorRateModel = nullptr;
 }
 
@@ -203,7 +284,18 @@ InterferenceHelper::Add(Ptr<const WifiPpdu> ppdu,
                         const FrequencyRange& freqRange,
                         bool isStartHePortionRxing)
 {
-    Ptr<Event> event = Create<Event>(ppdu, duration, std::move(rxPowerW));
+    Ptr<Event> event;
+    if (rxPowerW.size() == 1)
+    {
+        const auto& [band, power] = *rxPowerW.cbegin();
+        const auto it = m_sharedBands.find(band);
+        NS_ABORT_IF(it == m_sharedBands.end());
+        event = Create<Event>(ppdu, duration, it->second, power);
+    }
+    else
+    {
+        event = Create<Event>(ppdu, duration, std::move(rxPowerW));
+    }
     AppendEvent(event, freqRange, isStartHePortionRxing);
     return event;
 }
@@ -248,6 +340,7 @@ InterferenceHelper::AddBand(const WifiSpectrumBandInfo& band)
     // Always have a zero power noise event in the list
     AddNiChangeEvent(Time(0), NiChange(Watt_u{0}, nullptr), result.first);
     m_firstPowers.insert({band, Watt_u{0}});
+    m_sharedBands.insert({band, std::make_shared<const WifiSpectrumBandInfo>(band)});
 }
 
 void
@@ -256,6 +349,7 @@ InterferenceHelper::RemoveBand(const WifiSpectrumBandInfo& band)
     NS_LOG_FUNCTION(this << band);
     NS_ASSERT(m_firstPowers.count(band) != 0);
     m_firstPowers.erase(band);
+    m_sharedBands.erase(band);
     auto it = m_niChanges.find(band);
     NS_ASSERT(it != std::end(m_niChanges));
     it->second.clear();
@@ -350,36 +444,58 @@ InterferenceHelper::AppendEvent(Ptr<Event> event,
                                 bool isStartHePortionRxing)
 {
     NS_LOG_FUNCTION(this << event << freqRange << isStartHePortionRxing);
+    if (const auto band = event->GetSingleBand())
+    {
+        AppendEvent(event, *band, event->GetRxPower(), freqRange, isStartHePortionRxing);
+        return;
+    }
     for (const auto& [band, power] : event->GetRxPowerPerBand())
     {
-        auto niIt = m_niChanges.find(band);
-        NS_ABORT_IF(niIt == m_niChanges.end());
-        Watt_u previousPowerStart{0.0};
-        Watt_u previousPowerEnd{0.0};
-        auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
-        previousPowerStart = previousPowerPosition->second.GetPower();
-        previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
-        if (const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange)); !rxing)
-        {
-            m_firstPowers.find(band)->second = previousPowerStart;
-            // Always leave the first zero power noise event in the list
-            niIt->second.erase(++(niIt->second.begin()), ++previousPowerPosition);
-        }
-        else if (isStartHePortionRxing)
-        {
-            // When the first HE portion is received, we need to set m_firstPowerPerBand
-            // so that it takes into account interferences that arrived between the start of the
-            // HE TB PPDU transmission and the start of HE TB payload.
-            m_firstPowers.find(band)->second = previousPowerStart;
-        }
-        auto first =
-            AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
-        auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
-        for (auto i = first; i != last; ++i)
+        AppendEvent(event, band, power, freqRange, isStartHePortionRxing);
+    }
+}
+
+void
+InterferenceHelper::AppendEvent(Ptr<Event> event,
+                                const WifiSpectrumBandInfo& band,
+                                Watt_u power,
+                                const FrequencyRange& freqRange,
+                                bool isStartHePortionRxing)
+{
+    NS_LOG_FUNCTION(this << event << band << power << freqRange << isStartHePortionRxing);
+    auto niIt = m_niChanges.find(band);
+    NS_ABORT_IF(niIt == m_niChanges.end());
+    Watt_u previousPowerStart{0.0};
+    Watt_u previousPowerEnd{0.0};
+    auto previousPowerPosition = GetPreviousPosition(event->GetStartTime(), niIt);
+    previousPowerStart = previousPowerPosition->second.GetPower();
+    previousPowerEnd = GetPreviousPosition(event->GetEndTime(), niIt)->second.GetPower();
+    if (const auto rxing = (m_rxing.contains(freqRange) && m_rxing.at(freqRange)); !rxing)
+    {
+        m_firstPowers.find(band)->second = previousPowerStart;
+        // Always leave the first zero power noise event in the list, and keep the
+        // nodes of the others for the next NiChanges
+        const auto end = std::next(previousPowerPosition);
+        for (auto it = std::next(niIt->second.begin()); it != end;)
         {
-            i->second.AddPower(power);
+            auto node = niIt->second.extract(it++);
+            node.mapped() = NiChange(Watt_u{0}, nullptr);
+            m_unusedNiChanges.push_back(std::move(node));
         }
     }
+    else if (isStartHePortionRxing)
+    {
+        // When the first HE portion is received, we need to set m_firstPowerPerBand
+        // so that it takes into account interferences that arrived between the start of the
+        // HE TB PPDU transmission and the start of HE TB payload.
+        m_firstPowers.find(band)->second = previousPowerStart;
+    }
+    auto first = AddNiChangeEvent(event->GetStartTime(), NiChange(previousPowerStart, event), niIt);
+    auto last = AddNiChangeEvent(event->GetEndTime(), NiChange(previousPowerEnd, event), niIt);
+    for (auto i = first; i != last; ++i)
+    {
+        i->second.AddPower(power);
+    }
 }
 
 void
@@ -813,7 +929,16 @@ InterferenceHelper::GetPreviousPosition(Time moment, NiChangesPerBand::iterator
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::AddNiChangeEvent(Time moment, NiChange change, NiChangesPerBand::iterator niIt)
 {
-    return niIt->second.insert(GetNextPosition(moment, niIt), {moment, change});
+    const auto position = GetNextPosition(moment, niIt);
+    if (m_unusedNiChanges.empty())
+    {
+        return niIt->second.insert(position, {moment, change});
+    }
+    auto node = std::move(m_unusedNiChanges.back());
+    m_unusedNiChanges.pop_back();
+    node.key() = moment;
+    node.mapped() = change;
+    return niIt->second.insert(position, std::move(node));
 }
 
 void
@@ -13,6 +13,9 @@
 
 #include "ns3/object.h"
 
+#include <memory>
+#include <vector>
+
 namespace ns3
 {
 
@@ -37,6 +40,20 @@ class Event : public SimpleRefCount<Event>
      * @param rxPower the received power per band (W)
      */
     Event(Ptr<const WifiPpdu> ppdu, Time duration, RxPowerWattPerChannelBand&& rxPower);
+    /**
+     * Create an Event received over a single band, which only carries the received
+     * power and the timing of the signal. The band is shared with the other events
+     * received over it, hence creating such an event does not copy it.
+     *
+     * @param ppdu the PPDU
+     * @param duration duration of the PPDU
+     * @param band the band the signal is received over
+     * @param rxPower the received power (W)
+     */
+    Event(Ptr<const WifiPpdu> ppdu,
+          Time duration,
+          std::shared_ptr<const WifiSpectrumBandInfo> band,
+          Watt_u rxPower);
 
     /**
      * Return the PPDU.
@@ -81,6 +98,12 @@ class Event : public SimpleRefCount<Event>
      * @return the received power (W) for all bands.
      */
     const RxPowerWattPerChannelBand& GetRxPowerPerBand() const;
+    /**
+     * Return the band of an event received over a single band.
+     *
+     * @return the band of an event received over a single band, null otherwise
+     */
+    const WifiSpectrumBandInfo* GetSingleBand() const;
     /**
      * Update the received power (W) for all bands, i.e. add up the received power
      * to the current received power, for each band.
@@ -98,11 +121,39 @@ class Event : public SimpleRefCount<Event>
      */
     void UpdatePpdu(Ptr<const WifiPpdu> ppdu);
 
+    /**
+     * Take the memory of an event from the events no longer in use, if any, so that
+     * adding a signal to the interference helper does not allocate memory.
+     *
+     * @param size the size of the event
+     * @return the memory of the event
+     */
+    static void* operator new(std::size_t size);
+    /**
+     * Keep the memory of an event no longer in use for the next events.
+     *
+     * @param ptr the memory of the event
+     */
+    static void operator delete(void* ptr);
+
   private:
-    Ptr<const WifiPpdu> m_ppdu;           //!< PPDU
-    Time m_startTime;                     //!< start time
-    Time m_endTime;                       //!< end time
-    RxPowerWattPerChannelBand m_rxPowerW; //!< received power in watts per band
+    /// Memory of the events no longer in use, released at the end of the program
+    struct FreeList
+    {
+        ~FreeList();
+        std::vector<void*> blocks; //!< memory of the events no longer in use
+    };
+
+    static FreeList g_freeList;      //!< the free list
+    static bool g_freeListDestroyed; //!< whether the free list has been released
+
+    Ptr<const WifiPpdu> m_ppdu;                         //!< PPDU
+    Time m_startTime;                                   //!< start time
+    Time m_endTime;                                     //!< end time
+    std::shared_ptr<const WifiSpectrumBandInfo> m_band; //!< band of a single band event
+    Watt_u m_rxPower;                                   //!< received power of a single band event
+    /// received power in watts per band (only built when requested for a single band event)
+    mutable RxPowerWattPerChannelBand m_rxPowerW;
 };
 
 /**
@@ -199,7 +250,10 @@ class InterferenceHelper : public Object
     Time GetEnergyDuration(Watt_u energy, const WifiSpectrumBandInfo& band);
 
     /**
-     * Add the PPDU-related signal to interference helper.
+     * Add the PPDU-related signal to interference helper. The received power is moved
+     * into the returned event, unless it is received over a single band: such an event
+     * only carries the received power and shares the band with the other events, hence
+     * <i>rxPower</i> is left unchanged and may be reused by the caller.
      *
      * @param ppdu the PPDU
      * @param duration the PPDU duration
@@ -405,6 +459,11 @@ class InterferenceHelper : public Object
      */
     using FirstPowerPerBand = std::map<WifiSpectrumBandInfo, Watt_u>;
 
+    /**
+     * Map of the bands shared by the events received over a single band
+     */
+    using SharedBands = std::map<WifiSpectrumBandInfo, std::shared_ptr<const WifiSpectrumBandInfo>>;
+
     NiChangesPerBand m_niChanges; //!< NI Changes for each band
 
   private:
@@ -436,6 +495,22 @@ class InterferenceHelper : public Object
      */
     void AppendEvent(Ptr<Event> event, const FrequencyRange& freqRange, bool isStartHePortionRxing);
 
+    /**
+     * Append the given Event to the NiChanges of one of the bands it is received over.
+     *
+     * @param event the event to be appended
+     * @param band the band
+     * @param power the received power of the event over the band
+     * @param freqRange the frequency range in which the received signal event is detected
+     * @param isStartHePortionRxing flag whether event corresponds to the start of the HE portion
+     * reception (only used for MU)
+     */
+    void AppendEvent(Ptr<Event> event,
+                     const WifiSpectrumBandInfo& band,
+                     Watt_u power,
+                     const FrequencyRange& freqRange,
+                     bool isStartHePortionRxing);
+
     /**
      * Calculate noise and interference power.
      *
@@ -519,6 +594,9 @@ class InterferenceHelper : public Object
     Ptr<ErrorRateModel> m_errorRateModel; //!< error rate model
     uint8_t m_numRxAntennas;         //!< the number of RX antennas in the corresponding receiver
     FirstPowerPerBand m_firstPowers; //!< first power of each band
+    SharedBands m_sharedBands;       //!< band shared by the single band events of each band
+    std::vector<NiChanges::node_type>
+        m_unusedNiChanges; //!< nodes of the removed NiChanges, reused by the next ones
 
     /**
      * Returns an iterator to the first NiChange that is later than moment
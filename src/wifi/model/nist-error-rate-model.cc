@@ -9,8 +9,10 @@
 
 #include "nist-error-rate-model.h"
 
+#include "error-rate-lookup-table.h"
 #include "wifi-tx-vector.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <bitset>
@@ -29,11 +31,20 @@ NistErrorRateModel::GetTypeId()
     static TypeId tid = TypeId("ns3::NistErrorRateModel")
                             .SetParent<ErrorRateModel>()
                             .SetGroupName("Wifi")
-                            .AddConstructor<NistErrorRateModel>();
+                            .AddConstructor<NistErrorRateModel>()
+                            .AddAttribute("LookupTables",
+                                          "If true, interpolate the coded BER of the OFDM modes "
+                                          "in tables over a fine grid of SNRs, built on their "
+                                          "first use and shared by all the models, instead of "
+                                          "computing it for each chunk.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(&NistErrorRateModel::m_lookupTables),
+                                          MakeBooleanChecker());
     return tid;
 }
 
 NistErrorRateModel::NistErrorRateModel()
+    : m_lookupTables(false)
 {
 }
 
@@ -169,6 +180,25 @@ NistErrorRateModel::GetFecQamBer(uint16_t constellationSize,
     return pms;
 }
 
+double
+NistErrorRateModel::GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const
+{
+    double ber;
+    if (constellationSize == 2)
+    {
+        ber = GetBpskBer(snr);
+    }
+    else if (constellationSize == 4)
+    {
+        ber = GetQpskBer(snr);
+    }
+    else
+    {
+        ber = GetQamBer(constellationSize, snr);
+    }
+    return CalculatePe(ber, bValue);
+}
+
 uint8_t
 NistErrorRateModel::GetBValue(WifiCodeRate codeRate) const
 {
@@ -202,6 +232,19 @@ NistErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
     NS_LOG_FUNCTION(this << mode << snr << nbits << +numRxAntennas << field << staId);
     if (mode.GetModulationClass() >= WIFI_MOD_CLASS_ERP_OFDM)
     {
+        if (m_lookupTables)
+        {
+            const auto constellationSize = mode.GetConstellationSize();
+            const auto bValue = GetBValue(mode.GetCodeRate());
+            auto table = ErrorRateLookupTable::Get(GetTypeId(),
+                                                   (constellationSize << 8) | bValue,
+                                                   [=, this](double snr) {
+                                                       return GetCodedBer(constellationSize,
+                                                                          snr,
+                                                                          bValue);
+                                                   });
+            return table->GetChunkSuccessRate(snr, nbits);
+        }
         if (mode.GetConstellationSize() == 2)
         {
             return GetFecBpskBer(snr, nbits, GetBValue(mode.GetCodeRate()));
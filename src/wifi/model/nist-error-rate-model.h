@@ -59,6 +59,17 @@ class NistErrorRateModel : public ErrorRateModel
      * @return the coded BER
      */
     double CalculatePe(double p, uint8_t bValue) const;
+    /**
+     * Return the coded BER for the given constellation size, SNR and b, before
+     * it is capped to 1.
+     *
+     * @param constellationSize the constellation size (M)
+     * @param snr SNR ratio (in linear scale)
+     * @param bValue such that coding rate = bValue / (bValue + 1)
+     *
+     * @return the coded BER
+     */
+    double GetCodedBer(uint16_t constellationSize, double snr, uint8_t bValue) const;
     /**
      * Return BER of BPSK at the given SNR.
      *
@@ -117,6 +128,8 @@ class NistErrorRateModel : public ErrorRateModel
                         double snr,
                         uint64_t nbits,
                         uint8_t bValue) const;
+
+    bool m_lookupTables; //!< whether to interpolate the BER in lookup tables
 };
 
 } // namespace ns3
@@ -512,7 +512,10 @@ PhyEntity::DropPreambleEvent(Ptr<const WifiPpdu> ppdu, WifiPhyRxfailureReason re
     auto it = m_wifiPhy->m_currentPreambleEvents.find({ppdu->GetUid(), ppdu->GetPreamble()});
     if (it != m_wifiPhy->m_currentPreambleEvents.end())
     {
-        m_wifiPhy->m_currentPreambleEvents.erase(it);
+        // keep the node for the next preamble event
+        auto node = m_wifiPhy->m_currentPreambleEvents.extract(it);
+        node.mapped() = nullptr;
+        m_wifiPhy->m_unusedPreambleEvents.push_back(std::move(node));
     }
     if (!m_wifiPhy->IsStateSleep() && !m_wifiPhy->IsStateOff() &&
         (endRx > (Simulator::Now() + m_state->GetDelayUntilIdle())))
@@ -529,7 +532,10 @@ PhyEntity::ErasePreambleEvent(Ptr<const WifiPpdu> ppdu, Time rxDuration)
     auto it = m_wifiPhy->m_currentPreambleEvents.find({ppdu->GetUid(), ppdu->GetPreamble()});
     if (it != m_wifiPhy->m_currentPreambleEvents.end())
     {
-        m_wifiPhy->m_currentPreambleEvents.erase(it);
+        // keep the node for the next preamble event
+        auto node = m_wifiPhy->m_currentPreambleEvents.extract(it);
+        node.mapped() = nullptr;
+        m_wifiPhy->m_unusedPreambleEvents.push_back(std::move(node));
     }
     if (m_wifiPhy->m_currentPreambleEvents.empty())
     {
@@ -883,7 +889,16 @@ PhyEntity::AddPreambleEvent(Ptr<Event> event)
 {
     NS_LOG_FUNCTION(this << *event);
     Ptr<const WifiPpdu> ppdu = event->GetPpdu();
-    m_wifiPhy->m_currentPreambleEvents.insert({{ppdu->GetUid(), ppdu->GetPreamble()}, event});
+    if (m_wifiPhy->m_unusedPreambleEvents.empty())
+    {
+        m_wifiPhy->m_currentPreambleEvents.insert({{ppdu->GetUid(), ppdu->GetPreamble()}, event});
+        return;
+    }
+    auto node = std::move(m_wifiPhy->m_unusedPreambleEvents.back());
+    m_wifiPhy->m_unusedPreambleEvents.pop_back();
+    node.key() = {ppdu->GetUid(), ppdu->GetPreamble()};
+    node.mapped() = event;
+    m_wifiPhy->m_currentPreambleEvents.insert(std::move(node));
 }
 
 Ptr<Event>
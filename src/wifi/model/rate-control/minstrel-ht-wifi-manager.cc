@@ -97,8 +97,6 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
 
     McsGroupData m_groupsTable; //!< Table of groups with stats.
     bool m_isHt;                //!< If the station is HT capable.
-
-    std::ofstream m_statsFile; //!< File where statistics table is written.
 };
 
 NS_OBJECT_ENSURE_REGISTERED(MinstrelHtWifiManager);
@@ -151,6 +149,13 @@ MinstrelHtWifiManager::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&MinstrelHtWifiManager::m_printStats),
                           MakeBooleanChecker())
+            .AddAttribute("SharedSampleTable",
+                          "If true, all the stations share the sample table drawn for the first "
+                          "of them, as done by the Linux implementation, instead of drawing one "
+                          "sample table per station",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MinstrelHtWifiManager::m_sharedSampleTable),
+                          MakeBooleanChecker())
             .AddTraceSource("Rate",
                             "Traced value for rate changes (b/s)",
                             MakeTraceSourceAccessor(&MinstrelHtWifiManager::m_currentRate),
@@ -492,6 +497,7 @@ MinstrelHtWifiManager::CheckInit(MinstrelHtWifiRemoteStation* station)
             m_legacyManager->SetAttribute("SampleColumn", UintegerValue(m_nSampleCol));
             m_legacyManager->SetAttribute("PacketLength", UintegerValue(m_frameLength));
             m_legacyManager->SetAttribute("PrintStats", BooleanValue(m_printStats));
+            m_legacyManager->SetAttribute("SharedSampleTable", BooleanValue(m_sharedSampleTable));
             m_legacyManager->CheckInit(station);
         }
         else
@@ -499,8 +505,6 @@ MinstrelHtWifiManager::CheckInit(MinstrelHtWifiRemoteStation* station)
             NS_LOG_DEBUG("HT station " << station);
             station->m_isHt = true;
             station->m_nModes = GetNMcsSupported(station);
-            station->m_minstrelTable = MinstrelRate(station->m_nModes);
-            station->m_sampleTable = SampleRate(m_numRates, std::vector<uint8_t>(m_nSampleCol));
             InitSampleTable(station);
             RateInit(station);
             station->m_initialized = true;
@@ -1203,7 +1207,7 @@ MinstrelHtWifiManager::GetNextSample(MinstrelHtWifiRemoteStation* station)
     const auto sampleGroup = station->m_sampleGroup;
     const auto index = station->m_groupsTable[sampleGroup].m_index;
     const auto col = station->m_groupsTable[sampleGroup].m_col;
-    const auto sampleIndex = station->m_sampleTable[index][col];
+    const auto sampleIndex = (*station->m_sampleTable)[index][col];
     const auto rateIndex = GetIndex(sampleGroup, sampleIndex);
     NS_LOG_DEBUG("Next Sample is " << rateIndex);
     SetNextSample(station); // Calculate the next sample rate.
@@ -1238,7 +1242,7 @@ MinstrelHtWifiManager::SetNextSample(MinstrelHtWifiRemoteStation* station)
         col = station->m_groupsTable[sampleGroup].m_col;
     }
     NS_LOG_DEBUG("New sample set: group= " << +sampleGroup
-                                           << " index= " << +station->m_sampleTable[index][col]);
+                                           << " index= " << +(*station->m_sampleTable)[index][col]);
 }
 
 uint16_t
@@ -1887,8 +1891,16 @@ MinstrelHtWifiManager::InitSampleTable(MinstrelHtWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
     station->m_col = station->m_index = 0;
 
+    if (m_sharedSampleTable && m_sampleTable)
+    {
+        station->m_sampleTable = m_sampleTable;
+        return;
+    }
+
     // for off-setting to make rates fall between 0 and nModes
     auto numSampleRates = m_numRates;
+    auto sampleTable =
+        std::make_shared<SampleRate>(numSampleRates, std::vector<uint8_t>(m_nSampleCol));
 
     uint16_t newIndex;
     for (uint8_t col = 0; col < m_nSampleCol; col++)
@@ -1903,42 +1915,47 @@ MinstrelHtWifiManager::InitSampleTable(MinstrelHtWifiRemoteStation* station)
             newIndex = (i + uv) % numSampleRates;
 
             // this loop is used for filling in other uninitialized places
-            while (station->m_sampleTable[newIndex][col] != 0)
+            while ((*sampleTable)[newIndex][col] != 0)
             {
                 newIndex = (newIndex + 1) % m_numRates;
             }
-            station->m_sampleTable[newIndex][col] = i;
+            (*sampleTable)[newIndex][col] = i;
         }
     }
+    station->m_sampleTable = sampleTable;
+    if (m_sharedSampleTable)
+    {
+        m_sampleTable = sampleTable;
+    }
 }
 
 void
 MinstrelHtWifiManager::PrintTable(MinstrelHtWifiRemoteStation* station)
 {
-    if (!station->m_statsFile.is_open())
+    if (!station->m_statsFile)
     {
         std::ostringstream tmp;
         tmp << "minstrel-ht-stats-" << station->m_state->m_address << ".txt";
-        station->m_statsFile.open(tmp.str(), std::ios::out);
+        station->m_statsFile = std::make_unique<std::ofstream>(tmp.str(), std::ios::out);
     }
+    auto& statsFile = *station->m_statsFile;
 
-    station->m_statsFile
+    statsFile
         << "               best   ____________rate__________    ________statistics________    "
            "________last_______    ______sum-of________\n"
         << " mode guard #  rate  [name   idx airtime  max_tp]  [avg(tp) avg(prob) sd(prob)]  "
            "[prob.|retry|suc|att]  [#success | #attempts]\n";
     for (std::size_t i = 0; i < m_numGroups; i++)
     {
-        StatsDump(station, i, station->m_statsFile);
+        StatsDump(station, i, statsFile);
     }
 
-    station->m_statsFile << "\nTotal packet count::    ideal "
-                         << Max(0, station->m_totalPacketsCount - station->m_samplePacketsCount)
-                         << "              lookaround " << station->m_samplePacketsCount << "\n";
-    station->m_statsFile << "Average # of aggregated frames per A-MPDU: " << station->m_avgAmpduLen
-                         << "\n\n";
+    statsFile << "\nTotal packet count::    ideal "
+              << Max(0, station->m_totalPacketsCount - station->m_samplePacketsCount)
+              << "              lookaround " << station->m_samplePacketsCount << "\n";
+    statsFile << "Average # of aggregated frames per A-MPDU: " << station->m_avgAmpduLen << "\n\n";
 
-    station->m_statsFile.flush();
+    statsFile.flush();
 }
 
 void
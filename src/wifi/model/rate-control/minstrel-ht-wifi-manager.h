@@ -93,6 +93,8 @@ struct MinstrelHtWifiRemoteStation;
 
 /**
  * A struct to contain all statistics information related to a data rate.
+ * The members are sorted by decreasing size to avoid padding, since a
+ * station holds one such struct per rate of each supported group.
  */
 struct MinstrelHtRateInfo
 {
@@ -101,15 +103,8 @@ struct MinstrelHtRateInfo
      * Given a bit rate and a packet length n bytes.
      */
     Time perfectTxTime;
-    bool supported;      //!< If the rate is supported.
-    uint8_t mcsIndex;    //!< The index in the operationalMcsSet of the WifiRemoteStationManager.
-    uint32_t retryCount; //!< Retry limit.
-    uint32_t adjustedRetryCount; //!< Adjust the retry limit for this rate.
-    uint32_t numRateAttempt;     //!< Number of transmission attempts so far.
-    uint32_t numRateSuccess;     //!< Number of successful frames transmitted so far.
     double prob; //!< Current probability within last time interval. (# frame success )/(# total
                  //!< frames)
-    bool retryUpdated; //!< If number of retries was updated already.
     /**
      * Exponential weighted moving average of probability.
      * EWMA calculation:
@@ -117,13 +112,20 @@ struct MinstrelHtRateInfo
      */
     double ewmaProb;
     double ewmsdProb;            //!< Exponential weighted moving standard deviation of probability.
+    double throughput;           //!< Throughput of this rate (in packets per second).
+    uint64_t successHist;        //!< Aggregate of all transmission successes.
+    uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
+    uint32_t retryCount;         //!< Retry limit.
+    uint32_t adjustedRetryCount; //!< Adjust the retry limit for this rate.
+    uint32_t numRateAttempt;     //!< Number of transmission attempts so far.
+    uint32_t numRateSuccess;     //!< Number of successful frames transmitted so far.
     uint32_t prevNumRateAttempt; //!< Number of transmission attempts with previous rate.
     uint32_t prevNumRateSuccess; //!< Number of successful frames transmitted with previous rate.
     uint32_t numSamplesSkipped;  //!< Number of times this rate statistics were not updated because
                                  //!< no attempts have been made.
-    uint64_t successHist;        //!< Aggregate of all transmission successes.
-    uint64_t attemptHist;        //!< Aggregate of all transmission attempts.
-    double throughput;           //!< Throughput of this rate (in packets per second).
+    uint8_t mcsIndex;  //!< The index in the operationalMcsSet of the WifiRemoteStationManager.
+    bool supported;    //!< If the rate is supported.
+    bool retryUpdated; //!< If number of retries was updated already.
 };
 
 /**
@@ -496,7 +498,8 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
     double CalculateEwmsd(double oldEwmsd, double currentProb, double ewmaProb, double weight);
 
     /**
-     * Initialize Sample Table.
+     * Initialize Sample Table. If the SharedSampleTable attribute is set, the
+     * station uses the sample table drawn for the first station.
      *
      * @param station the Minstrel-HT wifi remote station
      */
@@ -696,6 +699,9 @@ class MinstrelHtWifiManager : public WifiRemoteStationManager
     bool m_useLatestAmendmentOnly; //!< Flag if only the latest supported amendment by both peers
                                    //!< should be used.
     bool m_printStats;             //!< If statistics table should be printed.
+    bool m_sharedSampleTable;      //!< If the stations share a sample table.
+
+    std::shared_ptr<const SampleRate> m_sampleTable; //!< Sample table shared by the stations.
 
     MinstrelMcsGroups m_minstrelGroups; //!< Global array for groups information.
 
@@ -82,6 +82,13 @@ MinstrelWifiManager::GetTypeId()
                           BooleanValue(false),
                           MakeBooleanAccessor(&MinstrelWifiManager::m_printSamples),
                           MakeBooleanChecker())
+            .AddAttribute("SharedSampleTable",
+                          "If true, the stations supporting the same number of rates share the "
+                          "sample table drawn for the first of them, instead of drawing one "
+                          "sample table per station",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&MinstrelWifiManager::m_sharedSampleTable),
+                          MakeBooleanChecker())
             .AddTraceSource("Rate",
                             "Traced value for rate changes (b/s)",
                             MakeTraceSourceAccessor(&MinstrelWifiManager::m_currentRate),
@@ -203,7 +210,6 @@ MinstrelWifiManager::CheckInit(MinstrelWifiRemoteStation* station)
         // before we perform our own initialization.
         station->m_nModes = GetNSupported(station);
         station->m_minstrelTable = MinstrelRate(station->m_nModes);
-        station->m_sampleTable = SampleRate(station->m_nModes, std::vector<uint8_t>(m_sampleCol));
         InitSampleTable(station);
         RateInit(station);
         station->m_initialized = true;
@@ -991,7 +997,7 @@ MinstrelWifiManager::GetNextSample(MinstrelWifiRemoteStation* station)
 {
     NS_LOG_FUNCTION(this << station);
     uint16_t bitrate;
-    bitrate = station->m_sampleTable[station->m_index][station->m_col];
+    bitrate = (*station->m_sampleTable)[station->m_index][station->m_col];
     station->m_index++;
 
     // bookkeeping for m_index and m_col variables
@@ -1086,8 +1092,26 @@ MinstrelWifiManager::InitSampleTable(MinstrelWifiRemoteStation* station)
     NS_LOG_FUNCTION(this << station);
     station->m_col = station->m_index = 0;
 
-    // for off-setting to make rates fall between 0 and nModes
-    uint8_t numSampleRates = station->m_nModes;
+    if (!m_sharedSampleTable)
+    {
+        station->m_sampleTable = DrawSampleTable(station->m_nModes);
+        return;
+    }
+
+    auto& sampleTable = m_sampleTables[station->m_nModes];
+    if (!sampleTable)
+    {
+        sampleTable = DrawSampleTable(station->m_nModes);
+    }
+    station->m_sampleTable = sampleTable;
+}
+
+std::shared_ptr<const SampleRate>
+MinstrelWifiManager::DrawSampleTable(uint8_t numSampleRates)
+{
+    NS_LOG_FUNCTION(this << +numSampleRates);
+    auto sampleTable =
+        std::make_shared<SampleRate>(numSampleRates, std::vector<uint8_t>(m_sampleCol));
 
     uint16_t newIndex;
     for (uint8_t col = 0; col < m_sampleCol; col++)
@@ -1103,13 +1127,14 @@ MinstrelWifiManager::InitSampleTable(MinstrelWifiRemoteStation* station)
             newIndex = (i + uv) % numSampleRates;
 
             // this loop is used for filling in other uninitialized places
-            while (station->m_sampleTable[newIndex][col] != 0)
+            while ((*sampleTable)[newIndex][col] != 0)
             {
-                newIndex = (newIndex + 1) % station->m_nModes;
+                newIndex = (newIndex + 1) % numSampleRates;
             }
-            station->m_sampleTable[newIndex][col] = i;
+            (*sampleTable)[newIndex][col] = i;
         }
     }
+    return sampleTable;
 }
 
 void
@@ -1121,7 +1146,7 @@ MinstrelWifiManager::PrintSampleTable(MinstrelWifiRemoteStation* station) const
     {
         for (uint8_t j = 0; j < m_sampleCol; j++)
         {
-            table << station->m_sampleTable[i][j] << "\t";
+            table << (*station->m_sampleTable)[i][j] << "\t";
         }
         table << std::endl;
     }
@@ -1131,18 +1156,18 @@ MinstrelWifiManager::PrintSampleTable(MinstrelWifiRemoteStation* station) const
 void
 MinstrelWifiManager::PrintTable(MinstrelWifiRemoteStation* station)
 {
-    if (!station->m_statsFile.is_open())
+    if (!station->m_statsFile)
     {
         std::ostringstream tmp;
         tmp << "minstrel-stats-" << station->m_state->m_address << ".txt";
-        station->m_statsFile.open(tmp.str(), std::ios::out);
+        station->m_statsFile = std::make_unique<std::ofstream>(tmp.str(), std::ios::out);
     }
+    auto& statsFile = *station->m_statsFile;
 
-    station->m_statsFile
-        << "best   _______________rate________________    ________statistics________    "
-           "________last_______    ______sum-of________\n"
-        << "rate  [      name       idx airtime max_tp]  [avg(tp) avg(prob) sd(prob)]  "
-           "[prob.|retry|suc|att]  [#success | #attempts]\n";
+    statsFile << "best   _______________rate________________    ________statistics________    "
+                 "________last_______    ______sum-of________\n"
+              << "rate  [      name       idx airtime max_tp]  [avg(tp) avg(prob) sd(prob)]  "
+                 "[prob.|retry|suc|att]  [#success | #attempts]\n";
 
     uint16_t maxTpRate = station->m_maxTpRate;
     uint16_t maxTpRate2 = station->m_maxTpRate2;
@@ -1154,46 +1179,44 @@ MinstrelWifiManager::PrintTable(MinstrelWifiRemoteStation* station)
 
         if (i == maxTpRate)
         {
-            station->m_statsFile << 'A';
+            statsFile << 'A';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
         if (i == maxTpRate2)
         {
-            station->m_statsFile << 'B';
+            statsFile << 'B';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
         if (i == maxProbRate)
         {
-            station->m_statsFile << 'P';
+            statsFile << 'P';
         }
         else
         {
-            station->m_statsFile << ' ';
+            statsFile << ' ';
         }
 
         float tmpTh = rate.throughput / 100000.0F;
-        station->m_statsFile << "   " << std::setw(17) << GetSupported(station, i) << "  "
-                             << std::setw(2) << i << "  " << std::setw(4)
-                             << rate.perfectTxTime.GetMicroSeconds() << std::setw(8)
-                             << "    -----    " << std::setw(8) << tmpTh << "    " << std::setw(3)
-                             << rate.ewmaProb / 180 << std::setw(3) << "       ---      "
-                             << std::setw(3) << rate.prob / 180 << "     " << std::setw(1)
-                             << rate.adjustedRetryCount << "   " << std::setw(3)
-                             << rate.prevNumRateSuccess << " " << std::setw(3)
-                             << rate.prevNumRateAttempt << "   " << std::setw(9) << rate.successHist
-                             << "   " << std::setw(9) << rate.attemptHist << "\n";
+        statsFile << "   " << std::setw(17) << GetSupported(station, i) << "  " << std::setw(2) << i
+                  << "  " << std::setw(4) << rate.perfectTxTime.GetMicroSeconds() << std::setw(8)
+                  << "    -----    " << std::setw(8) << tmpTh << "    " << std::setw(3)
+                  << rate.ewmaProb / 180 << std::setw(3) << "       ---      " << std::setw(3)
+                  << rate.prob / 180 << "     " << std::setw(1) << rate.adjustedRetryCount << "   "
+                  << std::setw(3) << rate.prevNumRateSuccess << " " << std::setw(3)
+                  << rate.prevNumRateAttempt << "   " << std::setw(9) << rate.successHist << "   "
+                  << std::setw(9) << rate.attemptHist << "\n";
     }
-    station->m_statsFile << "\nTotal packet count:    ideal "
-                         << station->m_totalPacketsCount - station->m_samplePacketsCount
-                         << "      lookaround " << station->m_samplePacketsCount << "\n\n";
+    statsFile << "\nTotal packet count:    ideal "
+              << station->m_totalPacketsCount - station->m_samplePacketsCount << "      lookaround "
+              << station->m_samplePacketsCount << "\n\n";
 
-    station->m_statsFile.flush();
+    statsFile.flush();
 }
 
 } // namespace ns3
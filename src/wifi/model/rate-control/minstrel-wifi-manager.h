@@ -15,6 +15,7 @@
 
 #include <fstream>
 #include <map>
+#include <memory>
 
 namespace ns3
 {
@@ -98,8 +99,11 @@ struct MinstrelWifiRemoteStation : public WifiRemoteStation
     uint16_t m_txrate;            ///< current transmit rate in bps
     bool m_initialized;           ///< for initializing tables
     MinstrelRate m_minstrelTable; ///< minstrel table
-    SampleRate m_sampleTable;     ///< sample table
-    std::ofstream m_statsFile;    ///< stats file
+
+    /// sample table, possibly shared with other stations
+    std::shared_ptr<const SampleRate> m_sampleTable;
+    /// stats file, opened when the statistics are first printed
+    std::unique_ptr<std::ofstream> m_statsFile;
 };
 
 /**
@@ -226,7 +230,9 @@ class MinstrelWifiManager : public WifiRemoteStationManager
     void CheckInit(MinstrelWifiRemoteStation* station);
 
     /**
-     * Initialize Sample Table.
+     * Initialize Sample Table. If the SharedSampleTable attribute is set, the
+     * station uses the sample table drawn for the first station with the same
+     * number of supported rates.
      *
      * @param station the station object
      */
@@ -290,6 +296,14 @@ class MinstrelWifiManager : public WifiRemoteStationManager
      */
     void RateInit(MinstrelWifiRemoteStation* station);
 
+    /**
+     * Draw a Sample Table.
+     *
+     * @param numSampleRates the number of rates
+     * @returns the sample table
+     */
+    std::shared_ptr<const SampleRate> DrawSampleTable(uint8_t numSampleRates);
+
     /**
      * Get the next sample from Sample Table.
      *
@@ -352,6 +366,10 @@ class MinstrelWifiManager : public WifiRemoteStationManager
     uint32_t m_pktLen;        ///< packet length used to calculate mode TxTime
     bool m_printStats;        ///< whether statistics table should be printed.
     bool m_printSamples;      ///< whether samples table should be printed.
+    bool m_sharedSampleTable; ///< whether stations with the same number of rates share a table
+
+    /// Sample tables shared by the stations, indexed by their number of rates
+    std::map<uint8_t, std::shared_ptr<const SampleRate>> m_sampleTables;
 
     /// Provides uniform random variables.
     Ptr<UniformRandomVariable> m_uniformRandomVariable;
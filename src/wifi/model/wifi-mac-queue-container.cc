@@ -14,6 +14,7 @@
 #include "ns3/mac48-address.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace ns3
@@ -24,22 +25,24 @@ WifiMacQueueContainer::clear()
 {
     m_queues.clear();
     m_expiredQueue.clear();
-    m_nBytesPerQueue.clear();
+    m_checkTimes.clear();
 }
 
 WifiMacQueueContainer::iterator
 WifiMacQueueContainer::insert(const_iterator pos, Ptr<WifiMpdu> item)
 {
     WifiContainerQueueId queueId = GetQueueId(item);
+    auto& info = m_queues[queueId];
 
-    NS_ABORT_MSG_UNLESS(pos == m_queues[queueId].cend() || GetQueueId(pos->mpdu) == queueId,
+    NS_ABORT_MSG_UNLESS(pos == info.queue.cend() || GetQueueId(pos->mpdu) == queueId,
                         "pos iterator does not point to the correct container queue");
     NS_ABORT_MSG_IF(!item->IsOriginal(), "Only the original copy of an MPDU can be inserted");
 
-    auto [it, ret] = m_nBytesPerQueue.insert({queueId, 0});
-    it->second += item->GetSize();
+    info.nBytes += item->GetSize();
+    // the expiry time of the item is not set yet
+    SetCheckTime(info, Time::Min());
 
-    return m_queues[queueId].emplace(pos, item);
+    return info.queue.emplace(pos, item);
 }
 
 WifiMacQueueContainer::iterator
@@ -50,13 +53,13 @@ WifiMacQueueContainer::erase(const_iterator pos)
         return m_expiredQueue.erase(pos);
     }
 
-    WifiContainerQueueId queueId = GetQueueId(pos->mpdu);
-    auto it = m_nBytesPerQueue.find(queueId);
-    NS_ASSERT(it != m_nBytesPerQueue.end());
-    NS_ASSERT(it->second >= pos->mpdu->GetSize());
-    it->second -= pos->mpdu->GetSize();
+    auto& info = m_queues[GetQueueId(pos->mpdu)];
+    NS_ASSERT(info.nBytes >= pos->mpdu->GetSize());
+    info.nBytes -= pos->mpdu->GetSize();
+    // the MPDUs following the erased one may have become the first non-inflight MPDUs
+    SetCheckTime(info, Time::Min());
 
-    return m_queues[queueId].erase(pos);
+    return info.queue.erase(pos);
 }
 
 Ptr<WifiMpdu>
@@ -106,17 +109,17 @@ WifiMacQueueContainer::GetQueueId(Ptr<const WifiMpdu> mpdu)
 const WifiMacQueueContainer::ContainerQueue&
 WifiMacQueueContainer::GetQueue(const WifiContainerQueueId& queueId) const
 {
-    return m_queues[queueId];
+    return m_queues[queueId].queue;
 }
 
 uint32_t
 WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
 {
-    if (auto it = m_queues.find(queueId); it == m_queues.end() || it->second.empty())
+    if (auto it = m_queues.find(queueId); it != m_queues.end())
     {
-        return 0;
+        return it->second.nBytes;
     }
-    return m_nBytesPerQueue.at(queueId);
+    return 0;
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
@@ -126,12 +129,22 @@ WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId)
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(QueueInfo& info) const
 {
+    Time now = Simulator::Now();
+
+    if (!info.checkIt || (*info.checkIt)->first > now)
+    {
+        // no MPDU can have an expired lifetime and be the first non-inflight MPDU
+        return {m_expiredQueue.end(), m_expiredQueue.end()};
+    }
+
+    auto& queue = info.queue;
     std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
     auto firstExpiredIt = queue.begin();
     auto lastExpiredIt = firstExpiredIt;
-    Time now = Simulator::Now();
+    // earliest expiry time of the inflight MPDUs, which may be extracted once no longer inflight
+    Time checkTime = Time::Max();
 
     do
     {
@@ -140,6 +153,7 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
              firstExpiredIt != queue.end() && !firstExpiredIt->inflights.empty();
              ++firstExpiredIt, ++lastExpiredIt)
         {
+            checkTime = std::min(checkTime, firstExpiredIt->expiryTime);
         }
 
         if (!ret)
@@ -157,11 +171,8 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
             lastExpiredIt->ac = AC_UNDEF;
             lastExpiredIt->deleter(lastExpiredIt->mpdu);
 
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
+            NS_ASSERT(info.nBytes >= lastExpiredIt->mpdu->GetSize());
+            info.nBytes -= lastExpiredIt->mpdu->GetSize();
 
             ++lastExpiredIt;
         }
@@ -177,17 +188,52 @@ WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
 
     } while (true);
 
+    // the MPDUs following the first non-inflight MPDU do not expire before it
+    if (firstExpiredIt != queue.end())
+    {
+        checkTime = std::min(checkTime, firstExpiredIt->expiryTime);
+    }
+    SetCheckTime(info, checkTime);
+
     return *ret;
 }
 
+void
+WifiMacQueueContainer::SetCheckTime(QueueInfo& info, Time checkTime) const
+{
+    if (info.checkIt)
+    {
+        if ((*info.checkIt)->first == checkTime)
+        {
+            return;
+        }
+        m_checkTimes.erase(*info.checkIt);
+        info.checkIt.reset();
+    }
+    if (checkTime != Time::Max())
+    {
+        info.checkIt = m_checkTimes.emplace(checkTime, &info);
+    }
+}
+
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
     std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
 
-    for (auto& queue : m_queues)
+    // only visit the container queues that were modified and those that may hold
+    // MPDUs with expired lifetime
+    std::vector<QueueInfo*> queues;
+    for (auto it = m_checkTimes.cbegin();
+         it != m_checkTimes.cend() && it->first <= Simulator::Now();
+         ++it)
+    {
+        queues.push_back(it->second);
+    }
+
+    for (auto info : queues)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(*info);
 
         if (firstIt != lastIt && !firstExpiredIt)
         {
@@ -215,16 +261,17 @@ std::size_t
 std::hash<ns3::WifiContainerQueueId>::operator()(ns3::WifiContainerQueueId queueId) const
 {
     auto [type, addrType, address, tid] = queueId;
-    const std::size_t size = tid.has_value() ? 8 : 7;
 
-    std::vector<uint8_t> buffer(size);
-    buffer[0] = type;
-    address.CopyTo(&buffer[1]);
-    if (tid.has_value())
+    // pack the address, the type and the TID into a 64-bit key
+    uint8_t buffer[6];
+    address.CopyTo(buffer);
+    uint64_t key = 0;
+    for (auto byte : buffer)
     {
-        buffer[7] = *tid;
+        key = (key << 8) | byte;
     }
+    key = (key << 8) | type;
+    key = (key << 8) | (tid.has_value() ? (0x80 | *tid) : 0);
 
-    std::string s(buffer.begin(), buffer.end());
-    return std::hash<std::string>{}(s);
+    return std::hash<uint64_t>{}(key);
 }
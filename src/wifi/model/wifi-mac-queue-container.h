@@ -14,6 +14,7 @@
 #include "ns3/mac48-address.h"
 
 #include <list>
+#include <map>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -99,6 +100,14 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * The container also keeps the container queues ordered by the earliest time at
+ * which MPDUs with expired lifetime may be extracted from them, so that extracting
+ * the MPDUs with expired lifetime from all the container queues only visits the
+ * container queues that were modified since they were last visited and those
+ * holding MPDUs whose lifetime may have expired. This relies on the expiry time
+ * of the MPDUs being non-decreasing along a container queue, which holds for the
+ * MPDUs enqueued by a WifiMacQueue whose maximum delay is not reduced at runtime.
  */
 class WifiMacQueueContainer
 {
@@ -195,21 +204,47 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    struct QueueInfo;
+
+    /// Container queues sorted by the time at which they must be checked for MPDUs with
+    /// expired lifetime
+    using CheckTimes = std::multimap<Time, QueueInfo*>;
+
+    /// Information associated with a container queue
+    struct QueueInfo
+    {
+        ContainerQueue queue;                        //!< the container queue
+        uint32_t nBytes{0};                          //!< size in bytes of the container queue
+        std::optional<CheckTimes::iterator> checkIt; //!< entry of the container queue in
+                                                     //!< m_checkTimes, if any
+    };
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
-     * container queue storing MPDUs with expired lifetime.
+     * container queue storing MPDUs with expired lifetime, if the given container queue has
+     * to be checked for MPDUs with expired lifetime.
      *
-     * @param queue the given container queue
+     * @param info the information associated with the given container queue
      * @return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(QueueInfo& info) const;
+
+    /**
+     * Set the time at which the given container queue must be checked for MPDUs with expired
+     * lifetime.
+     *
+     * @param info the information associated with the given container queue
+     * @param checkTime the time at which the container queue must be checked, or Time::Max()
+     *                  if the container queue does not need to be checked
+     */
+    void SetCheckTime(QueueInfo& info, Time checkTime) const;
 
-    mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
+    mutable std::unordered_map<WifiContainerQueueId, QueueInfo>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
-    mutable std::unordered_map<WifiContainerQueueId, uint32_t>
-        m_nBytesPerQueue; //!< size in bytes of the container queues
+    mutable CheckTimes m_checkTimes;       //!< container queues sorted by check time, where
+                                           //!< modified container queues have Time::Min()
 };
 
 } // namespace ns3
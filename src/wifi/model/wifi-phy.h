@@ -1360,6 +1360,8 @@ class WifiPhy : public Object
     std::map<std::pair<uint64_t /* UID*/, WifiPreamble>, Ptr<Event>>
         m_currentPreambleEvents; //!< store event associated to a PPDU (that has a unique ID and
                                  //!< preamble combination) whose preamble is being received
+    std::vector<decltype(m_currentPreambleEvents)::node_type>
+        m_unusedPreambleEvents; //!< nodes of the removed preamble events, reused by the next ones
 
     uint64_t m_previouslyRxPpduUid; //!< UID of the previously received PPDU, reset to UINT64_MAX
                                     //!< upon transmission
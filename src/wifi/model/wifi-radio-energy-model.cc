@@ -10,11 +10,15 @@
 
 #include "wifi-tx-current-model.h"
 
+#include "ns3/boolean.h"
 #include "ns3/energy-source.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/rv-battery-model.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -71,6 +75,14 @@ WifiRadioEnergyModel::GetTypeId()
                           PointerValue(),
                           MakePointerAccessor(&WifiRadioEnergyModel::m_txCurrentModel),
                           MakePointerChecker<WifiTxCurrentModel>())
+            .AddAttribute("LazyUpdate",
+                          "If true, the energy source is not updated at every state change, "
+                          "but obtains the average current drawn since its previous update "
+                          "when it is updated. This avoids rescheduling the energy depletion "
+                          "event at every state change of the radio.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&WifiRadioEnergyModel::m_lazyUpdate),
+                          MakeBooleanChecker())
             .AddTraceSource(
                 "TotalEnergyConsumption",
                 "Total energy consumption of the radio device.",
@@ -83,7 +95,12 @@ WifiRadioEnergyModel::WifiRadioEnergyModel()
     : m_source(nullptr),
       m_currentState(WifiPhyState::IDLE),
       m_lastUpdateTime(),
-      m_nPendingChangeState(0)
+      m_nPendingChangeState(0),
+      m_lazyUpdate(false),
+      m_pendingCharge(0),
+      m_depletionTime(Time::Max()),
+      m_checkRemainingEnergy(0),
+      m_checkConsumption(0)
 {
     NS_LOG_FUNCTION(this);
     m_energyDepletionCallback.Nullify();
@@ -107,7 +124,20 @@ WifiRadioEnergyModel::SetEnergySource(const Ptr<energy::EnergySource> source)
 {
     NS_LOG_FUNCTION(this << source);
     NS_ASSERT(source);
+    NS_ABORT_MSG_IF(m_lazyUpdate && DynamicCast<energy::RvBatteryModel>(source),
+                    "LazyUpdate is not supported by the RvBatteryModel, which samples the "
+                    "instantaneous current");
     m_source = source;
+    if (m_lazyUpdate)
+    {
+        m_pendingCharge = 0;
+        m_chargeFlushTime = Simulator::Now();
+        m_depletionCheckEvent.Cancel();
+        m_depletionTime = Time::Max();
+        m_depletionCheckEvent =
+            Simulator::ScheduleNow(&WifiRadioEnergyModel::CheckEnergyDepletion, this);
+        return;
+    }
     m_switchToOffEvent.Cancel();
     const auto durationToOff = GetMaximumTimeInState(m_currentState);
     m_switchToOffEvent = Simulator::Schedule(durationToOff,
@@ -259,6 +289,10 @@ WifiRadioEnergyModel::SetTxCurrentFromModel(dBm_u txPower)
     if (m_txCurrentModel)
     {
         m_txCurrent = m_txCurrentModel->CalcTxCurrent(txPower);
+        if (m_lazyUpdate && m_source && m_currentState == WifiPhyState::TX)
+        {
+            ProjectEnergyDepletion();
+        }
     }
 }
 
@@ -272,7 +306,10 @@ WifiRadioEnergyModel::GetMaximumTimeInState(WifiPhyState state) const
     const auto remainingEnergy = m_source->GetRemainingEnergy();
     const auto supplyVoltage = m_source->GetSupplyVoltage();
     const auto current = GetStateA(state);
-    return Seconds(remainingEnergy / (current * supplyVoltage));
+    // rounded down to the time resolution, so that the energy source never has to supply
+    // more energy than it holds
+    const auto maximumTime = Seconds(remainingEnergy / (current * supplyVoltage));
+    return maximumTime.IsStrictlyPositive() ? maximumTime - TimeStep(1) : maximumTime;
 }
 
 void
@@ -281,6 +318,36 @@ WifiRadioEnergyModel::ChangeState(int newState)
     WifiPhyState newPhyState{newState};
     NS_LOG_FUNCTION(this << newPhyState);
 
+    if (m_lazyUpdate)
+    {
+        const auto now = Simulator::Now();
+        const auto duration = now - m_lastUpdateTime;
+        NS_ASSERT(duration.IsPositive()); // check if duration is valid
+
+        // energy to decrease = current * voltage * time
+        const auto current = GetStateA(m_currentState);
+        m_totalEnergyConsumption += duration.GetSeconds() * current * m_source->GetSupplyVoltage();
+        // the energy source is notified of the charge when it is next updated
+        m_pendingCharge += (now - std::max(m_lastUpdateTime, m_chargeFlushTime)).GetSeconds() *
+                           current;
+        m_lastUpdateTime = now;
+
+        if (m_currentState != WifiPhyState::OFF)
+        {
+            SetWifiRadioState(newPhyState);
+        }
+        if (m_currentState == WifiPhyState::OFF)
+        {
+            m_depletionCheckEvent.Cancel();
+            m_depletionTime = Time::Max();
+        }
+        else
+        {
+            ProjectEnergyDepletion();
+        }
+        return;
+    }
+
     m_nPendingChangeState++;
 
     if (m_nPendingChangeState > 1 && newPhyState == WifiPhyState::OFF)
@@ -292,8 +359,10 @@ WifiRadioEnergyModel::ChangeState(int newState)
 
     if (newPhyState != WifiPhyState::OFF)
     {
-        m_switchToOffEvent.Cancel();
+        // getting the remaining energy updates the energy source, which may reschedule
+        // the switch off event, hence the event is cancelled afterwards
         const auto durationToOff = GetMaximumTimeInState(newPhyState);
+        m_switchToOffEvent.Cancel();
         m_switchToOffEvent = Simulator::Schedule(durationToOff,
                                                  &WifiRadioEnergyModel::ChangeState,
                                                  this,
@@ -366,7 +435,7 @@ WifiRadioEnergyModel::HandleEnergyChanged()
 {
     NS_LOG_FUNCTION(this);
     NS_LOG_DEBUG("WifiRadioEnergyModel:Energy is changed!");
-    if (m_currentState != WifiPhyState::OFF)
+    if (m_currentState != WifiPhyState::OFF && !m_lazyUpdate)
     {
         m_switchToOffEvent.Cancel();
         const auto durationToOff = GetMaximumTimeInState(m_currentState);
@@ -394,6 +463,8 @@ WifiRadioEnergyModel::DoDispose()
     NS_LOG_FUNCTION(this);
     m_source = nullptr;
     m_energyDepletionCallback.Nullify();
+    m_depletionCheckEvent.Cancel();
+    m_depletionTime = Time::Max();
 }
 
 ampere_u
@@ -425,6 +496,82 @@ WifiRadioEnergyModel::DoGetCurrentA() const
     return GetStateA(m_currentState);
 }
 
+ampere_u
+WifiRadioEnergyModel::DoCollectAverageCurrentA(Time duration)
+{
+    if (!m_lazyUpdate || !duration.IsStrictlyPositive())
+    {
+        return GetStateA(m_currentState);
+    }
+    const auto now = Simulator::Now();
+    const auto charge =
+        m_pendingCharge +
+        (now - std::max(m_lastUpdateTime, m_chargeFlushTime)).GetSeconds() *
+            GetStateA(m_currentState);
+    m_pendingCharge = 0;
+    m_chargeFlushTime = now;
+    return charge / duration.GetSeconds();
+}
+
+void
+WifiRadioEnergyModel::CheckEnergyDepletion()
+{
+    NS_LOG_FUNCTION(this);
+    m_depletionTime = Time::Max();
+    if (m_currentState == WifiPhyState::OFF)
+    {
+        return;
+    }
+    // updates the energy source, which collects the charge accumulated so far
+    const auto remainingEnergy = m_source->GetRemainingEnergy();
+    if (m_currentState == WifiPhyState::OFF)
+    {
+        // switched off by a callback invoked by the energy source
+        return;
+    }
+    const auto power = GetStateA(m_currentState) * m_source->GetSupplyVoltage();
+    if (power > 0 && remainingEnergy / power <= 2 * TimeStep(1).GetSeconds())
+    {
+        NS_LOG_DEBUG("WifiRadioEnergyModel:Energy depleted, switching off");
+        ChangeState(static_cast<int>(WifiPhyState::OFF));
+        return;
+    }
+    m_checkRemainingEnergy = remainingEnergy;
+    m_checkConsumption =
+        m_totalEnergyConsumption + (Simulator::Now() - m_lastUpdateTime).GetSeconds() * power;
+    ProjectEnergyDepletion();
+}
+
+void
+WifiRadioEnergyModel::ProjectEnergyDepletion()
+{
+    NS_LOG_FUNCTION(this);
+    const auto power = GetStateA(m_currentState) * m_source->GetSupplyVoltage();
+    if (power <= 0)
+    {
+        return; // no energy is drawn in the current state
+    }
+    const auto now = Simulator::Now();
+    const double consumption =
+        m_totalEnergyConsumption + (now - m_lastUpdateTime).GetSeconds() * power;
+    const auto remainingEnergy =
+        std::max(m_checkRemainingEnergy - (consumption - m_checkConsumption), 0.0);
+    // the depletion time is rounded down to the time resolution so that the energy
+    // source never has to draw more than it holds
+    const auto depletionTime =
+        std::max(now + Seconds(remainingEnergy / power) - TimeStep(1), now);
+    if (depletionTime >= m_depletionTime)
+    {
+        return;
+    }
+    NS_LOG_DEBUG("WifiRadioEnergyModel:Energy depletion projected at " << depletionTime);
+    m_depletionTime = depletionTime;
+    m_depletionCheckEvent.Cancel();
+    m_depletionCheckEvent = Simulator::Schedule(depletionTime - now,
+                                                &WifiRadioEnergyModel::CheckEnergyDepletion,
+                                                this);
+}
+
 void
 WifiRadioEnergyModel::SetWifiRadioState(const WifiPhyState state)
 {
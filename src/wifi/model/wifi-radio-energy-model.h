@@ -107,6 +107,21 @@ class WifiRadioEnergyModelPhyListener : public WifiPhyListener
  * object. The EnergySource object will query this model for the total current.
  * Then the EnergySource object uses the total current to calculate energy.
  *
+ * Lazy energy update: when the LazyUpdate attribute is true, a state change
+ * only accumulates the charge drawn in the previous state. The EnergySource is
+ * not notified and the energy depletion event is not rescheduled; instead, the
+ * EnergySource obtains the average current drawn since its previous update
+ * (see DeviceEnergyModel::CollectAverageCurrentA) when it is updated, either
+ * periodically or when queried. A single check event per device, scheduled at
+ * the time the remaining energy is exhausted at the current draw of the radio,
+ * switches the radio off when the energy is depleted. The check event is only
+ * moved earlier when a state change makes the projected depletion time earlier.
+ * The total energy consumption and the time the radio is switched off are the
+ * same as in the default mode, while the EnergySource low and high threshold
+ * events are only detected at the next update of the EnergySource. Energy
+ * sources that sample the instantaneous current, such as the RvBatteryModel,
+ * are not supported in this mode.
+ *
  * Default values for power consumption are based on measurements reported in:
  *
  * Daniel Halperin, Ben Greenstein, Anmol Sheth, David Wetherall,
@@ -292,7 +307,8 @@ class WifiRadioEnergyModel : public energy::DeviceEnergyModel
     /**
      * @param state the wifi state
      *
-     * @returns the time the radio can stay in that state based on the remaining energy.
+     * @returns the time the radio can stay in that state based on the remaining energy,
+     *          rounded down to the time resolution.
      */
     Time GetMaximumTimeInState(WifiPhyState state) const;
 
@@ -338,6 +354,32 @@ class WifiRadioEnergyModel : public energy::DeviceEnergyModel
      */
     ampere_u DoGetCurrentA() const override;
 
+    /**
+     * @param duration Length of the interval ending now.
+     * @returns Average current drawn by the device over the interval.
+     *
+     * In lazy update mode, returns the charge accumulated since the previous
+     * call, divided by the duration, and resets the accumulated charge.
+     *
+     * Implements DeviceEnergyModel::CollectAverageCurrentA.
+     */
+    ampere_u DoCollectAverageCurrentA(Time duration) override;
+
+    /**
+     * In lazy update mode, update the energy source and switch the radio off if
+     * the energy is depleted, or schedule the next check at the time the energy
+     * is depleted at the current draw of the radio.
+     */
+    void CheckEnergyDepletion();
+
+    /**
+     * In lazy update mode, compute the time the energy is depleted if the radio
+     * stays in its current state, from the remaining energy at the last check and
+     * the energy consumed by the radio since then, and move the depletion check
+     * to that time if it is earlier than the scheduled one.
+     */
+    void ProjectEnergyDepletion();
+
     /**
      * @param state New state the radio device is currently in.
      *
@@ -376,6 +418,14 @@ class WifiRadioEnergyModel : public energy::DeviceEnergyModel
     std::shared_ptr<WifiRadioEnergyModelPhyListener> m_listener;
 
     EventId m_switchToOffEvent; ///< switch to off event
+
+    bool m_lazyUpdate;             ///< whether the energy source is updated lazily
+    double m_pendingCharge;        ///< charge drawn since the last source update (C)
+    Time m_chargeFlushTime;        ///< time of the last source update
+    EventId m_depletionCheckEvent; ///< energy depletion check event (lazy update)
+    Time m_depletionTime;          ///< time of the scheduled depletion check
+    double m_checkRemainingEnergy; ///< remaining energy at the last depletion check (J)
+    double m_checkConsumption;     ///< energy consumed up to the last depletion check (J)
 };
 
 } // namespace ns3
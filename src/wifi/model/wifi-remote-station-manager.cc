@@ -31,6 +31,8 @@
 #include "ns3/uinteger.h"
 #include "ns3/vht-configuration.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -130,6 +132,16 @@ WifiRemoteStationManager::GetTypeId()
                                           "Rts-Cts",
                                           WifiRemoteStationManager::CTS_TO_SELF,
                                           "Cts-To-Self"))
+            .AddAttribute("MaxRemoteStations",
+                          "The maximum number of remote stations whose state is kept. When it is "
+                          "exceeded, the state of the least recently used remote stations is "
+                          "released, unless they are associated, being associated, in power save "
+                          "mode or affiliated with an MLD. A released state is created again, as "
+                          "for a new remote station, if the remote station is heard again. "
+                          "0 means no limit.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&WifiRemoteStationManager::m_maxRemoteStations),
+                          MakeUintegerChecker<uint32_t>())
             .AddTraceSource("MacTxRtsFailed",
                             "The transmission of a RTS by the MAC layer has failed",
                             MakeTraceSourceAccessor(&WifiRemoteStationManager::m_macTxRtsFailed),
@@ -172,7 +184,9 @@ void
 WifiRemoteStationManager::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_evictEvent.Cancel();
     Reset();
+    m_capabilities.clear();
 }
 
 void
@@ -1474,6 +1488,10 @@ WifiRemoteStationManager::LookupState(Mac48Address address) const
     if (stateIt != m_states.end())
     {
         NS_LOG_DEBUG("WifiRemoteStationManager::LookupState returning existing state");
+        if (m_maxRemoteStations > 0)
+        {
+            stateIt->second->m_lastUsed = Simulator::Now();
+        }
         return stateIt->second;
     }
 
@@ -1498,7 +1516,17 @@ WifiRemoteStationManager::LookupState(Mac48Address address) const
     state->m_aggregation = false;
     state->m_qosSupported = false;
     state->m_isInPsMode = false;
+    state->m_lastUsed = Simulator::Now();
     const_cast<WifiRemoteStationManager*>(this)->m_states.insert({address, state});
+    if (m_maxRemoteStations > 0 && m_states.size() > m_maxRemoteStations &&
+        !m_evictEvent.IsPending())
+    {
+        // release the states once the current event is over, so that the states and
+        // stations used by the caller remain valid
+        auto manager = const_cast<WifiRemoteStationManager*>(this);
+        manager->m_evictEvent =
+            Simulator::ScheduleNow(&WifiRemoteStationManager::EvictRemoteStations, manager);
+    }
     NS_LOG_DEBUG("WifiRemoteStationManager::LookupState returning new state");
     return state;
 }
@@ -1513,6 +1541,10 @@ WifiRemoteStationManager::Lookup(Mac48Address address) const
 
     if (stationIt != m_stations.end())
     {
+        if (m_maxRemoteStations > 0)
+        {
+            stationIt->second->m_state->m_lastUsed = Simulator::Now();
+        }
         return stationIt->second;
     }
 
@@ -1523,6 +1555,72 @@ WifiRemoteStationManager::Lookup(Mac48Address address) const
     return station;
 }
 
+void
+WifiRemoteStationManager::EvictRemoteStations()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_states.size() <= m_maxRemoteStations)
+    {
+        return;
+    }
+
+    std::vector<std::pair<Time, Mac48Address>> candidates;
+    for (const auto& [address, state] : m_states)
+    {
+        // the states of the stations affiliated with an MLD are also indexed by the MLD address
+        if (state.use_count() == 1 && !state->m_mleCommonInfo &&
+            (state->m_state == WifiRemoteStationState::BRAND_NEW ||
+             state->m_state == WifiRemoteStationState::DISASSOC ||
+             state->m_state == WifiRemoteStationState::ASSOC_REFUSED) &&
+            !state->m_isInPsMode)
+        {
+            candidates.emplace_back(state->m_lastUsed, address);
+        }
+    }
+    const auto nEvicted = std::min(candidates.size(), m_states.size() - m_maxRemoteStations);
+    std::nth_element(candidates.begin(),
+                     candidates.begin() + nEvicted,
+                     candidates.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (std::size_t i = 0; i < nEvicted; i++)
+    {
+        const auto& address = candidates[i].second;
+        NS_LOG_DEBUG("Release the state of " << address << " last used at " << candidates[i].first);
+        if (auto stationIt = m_stations.find(address); stationIt != m_stations.end())
+        {
+            delete stationIt->second;
+            m_stations.erase(stationIt);
+        }
+        m_states.erase(address);
+    }
+}
+
+template <typename T>
+Ptr<const T>
+WifiRemoteStationManager::InternCapabilities(const T& capabilities)
+{
+    for (auto it = m_capabilities.begin(); it != m_capabilities.end();)
+    {
+        if ((*it)->GetReferenceCount() == 1)
+        {
+            // no remote station holds these capabilities anymore
+            it = m_capabilities.erase(it);
+        }
+        else if (**it == capabilities)
+        {
+            return StaticCast<const T>(*it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    auto interned = Create<const T>(capabilities);
+    m_capabilities.emplace_back(interned);
+    return interned;
+}
+
 void
 WifiRemoteStationManager::SetAssociationId(Mac48Address remoteAddress, uint16_t aid)
 {
@@ -1567,7 +1665,7 @@ WifiRemoteStationManager::AddStationHtCapabilities(Mac48Address from,
             AddSupportedMcs(from, mcs);
         }
     }
-    state->m_htCapabilities = Create<const HtCapabilities>(htCapabilities);
+    state->m_htCapabilities = InternCapabilities(htCapabilities);
 }
 
 void
@@ -1577,7 +1675,7 @@ WifiRemoteStationManager::AddStationExtendedCapabilities(
 {
     NS_LOG_FUNCTION(this << from << extendedCapabilities);
     auto state = LookupState(from);
-    state->m_extendedCapabilities = Create<const ExtendedCapabilities>(extendedCapabilities);
+    state->m_extendedCapabilities = InternCapabilities(extendedCapabilities);
 }
 
 void
@@ -1605,7 +1703,7 @@ WifiRemoteStationManager::AddStationVhtCapabilities(Mac48Address from,
             }
         }
     }
-    state->m_vhtCapabilities = Create<const VhtCapabilities>(vhtCapabilities);
+    state->m_vhtCapabilities = InternCapabilities(vhtCapabilities);
 }
 
 void
@@ -1655,7 +1753,7 @@ WifiRemoteStationManager::AddStationHeCapabilities(Mac48Address from,
             AddSupportedMcs(from, mcs);
         }
     }
-    state->m_heCapabilities = Create<const HeCapabilities>(heCapabilities);
+    state->m_heCapabilities = InternCapabilities(heCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -1667,7 +1765,7 @@ WifiRemoteStationManager::AddStationHe6GhzCapabilities(
     // Used by all stations to record HE 6GHz band capabilities of remote stations
     NS_LOG_FUNCTION(this << from << he6GhzCapabilities);
     auto state = LookupState(from);
-    state->m_he6GhzBandCapabilities = Create<const He6GhzBandCapabilities>(he6GhzCapabilities);
+    state->m_he6GhzBandCapabilities = InternCapabilities(he6GhzCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -1689,7 +1787,7 @@ WifiRemoteStationManager::AddStationEhtCapabilities(Mac48Address from,
             }
         }
     }
-    state->m_ehtCapabilities = Create<const EhtCapabilities>(ehtCapabilities);
+    state->m_ehtCapabilities = InternCapabilities(ehtCapabilities);
     SetQosSupport(from, true);
 }
 
@@ -18,6 +18,7 @@
 #include "ns3/common-info-basic-mle.h"
 #include "ns3/data-rate.h"
 #include "ns3/eht-capabilities.h"
+#include "ns3/event-id.h"
 #include "ns3/he-6ghz-band-capabilities.h"
 #include "ns3/he-capabilities.h"
 #include "ns3/ht-capabilities.h"
@@ -31,6 +32,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -125,6 +127,7 @@ struct WifiRemoteStationState
     bool m_shortSlotTime; //!< Flag if short ERP slot time is supported by the remote station
     bool m_qosSupported;  //!< Flag if QoS is supported by the station
     bool m_isInPsMode;    //!< Flag if the STA is currently in PS mode
+    Time m_lastUsed;      //!< Last time the state was looked up (if MaxRemoteStations is set)
 };
 
 /**
@@ -1496,6 +1499,25 @@ class WifiRemoteStationManager : public Object
      */
     WifiRemoteStation* Lookup(Mac48Address address) const;
 
+    /**
+     * Release the state of the least recently used remote stations until the
+     * number of states does not exceed the MaxRemoteStations attribute. The
+     * states of the remote stations that are associated, being associated, in
+     * power save mode or affiliated with an MLD are kept.
+     */
+    void EvictRemoteStations();
+
+    /**
+     * Return a copy of the given capabilities that is shared with the remote
+     * stations which advertised the same capabilities.
+     *
+     * @tparam T the type of the capabilities
+     * @param capabilities the capabilities
+     * @return the shared copy of the capabilities
+     */
+    template <typename T>
+    Ptr<const T> InternCapabilities(const T& capabilities);
+
     /**
      * Actually sets the fragmentation threshold, it also checks the validity of
      * the given threshold.
@@ -1550,6 +1572,11 @@ class WifiRemoteStationManager : public Object
     StationStates m_states; //!< States of known stations
     Stations m_stations;    //!< Information for each known stations
 
+    uint32_t m_maxRemoteStations; //!< Maximum number of states of remote stations (0 if unlimited)
+    EventId m_evictEvent;         //!< Event releasing the least recently used states
+    /// Capabilities shared by the remote stations that advertised them
+    std::vector<Ptr<const WifiInformationElement>> m_capabilities;
+
     uint32_t m_maxSsrc;                //!< Maximum STA short retry count (SSRC)
     uint32_t m_maxSlrc;                //!< Maximum STA long retry count (SLRC)
     uint32_t m_rtsCtsThreshold;        //!< Threshold for RTS/CTS
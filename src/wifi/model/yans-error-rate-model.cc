@@ -9,9 +9,11 @@
 
 #include "yans-error-rate-model.h"
 
+#include "error-rate-lookup-table.h"
 #include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 
 #include <cmath>
@@ -29,11 +31,20 @@ YansErrorRateModel::GetTypeId()
     static TypeId tid = TypeId("ns3::YansErrorRateModel")
                             .SetParent<ErrorRateModel>()
                             .SetGroupName("Wifi")
-                            .AddConstructor<YansErrorRateModel>();
+                            .AddConstructor<YansErrorRateModel>()
+                            .AddAttribute("LookupTables",
+                                          "If true, interpolate the coded BER of the OFDM modes "
+                                          "in tables over a fine grid of Eb/No, built on their "
+                                          "first use and shared by all the models, instead of "
+                                          "computing it for each chunk.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(&YansErrorRateModel::m_lookupTables),
+                                          MakeBooleanChecker());
     return tid;
 }
 
 YansErrorRateModel::YansErrorRateModel()
+    : m_lookupTables(false)
 {
 }
 
@@ -142,6 +153,11 @@ YansErrorRateModel::GetFecBpskBer(double snr,
                                   uint32_t adFree) const
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << dFree << adFree);
+    if (m_lookupTables)
+    {
+        double EbNo = snr * signalSpread * 1e6 / phyRate;
+        return GetTable(2, dFree, adFree, 0)->GetChunkSuccessRate(EbNo, nbits);
+    }
     double ber = GetBpskBer(snr, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -166,6 +182,11 @@ YansErrorRateModel::GetFecQamBer(double snr,
 {
     NS_LOG_FUNCTION(this << snr << nbits << signalSpread << phyRate << m << dFree << adFree
                          << adFreePlusOne);
+    if (m_lookupTables)
+    {
+        double EbNo = snr * signalSpread * 1e6 / phyRate;
+        return GetTable(m, dFree, adFree, adFreePlusOne)->GetChunkSuccessRate(EbNo, nbits);
+    }
     double ber = GetQamBer(snr, m, signalSpread, phyRate);
     if (ber == 0.0)
     {
@@ -182,6 +203,26 @@ YansErrorRateModel::GetFecQamBer(double snr,
     return pms;
 }
 
+Ptr<const ErrorRateLookupTable>
+YansErrorRateModel::GetTable(uint32_t m,
+                             uint32_t dFree,
+                             uint32_t adFree,
+                             uint32_t adFreePlusOne) const
+{
+    // the tables are over Eb/No, which is the SNR for a signal spread of 1 MHz
+    // and a PHY rate of 1 Mbps
+    auto ber = [=, this](double EbNo) {
+        if (m == 2)
+        {
+            return adFree * CalculatePd(GetBpskBer(EbNo, MHz_u{1}, 1000000), dFree);
+        }
+        double ber = GetQamBer(EbNo, m, MHz_u{1}, 1000000);
+        return adFree * CalculatePd(ber, dFree) + adFreePlusOne * CalculatePd(ber, dFree + 1);
+    };
+    uint64_t key = (static_cast<uint64_t>(m) << 24) | (dFree << 16) | (adFree << 8) | adFreePlusOne;
+    return ErrorRateLookupTable::Get(GetTypeId(), key, ber);
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate(WifiMode mode,
                                           const WifiTxVector& txVector,
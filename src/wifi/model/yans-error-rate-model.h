@@ -14,6 +14,8 @@
 namespace ns3
 {
 
+class ErrorRateLookupTable;
+
 /**
  * @brief Model the error rate for different modulations.
  * @ingroup wifi
@@ -154,6 +156,23 @@ class YansErrorRateModel : public ErrorRateModel
                         uint32_t dfree,
                         uint32_t adFree,
                         uint32_t adFreePlusOne) const;
+    /**
+     * Get the table of the coded BER over Eb/No of a modulation and code, which
+     * is the BER of GetFecBpskBer if m is 2 and the BER of GetFecQamBer otherwise.
+     *
+     * @param m the modulation size
+     * @param dFree dfree of the convolutional code
+     * @param adFree Adfree of the convolutional code
+     * @param adFreePlusOne Adfree + 1 of the convolutional code
+     *
+     * @return the table
+     */
+    Ptr<const ErrorRateLookupTable> GetTable(uint32_t m,
+                                             uint32_t dFree,
+                                             uint32_t adFree,
+                                             uint32_t adFreePlusOne) const;
+
+    bool m_lookupTables; //!< whether to interpolate the BER in lookup tables
 };
 
 } // namespace ns3
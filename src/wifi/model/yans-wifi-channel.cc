@@ -14,6 +14,7 @@
 #include "wifi-utils.h"
 #include "yans-wifi-phy.h"
 
+#include "ns3/event-impl.h"
 #include "ns3/log.h"
 #include "ns3/mobility-model.h"
 #include "ns3/node.h"
@@ -22,6 +23,8 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/simulator.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -29,6 +32,100 @@ NS_LOG_COMPONENT_DEFINE("YansWifiChannel");
 
 NS_OBJECT_ENSURE_REGISTERED(YansWifiChannel);
 
+/**
+ * Event delivering a signal to a receiver of a YansWifiChannel.
+ *
+ * The memory of these events is recycled through a free list, hence delivering a
+ * signal to a receiver does not allocate memory once the list holds as many events
+ * as there are signals in flight.
+ */
+class YansWifiChannel::ReceiveEvent : public EventImpl
+{
+  public:
+    /**
+     * @param receiver the device the signal is delivered to
+     * @param ppdu the PPDU being sent
+     * @param rxPower the received power before the RX gain of the device is applied
+     */
+    ReceiveEvent(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, dBm_u rxPower)
+        : m_receiver(receiver),
+          m_ppdu(ppdu),
+          m_rxPower(rxPower)
+    {
+    }
+
+    /**
+     * Take the memory of an event from the free list.
+     * @param size the size of the event
+     * @return the memory of the event
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * Give the memory of an event back to the free list.
+     * @param ptr the memory of the event
+     */
+    static void operator delete(void* ptr);
+
+  protected:
+    void Notify() override
+    {
+        Receive(m_receiver, m_ppdu, m_rxPower);
+    }
+
+  private:
+    /// Free list of the memory of the events, released at the end of the program
+    struct FreeList
+    {
+        ~FreeList();
+        std::vector<void*> blocks; //!< memory of the events no longer in use
+    };
+
+    static FreeList g_freeList;      //!< the free list
+    static bool g_freeListDestroyed; //!< whether the free list has been released
+
+    Ptr<YansWifiPhy> m_receiver; //!< the device the signal is delivered to
+    Ptr<const WifiPpdu> m_ppdu;  //!< the PPDU being sent
+    dBm_u m_rxPower;             //!< the received power before the RX gain is applied
+};
+
+YansWifiChannel::ReceiveEvent::FreeList YansWifiChannel::ReceiveEvent::g_freeList;
+bool YansWifiChannel::ReceiveEvent::g_freeListDestroyed = false;
+
+YansWifiChannel::ReceiveEvent::FreeList::~FreeList()
+{
+    for (auto ptr : blocks)
+    {
+        ::operator delete(ptr);
+    }
+    blocks.clear();
+    g_freeListDestroyed = true;
+}
+
+void*
+YansWifiChannel::ReceiveEvent::operator new(std::size_t size)
+{
+    NS_ASSERT(size == sizeof(ReceiveEvent));
+    if (!g_freeListDestroyed && !g_freeList.blocks.empty())
+    {
+        auto ptr = g_freeList.blocks.back();
+        g_freeList.blocks.pop_back();
+        return ptr;
+    }
+    return ::operator new(size);
+}
+
+void
+YansWifiChannel::ReceiveEvent::operator delete(void* ptr)
+{
+    if (g_freeListDestroyed)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+    g_freeList.blocks.push_back(ptr);
+}
+
 TypeId
 YansWifiChannel::GetTypeId()
 {
@@ -81,6 +178,15 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u t
     NS_LOG_FUNCTION(this << sender << ppdu << txPower);
     Ptr<MobilityModel> senderMobility = sender->GetMobility();
     NS_ASSERT(senderMobility);
+
+    // Collect the receivers first, so that the rx power of all of them is
+    // computed by the propagation loss model in a single pass. The scratch
+    // buffers keep their capacity, hence they are only allocated once.
+    auto& receivers = m_receivers;
+    auto& receiverMobilities = m_receiverMobilities;
+    auto& rxPowers = m_rxPowers;
+    receivers.clear();
+    receiverMobilities.clear();
     for (auto i = m_phyList.begin(); i != m_phyList.end(); i++)
     {
         if (sender != (*i))
@@ -90,33 +196,65 @@ YansWifiChannel::Send(Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, dBm_u t
             {
                 continue;
             }
+            receivers.push_back(*i);
+            receiverMobilities.push_back((*i)->GetMobility()->GetObject<MobilityModel>());
+        }
+    }
+    if (receivers.empty())
+    {
+        return;
+    }
 
-            auto receiverMobility = (*i)->GetMobility()->GetObject<MobilityModel>();
-            const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
-            const dBm_u rxPower{m_loss->CalcRxPower(txPower, senderMobility, receiverMobility)};
-            NS_LOG_DEBUG("propagation: txPower="
-                         << txPower << "dBm, rxPower=" << rxPower << "dBm, "
-                         << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
-                         << "m, delay=" << delay);
-            auto dstNetDevice = (*i)->GetDevice();
-            uint32_t dstNode;
-            if (!dstNetDevice)
-            {
-                dstNode = 0xffffffff;
-            }
-            else
-            {
-                dstNode = dstNetDevice->GetNode()->GetId();
-            }
+    rxPowers.resize(receivers.size());
+    m_loss->CalcRxPowerBatch(txPower, senderMobility, receiverMobilities, rxPowers);
 
-            Simulator::ScheduleWithContext(dstNode,
-                                           delay,
-                                           &YansWifiChannel::Receive,
-                                           (*i),
-                                           ppdu,
-                                           rxPower);
+    for (std::size_t i = 0; i < receivers.size(); i++)
+    {
+        const auto& receiverMobility = receiverMobilities[i];
+        const auto delay = m_delay->GetDelay(senderMobility, receiverMobility);
+        const dBm_u rxPower{rxPowers[i]};
+        NS_LOG_DEBUG("propagation: txPower="
+                     << txPower << "dBm, rxPower=" << rxPower << "dBm, "
+                     << "distance=" << senderMobility->GetDistanceFrom(receiverMobility)
+                     << "m, delay=" << delay);
+        if (!receivers[i]->IsSignalArrivalTraced() &&
+            !IsAboveRxSensitivity(receivers[i], ppdu, rxPower))
+        {
+            // the receiver would discard the signal upon arrival without any side effect,
+            // hence spare the event (the delay is still computed to keep the random
+            // variable streams of the propagation delay model unchanged)
+            continue;
         }
+        auto dstNetDevice = receivers[i]->GetDevice();
+        uint32_t dstNode;
+        if (!dstNetDevice)
+        {
+            dstNode = 0xffffffff;
+        }
+        else
+        {
+            dstNode = dstNetDevice->GetNode()->GetId();
+        }
+
+        Simulator::ScheduleWithContext(dstNode,
+                                       delay,
+                                       new ReceiveEvent(receivers[i], ppdu, rxPower));
     }
+    // do not hold references to the receivers until the next transmission
+    receivers.clear();
+    receiverMobilities.clear();
+}
+
+bool
+YansWifiChannel::IsAboveRxSensitivity(Ptr<YansWifiPhy> phy,
+                                      Ptr<const WifiPpdu> ppdu,
+                                      dBm_u rxPower)
+{
+    // Current implementation assumes constant RX power over the PPDU duration
+    // Compare received TX power per MHz to normalized RX sensitivity
+    const auto totalRxPower = rxPower + phy->GetRxGain();
+    const auto txWidth = ppdu->GetTxChannelWidth();
+    return totalRxPower >= phy->GetRxSensitivity() + RatioToDb(txWidth / MHz_u{20});
 }
 
 void
@@ -126,19 +264,12 @@ YansWifiChannel::Receive(Ptr<YansWifiPhy> phy, Ptr<const WifiPpdu> ppdu, dBm_u r
     const auto totalRxPower = rxPower + phy->GetRxGain();
     phy->TraceSignalArrival(ppdu, totalRxPower, ppdu->GetTxDuration());
     // Do no further processing if signal is too weak
-    // Current implementation assumes constant RX power over the PPDU duration
-    // Compare received TX power per MHz to normalized RX sensitivity
-    const auto txWidth = ppdu->GetTxChannelWidth();
-    if (totalRxPower < phy->GetRxSensitivity() + RatioToDb(txWidth / MHz_u{20}))
+    if (!IsAboveRxSensitivity(phy, ppdu, rxPower))
     {
         NS_LOG_INFO("Received signal too weak to process: " << rxPower << " dBm");
         return;
     }
-    RxPowerWattPerChannelBand rxPowerW;
-
-    rxPowerW.insert(
-        {{{{0, 0}}, {{Hz_u{0}, Hz_u{0}}}}, (DbmToW(totalRxPower))}); // dummy band for YANS
-    phy->StartReceivePreamble(ppdu, rxPowerW, ppdu->GetTxDuration());
+    phy->StartReceivePreamble(ppdu, DbmToW(totalRxPower), ppdu->GetTxDuration());
 }
 
 std::size_t
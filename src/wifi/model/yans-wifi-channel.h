@@ -13,9 +13,12 @@
 
 #include "ns3/channel.h"
 
+#include <vector>
+
 namespace ns3
 {
 
+class MobilityModel;
 class NetDevice;
 class PropagationLossModel;
 class PropagationDelayModel;
@@ -93,6 +96,8 @@ class YansWifiChannel : public Channel
      */
     typedef std::vector<Ptr<YansWifiPhy>> PhyList;
 
+    class ReceiveEvent;
+
     /**
      * This method is scheduled by Send for each associated YansWifiPhy.
      * The method then calls the corresponding YansWifiPhy that the first
@@ -104,9 +109,24 @@ class YansWifiChannel : public Channel
      */
     static void Receive(Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, dBm_u txPower);
 
+    /**
+     * @param receiver the device receiving the PPDU
+     * @param ppdu the PPDU being received
+     * @param rxPower the received power before the RX gain of the device is applied
+     * @return whether the received power is high enough for the device to process the PPDU
+     */
+    static bool IsAboveRxSensitivity(Ptr<YansWifiPhy> receiver,
+                                     Ptr<const WifiPpdu> ppdu,
+                                     dBm_u rxPower);
+
     PhyList m_phyList;                  //!< List of YansWifiPhys connected to this YansWifiChannel
     Ptr<PropagationLossModel> m_loss;   //!< Propagation loss model
     Ptr<PropagationDelayModel> m_delay; //!< Propagation delay model
+
+    // Scratch buffers reused by every call to Send
+    mutable PhyList m_receivers;                                  //!< receivers of the PPDU
+    mutable std::vector<Ptr<MobilityModel>> m_receiverMobilities; //!< mobility of the receivers
+    mutable std::vector<double> m_rxPowers; //!< rx power at the receivers (dBm)
 };
 
 } // namespace ns3
@@ -38,6 +38,7 @@ YansWifiPhy::GetTypeId()
 }
 
 YansWifiPhy::YansWifiPhy()
+    : m_rxPowers{{GetDummyBand(), Watt_u{0}}}
 {
     NS_LOG_FUNCTION(this);
 }
@@ -47,11 +48,18 @@ YansWifiPhy::SetInterferenceHelper(const Ptr<InterferenceHelper> helper)
 {
     WifiPhy::SetInterferenceHelper(helper);
     // add dummy band for Yans
-    m_interference->AddBand({{{0, 0}},
-                             {{
-                                 Hz_u{0},
-                                 Hz_u{0},
-                             }}});
+    m_interference->AddBand(GetDummyBand());
+}
+
+const WifiSpectrumBandInfo&
+YansWifiPhy::GetDummyBand()
+{
+    static const WifiSpectrumBandInfo band{{{0, 0}},
+                                           {{
+                                               Hz_u{0},
+                                               Hz_u{0},
+                                           }}};
+    return band;
 }
 
 YansWifiPhy::~YansWifiPhy()
@@ -98,6 +106,22 @@ YansWifiPhy::TraceSignalArrival(Ptr<const WifiPpdu> ppdu, double rxPowerDbm, Tim
     m_signalArrivalCb(ppdu, rxPowerDbm, ppdu->GetTxDuration());
 }
 
+bool
+YansWifiPhy::IsSignalArrivalTraced() const
+{
+    return !m_signalArrivalCb.IsEmpty();
+}
+
+void
+YansWifiPhy::StartReceivePreamble(Ptr<const WifiPpdu> ppdu, Watt_u rxPower, Time rxDuration)
+{
+    NS_LOG_FUNCTION(this << ppdu << rxPower << rxDuration);
+    // the interference helper does not move the received power over a single band into
+    // the event, hence the same map is used for all the signals
+    m_rxPowers.begin()->second = rxPower;
+    WifiPhy::StartReceivePreamble(ppdu, m_rxPowers, rxDuration);
+}
+
 MHz_u
 YansWifiPhy::GetGuardBandwidth(MHz_u currentChannelWidth) const
 {
@@ -115,11 +139,7 @@ YansWifiPhy::GetTxMaskRejectionParams() const
 WifiSpectrumBandInfo
 YansWifiPhy::GetBand(MHz_u /*bandWidth*/, uint8_t /*bandIndex*/)
 {
-    return {{{0, 0}},
-            {{
-                Hz_u{0},
-                Hz_u{0},
-            }}};
+    return GetDummyBand();
 }
 
 FrequencyRange
@@ -55,6 +55,25 @@ class YansWifiPhy : public WifiPhy
     WifiSpectrumBandFrequencies ConvertIndicesToFrequencies(
         const WifiSpectrumBandIndices& indices) const override;
 
+    using WifiPhy::StartReceivePreamble;
+
+    /**
+     * Start receiving the PHY preamble of a PPDU received over the dummy band of YANS.
+     * The received power per band passed to WifiPhy::StartReceivePreamble is reused
+     * for all the received signals, hence it is not allocated for each of them.
+     *
+     * @param ppdu the arriving PPDU
+     * @param rxPower the received power, including the RX gain
+     * @param rxDuration the duration of the PPDU signal
+     */
+    void StartReceivePreamble(Ptr<const WifiPpdu> ppdu, Watt_u rxPower, Time rxDuration);
+
+    /**
+     * @return the dummy band all the signals are received over, since YANS does not
+     *         model the spectrum
+     */
+    static const WifiSpectrumBandInfo& GetDummyBand();
+
     /**
      * Set the YansWifiChannel this YansWifiPhy is to be connected to.
      *
@@ -72,6 +91,11 @@ class YansWifiPhy : public WifiPhy
      */
     void TraceSignalArrival(Ptr<const WifiPpdu> ppdu, double rxPowerDbm, Time duration);
 
+    /**
+     * @return whether a sink is connected to the SignalArrival trace source
+     */
+    bool IsSignalArrivalTraced() const;
+
     /**
      * Callback invoked when the PHY model starts to process a signal
      *
@@ -91,6 +115,8 @@ class YansWifiPhy : public WifiPhy
 
     Ptr<YansWifiChannel> m_channel; //!< YansWifiChannel that this YansWifiPhy is connected to
 
+    RxPowerWattPerChannelBand m_rxPowers; //!< received power over the dummy band
+
     TracedCallback<Ptr<const WifiPpdu>, double, Time>
         m_signalArrivalCb; //!< Signal Arrival callback
 };
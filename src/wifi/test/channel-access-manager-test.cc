@@ -1325,6 +1325,26 @@ ChannelAccessManagerTest<QosTxop>::DoRun()
     AddAccessRequest(30, 20, 107, 0);
     ExpectBackoff(30, 3, 0);
     EndTest();
+
+    // Check that the receptions occurring while the EDCAFs have nothing to transmit
+    // do not affect the access timing of the EDCAF requesting access during the last
+    // reception (EDCAF 0), nor of the EDCAF requesting access once the medium is idle
+    // (EDCAF 1)
+    //  20     50     80     110    140    170    176     180       192    212    218     230
+    //   |  rx  | idle |  rx  | idle |  rx  | sifs | aifsn | backoff | tx 0 | sifs | aifsn | tx 1 |
+    //                                  |                                     |
+    //                        150 request access (0)                220 request access (1)
+    //                           backoff slots: 3
+    StartTest(4, 6, 10);
+    AddTxop(1);
+    AddTxop(3);
+    AddRxOkEvt(20, 30);
+    AddRxOkEvt(80, 30);
+    AddRxOkEvt(140, 30);
+    AddAccessRequest(150, 20, 192, 0);
+    ExpectBackoff(150, 3, 0);
+    AddAccessRequest(220, 10, 230, 1);
+    EndTest();
 }
 
 /**
@@ -14,6 +14,7 @@
 #include <gsl/gsl_sf_bessel.h>
 #endif
 
+#include "ns3/boolean.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
@@ -1102,6 +1103,85 @@ TableBasedErrorRateTestCase::DoRun()
     }
 }
 
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * @brief Check that the NIST and YANS error rate models give the chunk success
+ * rates of their analytic expressions when they use lookup tables.
+ */
+class ErrorRateLookupTablesTestCase : public TestCase
+{
+  public:
+    ErrorRateLookupTablesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the chunk success rates of two error rate models over the OFDM
+     * and HE modes, a range of SNRs and several chunk sizes.
+     *
+     * @param analytic the model computing the analytic expressions
+     * @param table the same model using lookup tables
+     */
+    void Compare(Ptr<ErrorRateModel> analytic, Ptr<ErrorRateModel> table);
+};
+
+ErrorRateLookupTablesTestCase::ErrorRateLookupTablesTestCase()
+    : TestCase("WifiErrorRateModel test case lookup tables")
+{
+}
+
+void
+ErrorRateLookupTablesTestCase::Compare(Ptr<ErrorRateModel> analytic, Ptr<ErrorRateModel> table)
+{
+    std::vector<WifiMode> modes;
+    for (const auto& rate : {"6", "9", "12", "18", "24", "36", "48", "54"})
+    {
+        modes.emplace_back("OfdmRate" + std::string(rate) + "Mbps");
+    }
+    for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+        modes.push_back(HePhy::GetHeMcs(mcs));
+    }
+
+    for (const auto& mode : modes)
+    {
+        const auto preamble = (mode.GetModulationClass() == WIFI_MOD_CLASS_HE)
+                                  ? WIFI_PREAMBLE_HE_SU
+                                  : WIFI_PREAMBLE_LONG;
+        WifiTxVector txVector(mode, 0, preamble, NanoSeconds(800), 1, 1, 0, MHz_u{20}, false);
+        for (dB_u snr{-10}; snr < 50; snr += 0.173)
+        {
+            for (uint64_t nbits : {1, 8 * 100, 8 * 1500, 8 * 65535})
+            {
+                const double linearSnr = std::pow(10.0, snr / 10.0);
+                NS_TEST_ASSERT_MSG_EQ_TOL(
+                    table->GetChunkSuccessRate(mode, txVector, linearSnr, nbits),
+                    analytic->GetChunkSuccessRate(mode, txVector, linearSnr, nbits),
+                    1e-5,
+                    analytic->GetInstanceTypeId().GetName()
+                        << ": " << mode << " " << snr << " dB " << nbits << " bits");
+            }
+        }
+    }
+}
+
+void
+ErrorRateLookupTablesTestCase::DoRun()
+{
+    auto nist = CreateObject<NistErrorRateModel>();
+    auto nistTable = CreateObject<NistErrorRateModel>();
+    nistTable->SetAttribute("LookupTables", BooleanValue(true));
+    Compare(nist, nistTable);
+
+    auto yans = CreateObject<YansErrorRateModel>();
+    auto yansTable = CreateObject<YansErrorRateModel>();
+    yansTable->SetAttribute("LookupTables", BooleanValue(true));
+    Compare(yans, yansTable);
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -1120,6 +1200,7 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite()
     AddTestCase(new WifiErrorRateModelsTestCaseDsss, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseNist, TestCase::Duration::QUICK);
     AddTestCase(new WifiErrorRateModelsTestCaseMimo, TestCase::Duration::QUICK);
+    AddTestCase(new ErrorRateLookupTablesTestCase, TestCase::Duration::QUICK);
     AddTestCase(new TableBasedErrorRateTestCase("DefaultTableBasedHtMcs0-1458bytes",
                                                 HtPhy::GetHtMcs0(),
                                                 1458),
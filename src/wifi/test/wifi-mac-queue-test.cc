@@ -135,8 +135,9 @@ class WifiExtractExpiredMpdusTest : public TestCase
      * @param rxAddr Receiver Address of the MPDU
      * @param inflight whether the MPDU is inflight
      * @param expiryTime the expity time for the MPDU
+     * @return an iterator to the container element storing the MPDU
      */
-    void Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime);
+    WifiMacQueueContainer::iterator Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime);
 
     WifiMacQueueContainer m_container; //!< MAC queue container
     uint16_t m_currentSeqNo{0};        //!< sequence number of current MPDU
@@ -148,7 +149,7 @@ WifiExtractExpiredMpdusTest::WifiExtractExpiredMpdusTest()
 {
 }
 
-void
+WifiMacQueueContainer::iterator
 WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time expiryTime)
 {
     WifiMacHeader header(WIFI_MAC_QOSDATA);
@@ -166,6 +167,7 @@ WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time ex
         elemIt->inflights.emplace(0, mpdu);
     }
     elemIt->deleter = [](auto mpdu) {};
+    return elemIt;
 }
 
 void
@@ -192,7 +194,7 @@ WifiExtractExpiredMpdusTest::DoRun()
      * │11 │12 │13 │14 │15 │16 │17 │18 │19 │
      * └───┴───┴───┴───┴───┴───┴───┴───┴───┘
      */
-    Enqueue(rxAddr1, true, MilliSeconds(10));
+    auto firstElemIt = Enqueue(rxAddr1, true, MilliSeconds(10));
     Enqueue(rxAddr1, false, MilliSeconds(10));
     Enqueue(rxAddr1, true, MilliSeconds(12));
     Enqueue(rxAddr1, false, MilliSeconds(15));
@@ -413,6 +415,22 @@ WifiExtractExpiredMpdusTest::DoRun()
                               "There should be no other MPDU in container queue 2");
     });
 
+    /**
+     * At simulation time 60ms, MPDU 0 is no longer inflight and can be extracted, although
+     * the container queues have not been modified since the MPDUs were last extracted.
+     */
+    Simulator::Schedule(MilliSeconds(60), [&]() {
+        firstElemIt->inflights.clear();
+
+        auto [first, last] = m_container.ExtractAllExpiredMpdus();
+        NS_TEST_EXPECT_MSG_EQ((first != last), true, "Expected one MPDU extracted");
+        NS_TEST_EXPECT_MSG_EQ(first->mpdu->GetHeader().GetSequenceNumber(),
+                              0,
+                              "Unexpected extracted MPDU");
+        first++;
+        NS_TEST_EXPECT_MSG_EQ((first == last), true, "Did not expect other expired MPDUs");
+    });
+
     Simulator::Run();
     Simulator::Destroy();
 }
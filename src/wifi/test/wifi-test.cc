@@ -22,6 +22,7 @@
 #include "ns3/ht-configuration.h"
 #include "ns3/interference-helper.h"
 #include "ns3/mgt-headers.h"
+#include "ns3/minstrel-wifi-manager.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/multi-model-spectrum-channel.h"
 #include "ns3/packet-socket-client.h"
@@ -49,6 +50,7 @@
 #include "ns3/yans-wifi-phy.h"
 
 #include <optional>
+#include <vector>
 
 using namespace ns3;
 
@@ -3961,6 +3963,208 @@ DsssModulationTest::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_received, 4, "Did not receive four DSSS packets");
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * Make sure that the Minstrel stations draw the same sample tables as before
+ * by default, and that they share the sample table drawn for the first station
+ * with the same number of rates when the SharedSampleTable attribute is set.
+ */
+class MinstrelSampleTableTest : public TestCase
+{
+  public:
+    MinstrelSampleTableTest();
+
+    void DoRun() override;
+
+  private:
+    /**
+     * Draw a sample table as the Minstrel manager draws one for each station.
+     * @param random the random variable
+     * @param nRates the number of rates
+     * @param nColumns the number of columns
+     * @return the sample table
+     */
+    static SampleRate DrawSampleTable(Ptr<UniformRandomVariable> random,
+                                      uint8_t nRates,
+                                      uint8_t nColumns);
+};
+
+MinstrelSampleTableTest::MinstrelSampleTableTest()
+    : TestCase("Test the sample tables of the Minstrel stations")
+{
+}
+
+SampleRate
+MinstrelSampleTableTest::DrawSampleTable(Ptr<UniformRandomVariable> random,
+                                         uint8_t nRates,
+                                         uint8_t nColumns)
+{
+    SampleRate table(nRates, std::vector<uint8_t>(nColumns));
+    for (uint8_t col = 0; col < nColumns; col++)
+    {
+        for (uint8_t i = 0; i < nRates; i++)
+        {
+            uint16_t index = (i + random->GetInteger(0, nRates)) % nRates;
+            while (table[index][col] != 0)
+            {
+                index = (index + 1) % nRates;
+            }
+            table[index][col] = i;
+        }
+    }
+    return table;
+}
+
+void
+MinstrelSampleTableTest::DoRun()
+{
+    const int64_t stream = 1;
+    const uint8_t nRates = 8;
+    const uint8_t nColumns = 10;
+    auto reference = CreateObject<UniformRandomVariable>();
+    reference->SetStream(stream);
+
+    // by default, every station draws its own sample table
+    auto manager = CreateObject<MinstrelWifiManager>();
+    manager->AssignStreams(stream);
+    MinstrelWifiRemoteStation first;
+    MinstrelWifiRemoteStation second;
+    first.m_nModes = nRates;
+    second.m_nModes = nRates;
+    manager->InitSampleTable(&first);
+    manager->InitSampleTable(&second);
+    NS_TEST_EXPECT_MSG_EQ((*first.m_sampleTable == DrawSampleTable(reference, nRates, nColumns)),
+                          true,
+                          "Unexpected sample table of the first station");
+    NS_TEST_EXPECT_MSG_EQ((*second.m_sampleTable == DrawSampleTable(reference, nRates, nColumns)),
+                          true,
+                          "Unexpected sample table of the second station");
+    NS_TEST_EXPECT_MSG_NE(first.m_sampleTable,
+                          second.m_sampleTable,
+                          "The stations share a sample table by default");
+
+    // with SharedSampleTable, the stations with the same number of rates share a table
+    manager = CreateObjectWithAttributes<MinstrelWifiManager>("SharedSampleTable",
+                                                              BooleanValue(true));
+    manager->AssignStreams(stream);
+    MinstrelWifiRemoteStation third;
+    MinstrelWifiRemoteStation fourth;
+    MinstrelWifiRemoteStation fifth;
+    third.m_nModes = nRates;
+    fourth.m_nModes = nRates;
+    fifth.m_nModes = nRates / 2;
+    manager->InitSampleTable(&third);
+    manager->InitSampleTable(&fourth);
+    manager->InitSampleTable(&fifth);
+    NS_TEST_EXPECT_MSG_EQ((*third.m_sampleTable == *first.m_sampleTable),
+                          true,
+                          "The shared sample table is not drawn as the one of the first station");
+    NS_TEST_EXPECT_MSG_EQ(third.m_sampleTable,
+                          fourth.m_sampleTable,
+                          "The stations with the same number of rates do not share a sample table");
+    NS_TEST_EXPECT_MSG_NE(third.m_sampleTable,
+                          fifth.m_sampleTable,
+                          "The stations with different numbers of rates share a sample table");
+    NS_TEST_EXPECT_MSG_EQ(fifth.m_sampleTable->size(),
+                          nRates / 2,
+                          "Wrong number of rates of the sample table");
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * @ingroup wifi-test
+ * @ingroup tests
+ *
+ * Make sure that the remote station manager of an ad hoc station releases the
+ * state of the least recently used remote stations when their number exceeds the
+ * MaxRemoteStations attribute, and that the remote stations which advertised the
+ * same capabilities share them.
+ */
+class RemoteStationEvictionTest : public TestCase
+{
+  public:
+    RemoteStationEvictionTest();
+
+    void DoRun() override;
+
+  private:
+    /**
+     * Hear a remote station, as done by the AdhocWifiMac when receiving a frame
+     * from a remote station for the first time.
+     * @param peer the address of the remote station
+     */
+    void Hear(Mac48Address peer);
+
+    /// Check the states of the remote stations
+    void CheckStates();
+
+    Ptr<WifiNetDevice> m_device;       ///< the ad hoc device
+    std::vector<Mac48Address> m_peers; ///< the addresses of the remote stations
+};
+
+RemoteStationEvictionTest::RemoteStationEvictionTest()
+    : TestCase("Test the release of the state of the least recently used remote stations")
+{
+}
+
+void
+RemoteStationEvictionTest::Hear(Mac48Address peer)
+{
+    auto manager = m_device->GetRemoteStationManager();
+    auto mac = m_device->GetMac();
+    NS_TEST_EXPECT_MSG_EQ(manager->IsBrandNew(peer), true, "Remote station already known");
+    manager->AddAllSupportedMcs(peer);
+    manager->AddStationHtCapabilities(peer, mac->GetHtCapabilities(SINGLE_LINK_OP_ID));
+    manager->AddAllSupportedModes(peer);
+    manager->RecordDisassociated(peer);
+}
+
+void
+RemoteStationEvictionTest::CheckStates()
+{
+    auto manager = m_device->GetRemoteStationManager();
+    NS_TEST_EXPECT_MSG_EQ(manager->IsBrandNew(m_peers[1]), false, "Second state released");
+    NS_TEST_EXPECT_MSG_EQ(manager->IsBrandNew(m_peers[2]), false, "Third state released");
+    NS_TEST_EXPECT_MSG_EQ(manager->GetStationHtCapabilities(m_peers[1]),
+                          manager->GetStationHtCapabilities(m_peers[2]),
+                          "Identical HT capabilities are not shared");
+    NS_TEST_EXPECT_MSG_EQ(manager->IsBrandNew(m_peers[0]),
+                          true,
+                          "State of the least recently used remote station not released");
+}
+
+void
+RemoteStationEvictionTest::DoRun()
+{
+    NodeContainer node(1);
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "MaxRemoteStations",
+                                 UintegerValue(2));
+    m_device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, node).Get(0));
+    MobilityHelper mobility;
+    mobility.Install(node);
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        m_peers.push_back(Mac48Address::Allocate());
+        Simulator::Schedule(Seconds(i + 1), &RemoteStationEvictionTest::Hear, this, m_peers[i]);
+    }
+    Simulator::Schedule(Seconds(4), &RemoteStationEvictionTest::CheckStates, this);
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup wifi-test
  * @ingroup tests
@@ -3995,6 +4199,8 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::Duration::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::Duration::QUICK);
     AddTestCase(new DsssModulationTest, TestCase::Duration::QUICK);
+    AddTestCase(new MinstrelSampleTableTest, TestCase::Duration::QUICK);
+    AddTestCase(new RemoteStationEvictionTest, TestCase::Duration::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
@@ -0,0 +1,151 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the evaluation of the chunk success
+// rate by the NIST and YANS error rate models, with the analytic expressions
+// and with lookup tables (attribute LookupTables), and to report the accuracy
+// of the lookup tables: for each mode, the largest difference between the
+// success rates of both methods over a range of SNRs and chunk sizes.
+// Sample usage:  ./ns3 run 'bench-error-rate-model --n=1000000'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/he-phy.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/wifi-tx-vector.h"
+#include "ns3/yans-error-rate-model.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/// Sum of the results, so that the evaluations are not optimized out
+static double g_sum = 0;
+
+/**
+ * Time the evaluation of the chunk success rate of a mode.
+ * @param model the error rate model
+ * @param mode the mode
+ * @param txVector the TXVECTOR
+ * @param snrs the SNRs (linear scale) to evaluate, in turn
+ * @param n the number of evaluations
+ * @return the time per evaluation, in nanoseconds
+ */
+static double
+BenchModel(Ptr<ErrorRateModel> model,
+           WifiMode mode,
+           const WifiTxVector& txVector,
+           const std::vector<double>& snrs,
+           uint64_t n)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        g_sum += model->GetChunkSuccessRate(mode, txVector, snrs[i % snrs.size()], 8 * 1500);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+/**
+ * Get the largest difference between the chunk success rates of two models.
+ * @param analytic the model computing the analytic expressions
+ * @param table the model using lookup tables
+ * @param mode the mode
+ * @param txVector the TXVECTOR
+ * @return the largest difference
+ */
+static double
+GetMaxError(Ptr<ErrorRateModel> analytic,
+            Ptr<ErrorRateModel> table,
+            WifiMode mode,
+            const WifiTxVector& txVector)
+{
+    double maxError = 0;
+    for (double snrDb = -10; snrDb < 50; snrDb += 0.00731)
+    {
+        const double snr = std::pow(10.0, snrDb / 10.0);
+        for (uint64_t nbits : {1, 8 * 100, 8 * 1500, 8 * 65535})
+        {
+            const double error =
+                std::abs(table->GetChunkSuccessRate(mode, txVector, snr, nbits) -
+                         analytic->GetChunkSuccessRate(mode, txVector, snr, nbits));
+            maxError = std::max(maxError, error);
+        }
+    }
+    return maxError;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t n = 1000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the chunk success rate of the NIST and YANS error rate models");
+    cmd.AddValue("n", "number of evaluations of each mode", n);
+    cmd.Parse(argc, argv);
+
+    std::vector<WifiMode> modes{WifiMode("OfdmRate6Mbps"), WifiMode("OfdmRate54Mbps")};
+    for (uint8_t mcs = 0; mcs <= 11; mcs++)
+    {
+        modes.push_back(HePhy::GetHeMcs(mcs));
+    }
+
+    // SNRs around the transition of the success rate of all the modes
+    std::vector<double> snrs;
+    for (int i = 0; i < 1000; i++)
+    {
+        snrs.push_back(std::pow(10.0, (i * 0.04) / 10.0));
+    }
+
+    std::cout << "Running bench-error-rate-model with n=" << n << std::endl;
+    std::cout << std::setw(6) << std::left << "model" << std::setw(18) << "mode" << std::right
+              << std::setw(14) << "analytic ns" << std::setw(12) << "table ns" << std::setw(10)
+              << "speedup" << std::setw(14) << "max error" << std::endl;
+
+    for (const std::string model : {"NIST", "YANS"})
+    {
+        Ptr<ErrorRateModel> analytic;
+        Ptr<ErrorRateModel> table;
+        if (model == "NIST")
+        {
+            analytic = CreateObject<NistErrorRateModel>();
+            table = CreateObjectWithAttributes<NistErrorRateModel>("LookupTables",
+                                                                   BooleanValue(true));
+        }
+        else
+        {
+            analytic = CreateObject<YansErrorRateModel>();
+            table = CreateObjectWithAttributes<YansErrorRateModel>("LookupTables",
+                                                                   BooleanValue(true));
+        }
+        for (const auto& mode : modes)
+        {
+            const auto preamble = (mode.GetModulationClass() == WIFI_MOD_CLASS_HE)
+                                      ? WIFI_PREAMBLE_HE_SU
+                                      : WIFI_PREAMBLE_LONG;
+            WifiTxVector txVector(mode, 0, preamble, NanoSeconds(800), 1, 1, 0, MHz_u{20}, false);
+
+            // the first evaluation builds the table of the mode
+            const double maxError = GetMaxError(analytic, table, mode, txVector);
+            const double analyticNs = BenchModel(analytic, mode, txVector, snrs, n);
+            const double tableNs = BenchModel(table, mode, txVector, snrs, n);
+            std::cout << std::setw(6) << std::left << model << std::setw(18) << mode.GetUniqueName()
+                      << std::right << std::fixed << std::setprecision(1) << std::setw(14)
+                      << analyticNs << std::setw(12) << tableNs << std::setw(9)
+                      << analyticNs / tableNs << "x" << std::scientific << std::setprecision(2)
+                      << std::setw(14) << maxError << std::endl;
+        }
+    }
+
+    std::cout << "checksum " << g_sum << std::endl;
+    return 0;
+}
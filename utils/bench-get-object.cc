@@ -0,0 +1,123 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark Object::GetObject on a group of
+// aggregated objects of types BenchAggregate<0> to BenchAggregate<aggregates - 1>,
+// looking up the types 0, 7 and 15, and the type 16, which is never aggregated.
+// Sample usage:  ./ns3 run 'bench-get-object --n=10000000'
+
+#include "ns3/command-line.h"
+#include "ns3/object.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace ns3;
+
+/// Maximum number of aggregates of the benchmark
+static constexpr int MAX_AGGREGATES = 16;
+
+/// BenchAggregate class used for benchmarking the lookup of aggregates
+template <int N>
+class BenchAggregate : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId(GetTypeName())
+                                .SetParent<Object>()
+                                .SetGroupName("Utils")
+                                .HideFromDocumentation();
+        return tid;
+    }
+
+  private:
+    /**
+     * Get type name function
+     * @returns the type name string
+     */
+    static std::string GetTypeName()
+    {
+        std::ostringstream oss;
+        oss << "ns3::BenchAggregate<" << N << ">";
+        return oss.str();
+    }
+};
+
+/**
+ * Aggregate objects of types BenchAggregate<1> to BenchAggregate<MAX_AGGREGATES - 1>
+ * to an object of type BenchAggregate<0>.
+ * @param first the object of type BenchAggregate<0>
+ * @param n the number of aggregates in the group, including @p first
+ */
+template <int... I>
+static void
+AggregateAll(Ptr<Object> first, int n, std::integer_sequence<int, I...>)
+{
+    ((I > 0 && I < n ? first->AggregateObject(CreateObject<BenchAggregate<I>>()) : void()), ...);
+}
+
+/**
+ * Time the lookup of one aggregate type.
+ * @param object the object to look the aggregate up from
+ * @param n the number of lookups
+ * @param name the name of the case
+ */
+template <int N>
+static void
+BenchLookup(Ptr<Object> object, uint64_t n, const std::string& name)
+{
+    uint64_t found = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        found += (object->GetObject<BenchAggregate<N>>() != nullptr);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << std::setw(24) << std::left << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(2) << ns / n << " ns/call" << std::setw(12) << found
+              << " found" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t n = 10000000;
+    int aggregates = MAX_AGGREGATES;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark Object::GetObject on a group of aggregated objects");
+    cmd.AddValue("n", "number of lookups of each case", n);
+    cmd.AddValue("aggregates", "number of aggregated objects (2 to 16)", aggregates);
+    cmd.Parse(argc, argv);
+
+    if (aggregates < 2 || aggregates > MAX_AGGREGATES)
+    {
+        std::cerr << "Error-- the number of aggregates must be between 2 and " << MAX_AGGREGATES
+                  << std::endl;
+        return 1;
+    }
+
+    Ptr<Object> first = CreateObject<BenchAggregate<0>>();
+    AggregateAll(first, aggregates, std::make_integer_sequence<int, MAX_AGGREGATES>{});
+    std::cout << "Running bench-get-object with n=" << n << " and " << aggregates
+              << " aggregates" << std::endl;
+
+    BenchLookup<0>(first, n, "BenchAggregate<0>");
+    BenchLookup<MAX_AGGREGATES / 2 - 1>(first, n, "BenchAggregate<7>");
+    BenchLookup<MAX_AGGREGATES - 1>(first, n, "BenchAggregate<15>");
+    BenchLookup<MAX_AGGREGATES>(first, n, "BenchAggregate<16>");
+
+    first->Dispose();
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the memory and the statistics updates of the
+// Minstrel and Minstrel-HT remote station managers of ad hoc stations which hear all the
+// other stations, as in dense MANETs where every node holds a remote station per neighbor.
+// Each device first hears every other device, which creates the per-peer state of the rate
+// control algorithm, and the growth of the peak resident set size per remote station is
+// reported. Then, once per statistics update interval, each device reports the successful
+// transmission of a data frame to each peer, which updates the statistics of the remote
+// station, and the wall clock time per report is reported.
+// Sample usage:
+//   ./ns3 run 'bench-minstrel-wifi-manager --devices=300'
+//   ./ns3 run 'bench-minstrel-wifi-manager --standard=11n
+//              --manager=ns3::MinstrelHtWifiManager --sharedSampleTable=1'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-mpdu.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace ns3;
+
+/// State and counters of the benchmark
+struct MinstrelBench
+{
+    std::vector<Ptr<WifiNetDevice>> devices; //!< the devices
+    std::vector<Ptr<WifiMpdu>> mpdus;        //!< a data frame to each device
+    uint32_t rounds{0};                      //!< remaining rounds of reports
+    uint64_t stations{0};                    //!< number of remote stations
+    uint64_t rssGrowth{0};                   //!< peak RSS growth while hearing, in KiB
+    uint64_t reports{0};                     //!< number of reports
+    double reportSeconds{0};                 //!< wall clock time of the reports
+};
+
+/**
+ * Get the peak resident set size of the process.
+ * @return the peak resident set size, in kilobytes, or 0 if it is not available.
+ */
+static uint64_t
+GetPeakRss()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // in bytes on macOS
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/**
+ * Make each device hear all the other devices, as done by the AdhocWifiMac when
+ * receiving a frame from a peer for the first time, then select the TX vector of a
+ * data frame to the peer, which initializes the remote station of the rate control.
+ * @param bench the benchmark
+ */
+static void
+HearAll(MinstrelBench* bench)
+{
+    const auto rssBefore = GetPeakRss();
+    for (const auto& device : bench->devices)
+    {
+        auto manager = device->GetRemoteStationManager();
+        auto mac = device->GetMac();
+        for (const auto& mpdu : bench->mpdus)
+        {
+            const auto peer = mpdu->GetHeader().GetAddr1();
+            if (peer == mac->GetAddress())
+            {
+                continue;
+            }
+            if (mac->GetHtSupported(SINGLE_LINK_OP_ID))
+            {
+                manager->AddAllSupportedMcs(peer);
+                manager->AddStationHtCapabilities(peer, mac->GetHtCapabilities(SINGLE_LINK_OP_ID));
+            }
+            if (mac->GetVhtSupported(SINGLE_LINK_OP_ID))
+            {
+                manager->AddStationVhtCapabilities(peer,
+                                                   mac->GetVhtCapabilities(SINGLE_LINK_OP_ID));
+            }
+            if (mac->GetHeSupported())
+            {
+                manager->AddStationHeCapabilities(peer, mac->GetHeCapabilities(SINGLE_LINK_OP_ID));
+            }
+            manager->AddAllSupportedModes(peer);
+            manager->RecordDisassociated(peer);
+            manager->GetDataTxVector(mpdu->GetHeader(), device->GetPhy()->GetChannelWidth());
+            bench->stations++;
+        }
+    }
+    bench->rssGrowth = GetPeakRss() - rssBefore;
+}
+
+/**
+ * Make each device report the successful transmission of a data frame to each peer,
+ * then schedule the next round after the statistics update interval.
+ * @param bench the benchmark
+ * @param interval the statistics update interval
+ */
+static void
+ReportAll(MinstrelBench* bench, Time interval)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& device : bench->devices)
+    {
+        auto manager = device->GetRemoteStationManager();
+        const auto address = device->GetMac()->GetAddress();
+        const auto width = device->GetPhy()->GetChannelWidth();
+        for (const auto& mpdu : bench->mpdus)
+        {
+            if (mpdu->GetHeader().GetAddr1() == address)
+            {
+                continue;
+            }
+            const auto txVector = manager->GetDataTxVector(mpdu->GetHeader(), width);
+            manager->ReportDataOk(mpdu, 30, txVector.GetMode(), 30, txVector);
+            bench->reports++;
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    bench->reportSeconds += std::chrono::duration<double>(end - start).count();
+
+    if (--bench->rounds > 0)
+    {
+        Simulator::Schedule(interval, &ReportAll, bench, interval);
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nDevices = 300;
+    uint32_t rounds = 10;
+    std::string standard = "11a";
+    std::string manager = "ns3::MinstrelWifiManager";
+    bool sharedSampleTable = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the memory and the statistics updates of the Minstrel remote "
+              "station managers of ad hoc stations hearing all the other stations");
+    cmd.AddValue("devices", "number of devices, each hearing all the others", nDevices);
+    cmd.AddValue("rounds", "number of reports to each peer, one per update interval", rounds);
+    cmd.AddValue("standard", "Wi-Fi standard, e.g. 11a, 11n, 11ac", standard);
+    cmd.AddValue("manager", "ns3::MinstrelWifiManager or ns3::MinstrelHtWifiManager", manager);
+    cmd.AddValue("sharedSampleTable",
+                 "whether the remote stations share a sample table",
+                 sharedSampleTable);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+
+    NodeContainer nodes(nDevices);
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    WifiHelper wifi;
+    wifi.SetStandard(standard);
+    wifi.SetRemoteStationManager(manager, "SharedSampleTable", BooleanValue(sharedSampleTable));
+    auto devices = wifi.Install(phy, mac, nodes);
+    MobilityHelper mobility;
+    mobility.Install(nodes);
+
+    MinstrelBench bench;
+    for (uint32_t i = 0; i < nDevices; i++)
+    {
+        auto device = DynamicCast<WifiNetDevice>(devices.Get(i));
+        bench.devices.push_back(device);
+        WifiMacHeader header(WIFI_MAC_DATA);
+        header.SetAddr1(device->GetMac()->GetAddress());
+        bench.mpdus.push_back(Create<WifiMpdu>(Create<Packet>(1000), header));
+    }
+    bench.rounds = rounds;
+
+    TimeValue interval;
+    bench.devices[0]->GetRemoteStationManager()->GetAttribute("UpdateStatistics", interval);
+
+    std::cout << "Running bench-minstrel-wifi-manager with " << nDevices << " " << standard
+              << " devices using " << manager << (sharedSampleTable ? " with" : " without")
+              << " a shared sample table, " << rounds << " rounds of reports" << std::endl;
+
+    Simulator::Schedule(Seconds(1), &HearAll, &bench);
+    if (rounds > 0)
+    {
+        Simulator::Schedule(Seconds(1) + interval.Get(), &ReportAll, &bench, interval.Get());
+    }
+    Simulator::Run();
+
+    std::cout << bench.stations << " remote stations, peak RSS growth " << bench.rssGrowth
+              << " KiB, " << bench.rssGrowth * 1024.0 / bench.stations << " bytes per station"
+              << std::endl;
+    if (bench.reports > 0)
+    {
+        std::cout << bench.reports << " reports, " << bench.reportSeconds * 1e9 / bench.reports
+                  << " ns per report" << std::endl;
+    }
+
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the common operations on Time:
+// conversions from and to doubles and integers, arithmetic and comparisons.
+// The conversions from and to doubles are also timed through int64x64_t,
+// which is the path taken when the values are not whole numbers.
+// To compare the int64x64_t implementations, configure ns-3 with
+// -DNS3_INT64X64=INT128, CAIRO or DOUBLE and run the benchmark again.
+// Sample usage:  ./ns3 run 'bench-time --n=10000000'
+
+#include "ns3/command-line.h"
+#include "ns3/int64x64.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/// Sum of the results, so that the operations are not optimized out
+static double g_sum = 0;
+
+/**
+ * Time an operation.
+ * @param n the number of operations
+ * @param name the name of the operation
+ * @param operation the operation, called with the index of the iteration
+ */
+static void
+BenchOperation(uint64_t n,
+               const std::string& name,
+               const std::function<double(uint64_t)>& operation)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        g_sum += operation(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << std::setw(36) << std::left << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(2) << ns / n << " ns/op" << std::endl;
+}
+
+/**
+ * Get the name of the int64x64_t implementation.
+ * @return the name of the implementation
+ */
+static std::string
+GetImplementation()
+{
+    switch (int64x64_t::implementation)
+    {
+    case int64x64_t::int128_impl:
+        return "int128";
+    case int64x64_t::cairo_impl:
+        return "cairo";
+    case int64x64_t::ld_impl:
+        return "long double";
+    }
+    return "unknown";
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t n = 10000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the common operations on Time");
+    cmd.AddValue("n", "number of operations of each case", n);
+    cmd.Parse(argc, argv);
+
+    std::cout << "Running bench-time with n=" << n << ", int64x64_t implementation "
+              << GetImplementation() << std::endl;
+
+    // Simulator::Run stops the recording of the Time objects created before
+    // the simulation, which would otherwise dominate the timings
+    Simulator::Run();
+
+    // values in seconds: whole numbers of nanoseconds, and values with more digits
+    const uint64_t mask = 1023;
+    std::vector<double> whole;
+    std::vector<double> fractional;
+    std::vector<Time> times;
+    for (uint64_t i = 0; i <= mask; i++)
+    {
+        whole.push_back(i * 0.125 + 0.001);
+        fractional.push_back(i * 0.125 + 1.0 / 3);
+        times.push_back(NanoSeconds(i * 1234567));
+    }
+    std::vector<Time> wholeTimes;
+    for (double value : whole)
+    {
+        wholeTimes.push_back(Seconds(value));
+    }
+
+    BenchOperation(n, "Seconds(double), whole ns", [&](uint64_t i) {
+        return Seconds(whole[i & mask]).GetTimeStep();
+    });
+    BenchOperation(n, "  through int64x64_t", [&](uint64_t i) {
+        return Time::From(int64x64_t(whole[i & mask]), Time::S).GetTimeStep();
+    });
+    BenchOperation(n, "Seconds(double), fractional ns", [&](uint64_t i) {
+        return Seconds(fractional[i & mask]).GetTimeStep();
+    });
+    BenchOperation(n, "GetSeconds, whole s", [&](uint64_t i) {
+        return Seconds(i & mask).GetSeconds();
+    });
+    BenchOperation(n, "  through int64x64_t", [&](uint64_t i) {
+        return Seconds(i & mask).To(Time::S).GetDouble();
+    });
+    BenchOperation(n, "GetSeconds, fractional s", [&](uint64_t i) {
+        return times[i & mask].GetSeconds();
+    });
+    BenchOperation(n, "ToDouble(Time::PS)", [&](uint64_t i) {
+        return times[i & mask].ToDouble(Time::PS);
+    });
+    BenchOperation(n, "  through int64x64_t", [&](uint64_t i) {
+        return times[i & mask].To(Time::PS).GetDouble();
+    });
+    BenchOperation(n, "MilliSeconds(uint64_t)", [&](uint64_t i) {
+        return MilliSeconds(i & mask).GetTimeStep();
+    });
+    BenchOperation(n, "GetMilliSeconds", [&](uint64_t i) {
+        return times[i & mask].GetMilliSeconds();
+    });
+    BenchOperation(n, "Time + Time, Time < Time", [&](uint64_t i) {
+        return (times[i & mask] + wholeTimes[i & mask]) < times[(i + 1) & mask];
+    });
+    BenchOperation(n, "Time * double", [&](uint64_t i) {
+        return (times[i & mask] * 1.5).GetTimeStep();
+    });
+    BenchOperation(n, "Time / Time", [&](uint64_t i) {
+        return (times[i & mask] / wholeTimes[(i & mask) | 1]).GetDouble();
+    });
+
+    std::cout << "checksum " << g_sum << std::endl;
+    Simulator::Destroy();
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the setup of a large topology:
+// reading an Inet topology file, installing the internet stack on the nodes,
+// a point-to-point link per edge of the graph, and the IPv4 addresses of the
+// links.  The topology file is generated with the requested number of nodes
+// and links.  The links are installed with PointToPointHelper::InstallLinks,
+// or one at a time with PointToPointHelper::Install if --bulk=false.
+// Sample usage:  ./ns3 run 'bench-topology-setup --nodes=10000 --links=20000'
+
+#include "ns3/command-line.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/system-path.h"
+#include "ns3/topology-reader-helper.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+
+/**
+ * Write an Inet topology file: a chain linking all the nodes, and links
+ * between random nodes.
+ * @param fileName the name of the file
+ * @param nNodes the number of nodes
+ * @param nLinks the number of links
+ */
+static void
+WriteTopology(const std::string& fileName, uint32_t nNodes, uint32_t nLinks)
+{
+    auto random = CreateObject<UniformRandomVariable>();
+    std::ofstream os(fileName);
+    os << nNodes << " " << nLinks << "\n";
+    for (uint32_t i = 0; i < nNodes; i++)
+    {
+        os << i << "\t" << random->GetInteger(0, 10000) << "\t" << random->GetInteger(0, 10000)
+           << "\n";
+    }
+    for (uint32_t i = 0; i < nLinks; i++)
+    {
+        const uint32_t from = i < nNodes - 1 ? i : random->GetInteger(0, nNodes - 1);
+        uint32_t to = i < nNodes - 1 ? i + 1 : random->GetInteger(0, nNodes - 2);
+        to += (to >= from && i >= nNodes - 1) ? 1 : 0;
+        os << from << "\t" << to << "\t" << random->GetInteger(1, 1000) << "\n";
+    }
+}
+
+/// Time the phases of the setup
+class PhaseTimer
+{
+  public:
+    /// Constructor, starting the first phase
+    PhaseTimer()
+        : m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    /**
+     * Print the duration of the phase ending now, and start the next one.
+     * @param name the name of the phase
+     */
+    void End(const std::string& name)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(now - m_start).count();
+        std::cout << std::setw(24) << std::left << name << std::right << std::setw(12)
+                  << std::fixed << std::setprecision(1) << ms << " ms" << std::endl;
+        m_start = now;
+    }
+
+  private:
+    std::chrono::steady_clock::time_point m_start; //!< start of the current phase
+};
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nNodes = 10000;
+    uint32_t nLinks = 20000;
+    bool bulk = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the setup of a large point-to-point topology read from a file");
+    cmd.AddValue("nodes", "number of nodes", nNodes);
+    cmd.AddValue("links", "number of links (at least nodes - 1)", nLinks);
+    cmd.AddValue("bulk", "install all the links with a single call", bulk);
+    cmd.Parse(argc, argv);
+
+    nLinks = std::max(nLinks, nNodes - 1);
+    std::cout << "Running bench-topology-setup with " << nNodes << " nodes and " << nLinks
+              << " links" << std::endl;
+
+    const std::string fileName = SystemPath::MakeTemporaryDirectoryName() + "-topology.txt";
+    WriteTopology(fileName, nNodes, nLinks);
+
+    PhaseTimer timer;
+    TopologyReaderHelper topologyHelper;
+    topologyHelper.SetFileName(fileName);
+    topologyHelper.SetFileType("Inet");
+    Ptr<TopologyReader> reader = topologyHelper.GetTopologyReader();
+    NodeContainer nodes = reader->Read();
+    timer.End("read");
+
+    InternetStackHelper stack;
+    stack.Install(nodes);
+    timer.End("internet stack");
+
+    PointToPointHelper p2p;
+    p2p.SetChannelAttribute("Delay", StringValue("2ms"));
+    p2p.SetDeviceAttribute("DataRate", StringValue("5Mbps"));
+    NetDeviceContainer devices;
+    if (bulk)
+    {
+        NodeContainer from;
+        NodeContainer to;
+        from.Reserve(reader->LinksSize());
+        to.Reserve(reader->LinksSize());
+        for (auto link = reader->LinksBegin(); link != reader->LinksEnd(); link++)
+        {
+            from.Add(link->GetFromNode());
+            to.Add(link->GetToNode());
+        }
+        devices = p2p.InstallLinks(from, to);
+    }
+    else
+    {
+        for (auto link = reader->LinksBegin(); link != reader->LinksEnd(); link++)
+        {
+            devices.Add(p2p.Install(link->GetFromNode(), link->GetToNode()));
+        }
+    }
+    timer.End("point-to-point");
+
+    Ipv4AddressHelper address("10.0.0.0", "255.255.255.252");
+    for (uint32_t i = 0; i + 1 < devices.GetN(); i += 2)
+    {
+        NetDeviceContainer linkDevices(devices.Get(i));
+        linkDevices.Add(devices.Get(i + 1));
+        address.Assign(linkDevices);
+        address.NewNetwork();
+    }
+    timer.End("ipv4 addresses");
+
+    Simulator::Destroy();
+    timer.End("destroy");
+    std::remove(fileName.c_str());
+    return 0;
+}
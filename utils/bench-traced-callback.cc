@@ -0,0 +1,131 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the cost of firing a trace source
+// (a TracedCallback) with 0, 1 and 4 connected sinks, for the common shapes of
+// sinks: functions, member functions and functions connected with a context.
+// Sample usage:  ./ns3 run 'bench-traced-callback --n=10000000'
+
+#include "ns3/callback.h"
+#include "ns3/command-line.h"
+#include "ns3/traced-callback.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+
+/// Sum of the values received by the sinks
+static uint64_t g_sum = 0;
+
+/**
+ * Function sink.
+ * @param value the traced value
+ */
+static void
+FunctionSink(uint32_t value)
+{
+    g_sum += value;
+}
+
+/**
+ * Function sink connected with a context.
+ * @param context the context of the trace source
+ * @param value the traced value
+ */
+static void
+ContextSink(std::string context, uint32_t value)
+{
+    g_sum += value;
+}
+
+/**
+ * Function sink connected with a context taken by const reference.
+ * @param context the context of the trace source
+ * @param value the traced value
+ */
+static void
+ContextRefSink(const std::string& context, uint32_t value)
+{
+    g_sum += value;
+}
+
+/// Object holding a member function sink
+class BenchSink
+{
+  public:
+    /**
+     * Member function sink.
+     * @param value the traced value
+     */
+    void Sink(uint32_t value)
+    {
+        m_sum += value;
+    }
+
+    uint64_t m_sum{0}; //!< sum of the received values
+};
+
+/**
+ * Time the firing of a trace source.
+ * @param trace the trace source
+ * @param n the number of firings
+ * @param name the name of the case
+ */
+static void
+BenchFire(const TracedCallback<uint32_t>& trace, uint64_t n, const std::string& name)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        trace(static_cast<uint32_t>(i));
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << std::setw(24) << std::left << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(2) << ns / n << " ns/call" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t n = 10000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the firing of a TracedCallback with 0, 1 and 4 connected sinks");
+    cmd.AddValue("n", "number of firings of each case", n);
+    cmd.Parse(argc, argv);
+
+    std::cout << "Running bench-traced-callback with n=" << n << std::endl;
+
+    TracedCallback<uint32_t> empty;
+    BenchFire(empty, n, "0 sinks");
+
+    BenchSink object;
+    TracedCallback<uint32_t> function;
+    TracedCallback<uint32_t> member;
+    TracedCallback<uint32_t> context;
+    TracedCallback<uint32_t> contextRef;
+    for (int sinks = 1; sinks <= 4; sinks++)
+    {
+        function.ConnectWithoutContext(MakeCallback(&FunctionSink));
+        member.ConnectWithoutContext(MakeCallback(&BenchSink::Sink, &object));
+        context.Connect(MakeCallback(&ContextSink), "/NodeList/0/Trace");
+        contextRef.Connect(MakeCallback(&ContextRefSink), "/NodeList/0/Trace");
+        if (sinks == 1 || sinks == 4)
+        {
+            const std::string suffix = std::to_string(sinks) + (sinks == 1 ? " sink" : " sinks");
+            BenchFire(function, n, "function, " + suffix);
+            BenchFire(member, n, "member, " + suffix);
+            BenchFire(context, n, "context, " + suffix);
+            BenchFire(contextRef, n, "context ref, " + suffix);
+        }
+    }
+
+    // use the sums so that the sinks are not optimized out
+    std::cout << "checksum " << g_sum + object.m_sum << std::endl;
+    return 0;
+}
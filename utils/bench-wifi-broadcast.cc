@@ -0,0 +1,276 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-module.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Number of calls to the global operator new since the program started. */
+static uint64_t g_allocations = 0;
+
+/**
+ * Counting replacement of the global operator new.
+ * @param size the number of bytes to allocate
+ * @return the allocated memory
+ */
+void*
+operator new(std::size_t size)
+{
+    ++g_allocations;
+    if (void* ptr = std::malloc(size != 0 ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+// The replacement operators delete are not inlined into their callers, where GCC would
+// otherwise see memory obtained from operator new released with free().
+
+/**
+ * Replacement of the global operator delete matching the counting operator new.
+ * @param ptr the memory to release
+ */
+[[gnu::noinline]] void
+operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * Replacement of the global sized operator delete matching the counting operator new.
+ * @param ptr the memory to release
+ */
+[[gnu::noinline]] void
+operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/** Allocation and time counters of one benchmark run. */
+struct BroadcastBench
+{
+    uint64_t allocationsAtStart{0}; //!< allocations when the first broadcast is sent
+    uint64_t allocationsAtEnd{0};   //!< allocations when the last broadcast has been received
+    std::chrono::steady_clock::time_point wallAtStart; //!< wall clock time at start
+    std::chrono::steady_clock::time_point wallAtEnd;   //!< wall clock time at end
+
+    /** Take the start snapshot. */
+    void Start()
+    {
+        allocationsAtStart = g_allocations;
+        wallAtStart = std::chrono::steady_clock::now();
+    }
+
+    /** Take the end snapshot. */
+    void End()
+    {
+        allocationsAtEnd = g_allocations;
+        wallAtEnd = std::chrono::steady_clock::now();
+    }
+};
+
+/**
+ * Sink for the SignalArrival trace source.
+ * @param ppdu the PPDU
+ * @param rxPowerDbm the rx power
+ * @param duration the duration of the PPDU
+ */
+static void
+SignalArrival(Ptr<const WifiPpdu> ppdu, double rxPowerDbm, Time duration)
+{
+}
+
+/**
+ * Send one broadcast frame.
+ * @param device the sending device
+ * @param size the payload size
+ */
+static void
+SendBroadcast(Ptr<NetDevice> device, uint32_t size)
+{
+    device->Send(Create<Packet>(size), device->GetBroadcast(), 0x0800);
+}
+
+/** Results of the benchmark of one configuration, per broadcast. */
+struct BroadcastResult
+{
+    double allocations; //!< heap allocations per broadcast
+    double wallUs;      //!< wall clock time per broadcast, in microseconds
+};
+
+/**
+ * Run the benchmark for one configuration.
+ * @param neighbors the number of receivers
+ * @param distance the distance from the sender to all the receivers, in meters
+ * @param traced whether the SignalArrival trace source of the receivers is connected
+ * @param asleep whether the PHY of the receivers is in sleep mode
+ * @param broadcasts the number of broadcast frames
+ * @param size the payload size of the frames
+ * @return the results per broadcast
+ */
+static BroadcastResult
+Run(uint32_t neighbors,
+    double distance,
+    bool traced,
+    bool asleep,
+    uint32_t broadcasts,
+    uint32_t size)
+{
+    NodeContainer nodes;
+    nodes.Create(neighbors + 1);
+
+    // the sender is at the center of a circle the receivers lie on
+    auto positions = CreateObject<ListPositionAllocator>();
+    positions->Add(Vector(0, 0, 0));
+    for (uint32_t i = 0; i < neighbors; i++)
+    {
+        const double angle = 2 * M_PI * i / neighbors;
+        positions->Add(Vector(distance * std::cos(angle), distance * std::sin(angle), 0));
+    }
+    MobilityHelper mobility;
+    mobility.SetPositionAllocator(positions);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("OfdmRate6Mbps"));
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    NetDeviceContainer devices = wifi.Install(phy, mac, nodes);
+
+    // one broadcast every 10 ms, well beyond the frame duration
+    const Time start = Seconds(1);
+    for (uint32_t i = 1; i < devices.GetN(); i++)
+    {
+        auto yansPhy =
+            DynamicCast<YansWifiPhy>(DynamicCast<WifiNetDevice>(devices.Get(i))->GetPhy());
+        if (traced)
+        {
+            yansPhy->TraceConnectWithoutContext("SignalArrival", MakeCallback(&SignalArrival));
+        }
+        if (asleep)
+        {
+            Simulator::Schedule(start / 2, &WifiPhy::SetSleepMode, yansPhy, false);
+        }
+    }
+
+    const Time interval = MilliSeconds(10);
+    BroadcastBench bench;
+    Simulator::Schedule(start, &BroadcastBench::Start, &bench);
+    for (uint32_t i = 0; i < broadcasts; i++)
+    {
+        Simulator::Schedule(start + i * interval, &SendBroadcast, devices.Get(0), size);
+    }
+    const Time end = start + broadcasts * interval;
+    Simulator::Schedule(end, &BroadcastBench::End, &bench);
+    Simulator::Stop(end + interval);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    const double allocations = bench.allocationsAtEnd - bench.allocationsAtStart;
+    const double wallUs =
+        std::chrono::duration<double, std::micro>(bench.wallAtEnd - bench.wallAtStart).count();
+    return {allocations / broadcasts, wallUs / broadcasts};
+}
+
+/**
+ * Print the results of the benchmark of one configuration.
+ * @param neighbors the number of receivers
+ * @param distance the distance from the sender to all the receivers, in meters
+ * @param traced whether the SignalArrival trace source of the receivers is connected
+ * @param asleep whether the PHY of the receivers is in sleep mode
+ * @param result the results per broadcast
+ * @param outOfRange the results per broadcast of the same configuration with all the
+ *        receivers out of range, or null if the receivers are out of range
+ */
+static void
+Print(uint32_t neighbors,
+      double distance,
+      bool traced,
+      bool asleep,
+      const BroadcastResult& result,
+      const BroadcastResult* outOfRange)
+{
+    std::cout << std::setw(9) << neighbors << std::setw(10) << std::fixed << std::setprecision(0)
+              << distance << std::setw(8) << (traced ? "yes" : "no") << std::setw(8)
+              << (asleep ? "yes" : "no") << std::setw(18) << std::setprecision(1)
+              << result.allocations << std::setw(16);
+    if (outOfRange)
+    {
+        // the allocations of the sender are the same whether the receivers are in range
+        std::cout << std::setprecision(2)
+                  << (result.allocations - outOfRange->allocations) / neighbors;
+    }
+    else
+    {
+        std::cout << "-";
+    }
+    std::cout << std::setw(14) << std::setprecision(1) << result.wallUs << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string neighborList = "100,500";
+    uint32_t broadcasts = 100;
+    uint32_t size = 500;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the heap allocations of the broadcast of a frame over a YansWifiChannel.\n"
+              "For each number of neighbors, the receivers are either all out of range (3000 m) "
+              "or all in range (10 m), with and without a sink connected to their SignalArrival "
+              "trace source. In range receivers are also run in sleep mode, in which they only "
+              "track the interference of the signal. The allocations per in-range receiver are "
+              "those of a broadcast minus those of the same broadcast out of range.");
+    cmd.AddValue("neighbors", "comma-separated list of numbers of receivers", neighborList);
+    cmd.AddValue("broadcasts", "number of broadcast frames per configuration", broadcasts);
+    cmd.AddValue("size", "payload size of the broadcast frames, in bytes", size);
+    cmd.Parse(argc, argv);
+
+    std::vector<uint32_t> neighbors;
+    std::istringstream iss(neighborList);
+    for (std::string item; std::getline(iss, item, ',');)
+    {
+        neighbors.push_back(std::stoul(item));
+    }
+
+    std::cout << "neighbors  distance  traced  asleep  allocs/broadcast  allocs/in-range"
+              << "  us/broadcast" << std::endl;
+    for (auto n : neighbors)
+    {
+        BroadcastResult outOfRange[2];
+        for (bool traced : {false, true})
+        {
+            outOfRange[traced] = Run(n, 3000, traced, false, broadcasts, size);
+            Print(n, 3000, traced, false, outOfRange[traced], nullptr);
+        }
+        for (bool traced : {false, true})
+        {
+            const auto inRange = Run(n, 10, traced, false, broadcasts, size);
+            Print(n, 10, traced, false, inRange, &outOfRange[traced]);
+        }
+        const auto asleep = Run(n, 10, false, true, broadcasts, size);
+        Print(n, 10, false, true, asleep, &outOfRange[false]);
+    }
+    return 0;
+}
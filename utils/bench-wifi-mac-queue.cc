@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the WifiMacQueue of a station sending
+// QoS data frames to many receivers, as an ad hoc node does when routing traffic
+// to its neighbors. Every step of the simulation enqueues MPDUs for randomly
+// selected receivers, peeks and removes the first MPDU queued for randomly
+// selected receivers, as if it was acknowledged, and removes the MPDUs whose
+// lifetime expired, as done on every channel access.
+// Sample usage:  ./ns3 run 'bench-wifi-mac-queue --receivers=200 --steps=100000'
+
+#include "ns3/boolean.h"
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/// Counters of the benchmark
+struct QueueBench
+{
+    Ptr<WifiMacQueue> queue;             //!< the benchmarked queue
+    std::vector<Mac48Address> receivers; //!< the receivers of the MPDUs
+    Ptr<UniformRandomVariable> random;   //!< the selection of the receivers
+    uint32_t batch{0};                   //!< MPDUs enqueued and removed per step
+    uint64_t steps{0};                   //!< remaining steps
+    uint64_t enqueued{0};                //!< number of MPDUs enqueued
+    uint64_t removed{0};                 //!< number of MPDUs removed
+    uint64_t expired{0};                 //!< number of MPDUs whose lifetime expired
+};
+
+/**
+ * Run a step of the benchmark and schedule the next one.
+ * @param bench the benchmark
+ */
+static void
+Step(QueueBench* bench)
+{
+    const auto nReceivers = static_cast<uint32_t>(bench->receivers.size());
+    for (uint32_t i = 0; i < bench->batch; i++)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(bench->receivers[bench->random->GetInteger(0, nReceivers - 1)]);
+        header.SetQosTid(0);
+        if (bench->queue->Enqueue(Create<WifiMpdu>(Create<Packet>(1000), header)))
+        {
+            bench->enqueued++;
+        }
+    }
+    for (uint32_t i = 0; i < bench->batch; i++)
+    {
+        const auto& receiver = bench->receivers[bench->random->GetInteger(0, nReceivers - 1)];
+        if (auto mpdu = bench->queue->PeekByTidAndAddress(0, receiver))
+        {
+            bench->queue->Remove(mpdu);
+            bench->removed++;
+        }
+    }
+    bench->queue->WipeAllExpiredMpdus();
+
+    if (--bench->steps > 0)
+    {
+        Simulator::Schedule(MicroSeconds(100), &Step, bench);
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nReceivers = 200;
+    uint64_t steps = 100000;
+    uint32_t batch = 4;
+    uint32_t maxSize = 2000;
+    Time maxDelay = MilliSeconds(50);
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the WifiMacQueue of a station sending to many receivers");
+    cmd.AddValue("receivers", "number of receivers", nReceivers);
+    cmd.AddValue("steps", "number of steps, one every 100 us", steps);
+    cmd.AddValue("batch", "number of MPDUs enqueued and removed per step", batch);
+    cmd.AddValue("maxSize", "maximum size of the queue, in packets", maxSize);
+    cmd.AddValue("maxDelay", "lifetime of the queued MPDUs", maxDelay);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+
+    NodeContainer node(1);
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac", "QosSupported", BooleanValue(true));
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    auto devices = wifi.Install(phy, mac, node);
+    MobilityHelper mobility;
+    mobility.Install(node);
+
+    QueueBench bench;
+    bench.queue = DynamicCast<WifiNetDevice>(devices.Get(0))->GetMac()->GetTxopQueue(AC_BE);
+    bench.queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, maxSize));
+    bench.queue->SetMaxDelay(maxDelay);
+    bench.queue->TraceConnectWithoutContext(
+        "Expired",
+        Callback<void, Ptr<const WifiMpdu>>([&bench](Ptr<const WifiMpdu>) { bench.expired++; }));
+    for (uint32_t i = 0; i < nReceivers; i++)
+    {
+        bench.receivers.push_back(Mac48Address::Allocate());
+    }
+    bench.random = CreateObject<UniformRandomVariable>();
+    bench.batch = batch;
+    bench.steps = steps;
+
+    std::cout << "Running bench-wifi-mac-queue with " << nReceivers << " receivers, " << steps
+              << " steps of " << batch << " MPDUs" << std::endl;
+
+    Simulator::Schedule(Seconds(1), &Step, &bench);
+    const auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    const auto end = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "enqueued " << bench.enqueued << " removed " << bench.removed << " expired "
+              << bench.expired << " queued " << bench.queue->GetNPackets() << std::endl;
+    std::cout << "run time " << seconds << " s, "
+              << seconds * 1e9 / (bench.enqueued + bench.removed) << " ns per MPDU" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
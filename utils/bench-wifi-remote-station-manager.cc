@@ -0,0 +1,213 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark the memory used by the WifiRemoteStationManager
+// of ad hoc stations hearing many peers, as in large MANETs. Every step of the simulation,
+// each device hears randomly selected peers: like the AdhocWifiMac, it records the
+// capabilities of a peer heard for the first time, then it selects the TX vector of a
+// data frame to the peer, which creates the per-peer state of the rate control algorithm.
+// The growth of the peak resident set size is reported at the end of the run.
+// Sample usage:
+//   ./ns3 run 'bench-wifi-remote-station-manager --devices=50 --peers=1000'
+//   ./ns3 run 'bench-wifi-remote-station-manager --standard=11ax
+//              --manager=ns3::MinstrelHtWifiManager --maxRemoteStations=100'
+
+#include "ns3/command-line.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "ns3/wifi-helper.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace ns3;
+
+/// Counters of the benchmark
+struct StationBench
+{
+    std::vector<Ptr<WifiNetDevice>> devices; //!< the devices hearing the peers
+    std::vector<Mac48Address> peers;         //!< the addresses of the peers
+    Ptr<UniformRandomVariable> random;       //!< the selection of the peers
+    uint32_t batch{0};                       //!< peers heard by each device per step
+    uint64_t steps{0};                       //!< remaining steps
+    uint64_t heard{0};                       //!< number of peers heard
+    uint64_t newPeers{0};                    //!< number of peers without state when heard
+};
+
+/**
+ * Get the peak resident set size of the process.
+ * @return the peak resident set size, in kilobytes, or 0 if it is not available.
+ */
+static uint64_t
+GetPeakRss()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        return usage.ru_maxrss / 1024; // in bytes on macOS
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+#endif
+    return 0;
+}
+
+/**
+ * Hear a peer, as done by the AdhocWifiMac when receiving a frame from the peer, then
+ * select the TX vector of a data frame to the peer.
+ * @param bench the benchmark
+ * @param device the device hearing the peer
+ * @param peer the address of the peer
+ */
+static void
+Hear(StationBench* bench, Ptr<WifiNetDevice> device, Mac48Address peer)
+{
+    auto manager = device->GetRemoteStationManager();
+    auto mac = device->GetMac();
+    if (manager->IsBrandNew(peer))
+    {
+        bench->newPeers++;
+        if (mac->GetHtSupported(SINGLE_LINK_OP_ID))
+        {
+            manager->AddAllSupportedMcs(peer);
+            manager->AddStationHtCapabilities(peer, mac->GetHtCapabilities(SINGLE_LINK_OP_ID));
+        }
+        if (mac->GetVhtSupported(SINGLE_LINK_OP_ID))
+        {
+            manager->AddStationVhtCapabilities(peer, mac->GetVhtCapabilities(SINGLE_LINK_OP_ID));
+        }
+        if (mac->GetHeSupported())
+        {
+            manager->AddStationHeCapabilities(peer, mac->GetHeCapabilities(SINGLE_LINK_OP_ID));
+        }
+        if (mac->GetEhtSupported())
+        {
+            manager->AddStationEhtCapabilities(peer, mac->GetEhtCapabilities(SINGLE_LINK_OP_ID));
+        }
+        manager->AddAllSupportedModes(peer);
+        manager->RecordDisassociated(peer);
+    }
+
+    WifiMacHeader header(WIFI_MAC_DATA);
+    header.SetAddr1(peer);
+    header.SetAddr2(mac->GetAddress());
+    manager->GetDataTxVector(header, device->GetPhy()->GetChannelWidth());
+    bench->heard++;
+}
+
+/**
+ * Run a step of the benchmark and schedule the next one.
+ * @param bench the benchmark
+ */
+static void
+Step(StationBench* bench)
+{
+    const auto nPeers = static_cast<uint32_t>(bench->peers.size());
+    for (const auto& device : bench->devices)
+    {
+        for (uint32_t i = 0; i < bench->batch; i++)
+        {
+            Hear(bench, device, bench->peers[bench->random->GetInteger(0, nPeers - 1)]);
+        }
+    }
+
+    if (--bench->steps > 0)
+    {
+        Simulator::Schedule(MilliSeconds(1), &Step, bench);
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nDevices = 50;
+    uint32_t nPeers = 1000;
+    uint64_t steps = 1000;
+    uint32_t batch = 10;
+    std::string standard = "11a";
+    std::string manager = "ns3::MinstrelWifiManager";
+    uint32_t maxRemoteStations = 0;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark the memory used by the remote station managers of ad hoc stations");
+    cmd.AddValue("devices", "number of devices hearing the peers", nDevices);
+    cmd.AddValue("peers", "number of peers", nPeers);
+    cmd.AddValue("steps", "number of steps, one every ms", steps);
+    cmd.AddValue("batch", "number of peers heard by each device per step", batch);
+    cmd.AddValue("standard", "Wi-Fi standard, e.g. 11a, 11n, 11ax", standard);
+    cmd.AddValue("manager", "type of the remote station managers", manager);
+    cmd.AddValue("maxRemoteStations",
+                 "maximum number of remote stations per manager (0 if unlimited)",
+                 maxRemoteStations);
+    cmd.Parse(argc, argv);
+
+    RngSeedManager::SetSeed(1);
+
+    NodeContainer nodes(nDevices);
+    YansWifiChannelHelper channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    WifiHelper wifi;
+    wifi.SetStandard(standard);
+    wifi.SetRemoteStationManager(manager, "MaxRemoteStations", UintegerValue(maxRemoteStations));
+    auto devices = wifi.Install(phy, mac, nodes);
+    MobilityHelper mobility;
+    mobility.Install(nodes);
+
+    StationBench bench;
+    for (uint32_t i = 0; i < nDevices; i++)
+    {
+        bench.devices.push_back(DynamicCast<WifiNetDevice>(devices.Get(i)));
+    }
+    for (uint32_t i = 0; i < nPeers; i++)
+    {
+        bench.peers.push_back(Mac48Address::Allocate());
+    }
+    bench.random = CreateObject<UniformRandomVariable>();
+    bench.batch = batch;
+    bench.steps = steps;
+
+    std::cout << "Running bench-wifi-remote-station-manager with " << nDevices << " " << standard
+              << " devices using " << manager << ", " << nPeers << " peers, " << steps
+              << " steps of " << batch << " peers" << std::endl;
+
+    Simulator::Schedule(Seconds(1), &Step, &bench);
+    const auto rssBefore = GetPeakRss();
+    const auto start = std::chrono::steady_clock::now();
+    Simulator::Run();
+    const auto end = std::chrono::steady_clock::now();
+    const auto rssAfter = GetPeakRss();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::cout << "heard " << bench.heard << " peers, " << bench.newPeers << " without state"
+              << std::endl;
+    std::cout << "run time " << seconds << " s, " << seconds * 1e9 / bench.heard
+              << " ns per peer heard" << std::endl;
+    std::cout << "peak RSS growth " << rssAfter - rssBefore << " KiB, "
+              << (rssAfter - rssBefore) * 1024.0 / (nDevices * nPeers)
+              << " bytes per device and peer" << std::endl;
+
+    Simulator::Destroy();
+    return 0;
+}
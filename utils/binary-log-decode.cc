@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+/**
+ * @file
+ * @ingroup utils
+ * Decode a log file written by the binary logging backend.
+ */
+
+// This program prints the text of the messages recorded in a log file by
+// the binary logging backend (see ns3::BinaryLog).
+// Sample usage:  ./ns3 run 'binary-log-decode aodv.log' > aodv.txt
+
+#include "ns3/command-line.h"
+#include "ns3/log.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string filename;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Print the messages recorded in a log file by the binary logging backend");
+    cmd.AddNonOption("filename", "name of the binary log file", filename);
+    cmd.Parse(argc, argv);
+
+    std::ifstream is(filename, std::ios::binary);
+    if (!is.is_open())
+    {
+        std::cerr << "Error-- cannot open " << filename << std::endl;
+        return 1;
+    }
+    if (!BinaryLog::Decode(is, std::cout))
+    {
+        std::cerr << "Error-- " << filename << " is not a complete binary log file" << std::endl;
+        return 1;
+    }
+    return 0;
+}
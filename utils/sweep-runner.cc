@@ -0,0 +1,462 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program runs a parameter sweep of a simulation program as concurrent
+// child processes on the local machine, without MPI. Each child reports its
+// results through a SweepResultReporter into a shared memory-mapped ring, and
+// the results are aggregated into per-parameter summaries as runs complete.
+//
+// Sample usage:
+//   ./ns3 run 'sweep-runner --program=build/scratch/ns3.44-my_olsr-default
+//                           --param=nNodes=10,20,50 --runs=30 --args=--anim=false'
+
+#include "ns3/command-line.h"
+#include "ns3/sweep-result-ring.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace ns3;
+
+/** Running statistics of a metric over the runs of a parameter value (Welford). */
+class Accumulator
+{
+  public:
+    /**
+     * Add a sample
+     * @param [in] x The sample.
+     */
+    void Add(double x)
+    {
+        ++m_n;
+        double delta = x - m_mean;
+        m_mean += delta / m_n;
+        m_m2 += delta * (x - m_mean);
+        m_min = std::min(m_min, x);
+        m_max = std::max(m_max, x);
+    }
+
+    /** @returns The number of samples. */
+    uint64_t Count() const
+    {
+        return m_n;
+    }
+
+    /** @returns The mean of the samples. */
+    double Mean() const
+    {
+        return m_mean;
+    }
+
+    /** @returns The sample standard deviation. */
+    double Stddev() const
+    {
+        return m_n > 1 ? std::sqrt(m_m2 / (m_n - 1)) : 0;
+    }
+
+    /** @returns The smallest sample. */
+    double Min() const
+    {
+        return m_min;
+    }
+
+    /** @returns The largest sample. */
+    double Max() const
+    {
+        return m_max;
+    }
+
+  private:
+    uint64_t m_n{0};                                        /**< Number of samples. */
+    double m_mean{0};                                       /**< Running mean. */
+    double m_m2{0};                                         /**< Sum of squared deviations. */
+    double m_min{std::numeric_limits<double>::infinity()};  /**< Smallest sample. */
+    double m_max{-std::numeric_limits<double>::infinity()}; /**< Largest sample. */
+};
+
+/** Network-wide totals of a single run, built from its records. */
+struct RunTotals
+{
+    uint64_t flows{0};                                      /**< Number of flows. */
+    uint64_t txPackets{0};                                  /**< Transmitted packets. */
+    uint64_t rxPackets{0};                                  /**< Received packets. */
+    uint64_t lostPackets{0};                                /**< Lost packets. */
+    uint64_t rxBytes{0};                                    /**< Received bytes. */
+    int64_t delaySumNs{0};                                  /**< Sum of the delays (ns). */
+    int64_t firstTxNs{std::numeric_limits<int64_t>::max()}; /**< First transmission (ns). */
+    int64_t lastRxNs{0};                                    /**< Last reception (ns). */
+    std::map<std::string, double> counters;                 /**< Last value of each counter. */
+    bool complete{false};                                   /**< The END record was received. */
+
+    /**
+     * Account for a record
+     * @param [in] record The record.
+     */
+    void Add(const SweepRecord& record)
+    {
+        switch (record.kind)
+        {
+        case SweepRecord::FLOW:
+            ++flows;
+            txPackets += record.txPackets;
+            rxPackets += record.rxPackets;
+            lostPackets += record.lostPackets;
+            rxBytes += record.rxBytes;
+            delaySumNs += record.delaySumNs;
+            if (record.txPackets > 0)
+            {
+                firstTxNs = std::min(firstTxNs, record.timeFirstTxPacketNs);
+            }
+            if (record.rxPackets > 0)
+            {
+                lastRxNs = std::max(lastRxNs, record.timeLastRxPacketNs);
+            }
+            break;
+        case SweepRecord::COUNTER:
+            counters[record.GetName()] = record.value;
+            break;
+        case SweepRecord::END:
+            complete = true;
+            break;
+        default:
+            std::cerr << "Ignoring record of unknown kind " << record.kind << std::endl;
+        }
+    }
+};
+
+/** Summary of all the runs of a parameter value. */
+struct Summary
+{
+    uint32_t failed{0};                         /**< Runs that did not complete. */
+    std::map<std::string, Accumulator> metrics; /**< Metrics, by name. */
+
+    /**
+     * Fold the totals of a completed run into the summary
+     * @param [in] totals The run totals.
+     */
+    void Add(const RunTotals& totals)
+    {
+        metrics["flows"].Add(totals.flows);
+        metrics["txPackets"].Add(totals.txPackets);
+        metrics["rxPackets"].Add(totals.rxPackets);
+        metrics["lostPackets"].Add(totals.lostPackets);
+        if (totals.txPackets > 0)
+        {
+            metrics["pdr"].Add(static_cast<double>(totals.rxPackets) / totals.txPackets);
+        }
+        if (totals.rxPackets > 0)
+        {
+            metrics["meanDelayMs"].Add(totals.delaySumNs / 1e6 / totals.rxPackets);
+        }
+        if (totals.lastRxNs > totals.firstTxNs)
+        {
+            metrics["throughputKbps"].Add(totals.rxBytes * 8.0 * 1e6 /
+                                          (totals.lastRxNs - totals.firstTxNs));
+        }
+        for (const auto& [name, value] : totals.counters)
+        {
+            metrics[name].Add(value);
+        }
+    }
+};
+
+/** A run of the simulation program. */
+struct Job
+{
+    std::size_t valueIndex; /**< Index of the parameter value. */
+    uint32_t runNumber;     /**< RngRun of the run. */
+    pid_t pid{-1};          /**< Process id of the child. */
+    std::string ringPath;   /**< Path of the file backing the ring. */
+    SweepResultRing ring;   /**< Ring shared with the child. */
+    RunTotals totals;       /**< Totals of the run so far. */
+};
+
+/**
+ * Split a string
+ * @param [in] str The string.
+ * @param [in] sep The separator.
+ * @returns The non-empty tokens.
+ */
+std::vector<std::string>
+Split(const std::string& str, char sep)
+{
+    std::vector<std::string> tokens;
+    std::istringstream iss(str);
+    std::string token;
+    while (std::getline(iss, token, sep))
+    {
+        if (!token.empty())
+        {
+            tokens.push_back(token);
+        }
+    }
+    return tokens;
+}
+
+/**
+ * Start a child process running the simulation program
+ * @param [in,out] job The job to start.
+ * @param [in] argv The arguments of the program, including the program itself.
+ * @param [in] quiet Whether to discard the standard output of the child.
+ * @returns true if the child has been started.
+ */
+bool
+StartJob(Job& job, const std::vector<std::string>& argv, bool quiet)
+{
+    std::vector<char*> cargv;
+    for (const auto& arg : argv)
+    {
+        cargv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    cargv.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        std::cerr << "fork failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (pid == 0)
+    {
+        setenv("NS3_SWEEP_RING", job.ringPath.c_str(), 1);
+        if (quiet)
+        {
+            int devNull = open("/dev/null", O_WRONLY);
+            if (devNull >= 0)
+            {
+                dup2(devNull, STDOUT_FILENO);
+                close(devNull);
+            }
+        }
+        execv(cargv[0], cargv.data());
+        std::cerr << "Cannot execute " << cargv[0] << ": " << std::strerror(errno) << std::endl;
+        _exit(127);
+    }
+    job.pid = pid;
+    return true;
+}
+
+/**
+ * Move the records available in the ring of a job to its totals
+ * @param [in,out] job The job.
+ * @returns The number of records read.
+ */
+uint64_t
+Drain(Job& job)
+{
+    uint64_t n = 0;
+    SweepRecord record;
+    while (job.ring.Pop(record))
+    {
+        job.totals.Add(record);
+        ++n;
+    }
+    return n;
+}
+
+/**
+ * Print the summaries
+ * @param [in,out] os The output stream.
+ * @param [in] param The name of the swept parameter.
+ * @param [in] values The parameter values.
+ * @param [in] summaries The summaries, one per value.
+ */
+void
+PrintSummaries(std::ostream& os,
+               const std::string& param,
+               const std::vector<std::string>& values,
+               const std::vector<Summary>& summaries)
+{
+    os << param << ",metric,runs,failed,mean,stddev,min,max" << std::endl;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        for (const auto& [name, acc] : summaries[i].metrics)
+        {
+            os << values[i] << "," << name << "," << acc.Count() << "," << summaries[i].failed
+               << "," << acc.Mean() << "," << acc.Stddev() << "," << acc.Min() << ","
+               << acc.Max() << std::endl;
+        }
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string program;
+    std::string param;
+    std::string extraArgs;
+    std::string ringDir = "/dev/shm";
+    std::string output;
+    uint32_t runs = 1;
+    uint32_t firstRun = 1;
+    uint32_t jobs = std::max(1U, std::thread::hardware_concurrency());
+    uint32_t capacity = 4096;
+    bool quiet = true;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Run a parameter sweep of a simulation program as concurrent child processes.\n"
+              "\n"
+              "Each child is started as\n"
+              "  <program> --RngRun=<run> [--<name>=<value>] <args>\n"
+              "and reports its results with a SweepResultReporter through a ring\n"
+              "in shared memory. Per-parameter summaries of the network-wide flow\n"
+              "statistics and of the reported counters are printed at the end.");
+    cmd.AddValue("program", "path of the simulation program to run", program);
+    cmd.AddValue("param", "swept parameter, as <name>=<v1>,<v2>,...", param);
+    cmd.AddValue("runs", "number of runs per parameter value", runs);
+    cmd.AddValue("firstRun", "RngRun of the first run", firstRun);
+    cmd.AddValue("jobs", "maximum number of concurrent runs", jobs);
+    cmd.AddValue("args", "additional arguments, separated by spaces", extraArgs);
+    cmd.AddValue("ringDir", "directory of the files backing the rings", ringDir);
+    cmd.AddValue("capacity", "number of records in each ring", capacity);
+    cmd.AddValue("quiet", "discard the standard output of the runs", quiet);
+    cmd.AddValue("output", "CSV file for the summaries (default: standard output)", output);
+    cmd.Parse(argc, argv);
+
+    if (program.empty() || runs == 0 || jobs == 0 || capacity == 0)
+    {
+        std::cerr << "A program, and non-zero runs, jobs and capacity are required" << std::endl;
+        return 1;
+    }
+    if (access(ringDir.c_str(), W_OK) != 0)
+    {
+        ringDir = "/tmp";
+    }
+
+    std::string paramName = "param";
+    std::vector<std::string> values{""};
+    if (!param.empty())
+    {
+        auto eq = param.find('=');
+        if (eq == std::string::npos || eq == 0)
+        {
+            std::cerr << "Malformed --param, expected <name>=<v1>,<v2>,..." << std::endl;
+            return 1;
+        }
+        paramName = param.substr(0, eq);
+        values = Split(param.substr(eq + 1), ',');
+        if (values.empty())
+        {
+            std::cerr << "No value given for parameter " << paramName << std::endl;
+            return 1;
+        }
+    }
+    const auto extra = Split(extraArgs, ' ');
+
+    std::deque<std::unique_ptr<Job>> pending;
+    for (std::size_t v = 0; v < values.size(); ++v)
+    {
+        for (uint32_t r = firstRun; r < firstRun + runs; ++r)
+        {
+            auto job = std::make_unique<Job>();
+            job->valueIndex = v;
+            job->runNumber = r;
+            pending.push_back(std::move(job));
+        }
+    }
+    const std::size_t total = pending.size();
+
+    std::vector<Summary> summaries(values.size());
+    std::vector<std::unique_ptr<Job>> active;
+    std::size_t done = 0;
+    uint32_t slot = 0;
+    SystemWallClockMs clock;
+    clock.Start();
+
+    while (!pending.empty() || !active.empty())
+    {
+        while (!pending.empty() && active.size() < jobs)
+        {
+            auto job = std::move(pending.front());
+            pending.pop_front();
+            job->ringPath = ringDir + "/ns3-sweep-" + std::to_string(getpid()) + "-" +
+                            std::to_string(slot++);
+            std::vector<std::string> args{program, "--RngRun=" + std::to_string(job->runNumber)};
+            if (!param.empty())
+            {
+                args.push_back("--" + paramName + "=" + values[job->valueIndex]);
+            }
+            args.insert(args.end(), extra.begin(), extra.end());
+            if (!job->ring.Create(job->ringPath, capacity) || !StartJob(*job, args, quiet))
+            {
+                std::cerr << "Cannot start run " << job->runNumber << std::endl;
+                unlink(job->ringPath.c_str());
+                summaries[job->valueIndex].failed++;
+                ++done;
+                continue;
+            }
+            active.push_back(std::move(job));
+        }
+
+        uint64_t records = 0;
+        for (auto it = active.begin(); it != active.end();)
+        {
+            Job& job = **it;
+            records += Drain(job);
+            int status;
+            if (waitpid(job.pid, &status, WNOHANG) != job.pid)
+            {
+                ++it;
+                continue;
+            }
+            // the child is gone: collect what is left in its ring
+            Drain(job);
+            job.ring.Close();
+            unlink(job.ringPath.c_str());
+            ++done;
+            const bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            const auto& value = values[job.valueIndex];
+            if (ok && job.totals.complete)
+            {
+                summaries[job.valueIndex].Add(job.totals);
+                std::cerr << "[" << done << "/" << total << "] " << paramName << "=" << value
+                          << " run " << job.runNumber << ": " << job.totals.flows << " flows, "
+                          << job.totals.rxPackets << "/" << job.totals.txPackets << " packets"
+                          << std::endl;
+            }
+            else
+            {
+                summaries[job.valueIndex].failed++;
+                std::cerr << "[" << done << "/" << total << "] " << paramName << "=" << value
+                          << " run " << job.runNumber << " failed"
+                          << (ok ? " (no SweepResultReporter::Finish)" : "") << std::endl;
+            }
+            it = active.erase(it);
+        }
+        if (records == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::cerr << total << " runs completed in " << clock.End() / 1000.0 << " s" << std::endl;
+    if (output.empty())
+    {
+        PrintSummaries(std::cout, paramName, values, summaries);
+    }
+    else
+    {
+        std::ofstream ofs(output);
+        PrintSummaries(ofs, paramName, values, summaries);
+    }
+    return 0;
+}